@@ -28,6 +28,22 @@ endif()
 
 set(RAJA_COMPILER "RAJA_COMPILER_${CMAKE_CXX_COMPILER_ID}")
 
+if (RAJA_VECTOR_SCAN_ISA MATCHES "^AVX2$")
+  if (MSVC)
+    set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} /arch:AVX2")
+  else ()
+    set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} -mavx2")
+  endif ()
+elseif (RAJA_VECTOR_SCAN_ISA MATCHES "^AVX512$")
+  if (MSVC)
+    set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} /arch:AVX512")
+  else ()
+    set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} -mavx512f")
+  endif ()
+elseif (NOT RAJA_VECTOR_SCAN_ISA MATCHES "^none$")
+  message(FATAL_ERROR "RAJA_VECTOR_SCAN_ISA must be none, AVX2 or AVX512")
+endif ()
+
 if ( MSVC )
   if (NOT BUILD_SHARED_LIBS)
     foreach(flag_var
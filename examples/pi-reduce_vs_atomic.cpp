@@ -25,6 +25,7 @@
  *    - Index range segment
  *    - Sum reduction
  *    - Atomic add
+ *    - Accumulator choosing between atomics and per-thread sums
  *
  *  If CUDA is enabled, CUDA unified memory is used.
  */
@@ -150,6 +151,29 @@ int main(int RAJA_UNUSED_ARG(argc), char** RAJA_UNUSED_ARG(argv[]))
   std::cout << "\tpi = " << std::setprecision(prec)
             << *atomic_pi << std::endl;
 
+
+  std::cout << "\n Running RAJA OpenMP pi approximation (accumulate)...\n";
+
+  //
+  // The site probes contention on its first loops and then uses
+  // atomics or per-thread partial sums, whichever suits this loop.
+  //
+  static RAJA::accumulate_site pi_site;
+
+  for (int run = 0; run < 3; ++run) {
+    *atomic_pi = 0.0;
+    RAJA::Accumulator<double> acc_pi(pi_site, atomic_pi);
+
+    RAJA::forall<EXEC_POL2>(bins, [=](int i) {
+        double x = (double(i) + 0.5) * dx;
+        acc_pi += dx / (1.0 + x * x);
+    });
+  }
+  *atomic_pi *= 4.0;
+
+  std::cout << "\tpi = " << std::setprecision(prec)
+            << *atomic_pi << std::endl;
+
 #endif
 
 
@@ -30,6 +30,7 @@
 
 #include "RAJA/util/Operators.hpp"
 #include "RAJA/util/basic_mempool.hpp"
+#include "RAJA/util/mempool_allocators.hpp"
 #include "RAJA/util/camp_aliases.hpp"
 #include "RAJA/util/macros.hpp"
 #include "RAJA/util/types.hpp"
@@ -117,6 +118,9 @@
 // Atomic operations support
 //
 #include "RAJA/pattern/atomic.hpp"
+#include "RAJA/policy/atomic_privatized.hpp"
+#include "RAJA/pattern/counter.hpp"
+#include "RAJA/pattern/accumulate.hpp"
 
 //
 // Shared memory view patterns
@@ -156,4 +160,16 @@
 
 #include "RAJA/pattern/scan.hpp"
 
+#include "RAJA/pattern/sort.hpp"
+
+#include "RAJA/pattern/compact.hpp"
+
+#include "RAJA/pattern/merge.hpp"
+
+#include "RAJA/pattern/scatter.hpp"
+
+#include "RAJA/pattern/search.hpp"
+
+#include "RAJA/pattern/reduce_view.hpp"
+
 #endif  // closing endif for header file include guard
@@ -105,6 +105,38 @@ void buildLockFreeColorIndexset(
     Index_type* elemPermutation = 0l,
     Index_type* ielemPermutation = 0l);
 
+/*
+ ******************************************************************************
+ *
+ * Build "bucket" index set from the bucket offsets and index permutation
+ * written by RAJA::bucket, with one List segment per bucket: segment k
+ * holds perm[offsets[k]] ... perm[offsets[k+1]-1], so buckets left empty
+ * give empty segments. Both arrays must be accessible on the host.
+ *
+ * By default each segment copies its indices using given resource. If
+ * 'Unowned' is passed as last argument, the segments point into perm,
+ * which must then outlive the index set.
+ *
+ * Note: Segments are appended to the given index set.
+ *
+ ******************************************************************************
+ */
+template <typename T, typename OFFSET_T, typename... SEG_TYPES>
+void buildBucketIndexSet(RAJA::TypedIndexSet<SEG_TYPES...>& iset,
+                         const T* perm,
+                         const OFFSET_T* offsets,
+                         Index_type nbuckets,
+                         camp::resources::Resource& res,
+                         IndexOwnership owned = Owned)
+{
+  for (Index_type k = 0; k < nbuckets; ++k) {
+    iset.push_back(RAJA::TypedListSegment<T>(perm + offsets[k],
+                                             offsets[k + 1] - offsets[k],
+                                             res,
+                                             owned));
+  }
+}
+
 }  // namespace RAJA
 
 #endif  // closing endif for header file include guard
@@ -0,0 +1,305 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing RAJA Accumulator, which adds values into a
+ *          target with atomics or with per-thread privatization, choosing
+ *          between the two at runtime for each call site.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_accumulate_HPP
+#define RAJA_pattern_accumulate_HPP
+
+#include "RAJA/config.hpp"
+
+#include <atomic>
+#include <memory>
+#include <type_traits>
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/pattern/detail/privatized_copy.hpp"
+
+#include "RAJA/policy/atomic_auto.hpp"
+#include "RAJA/policy/atomic_builtin.hpp"
+#include "RAJA/policy/atomic_privatized.hpp"
+
+namespace RAJA
+{
+
+//! how the copies of an Accumulator add their values into the target
+enum class accumulate_strategy {
+  //! atomics on the target, counting compare-and-swap retries
+  probe,
+  //! atomics on the target
+  atomic,
+  //! per-copy buffers added into the target when the copies are destroyed
+  privatized
+};
+
+/*!
+ * \brief Statistics and strategy of one accumulation call site, kept across
+ * the loops that run it.
+ *
+ * For array targets, the first probe_invocations loops update the target
+ * with compare-and-swap atomics and count how many of them had to retry.
+ * Later loops privatize the updates when more than max_contention retries
+ * per update were observed, or when each copy made at least as many updates
+ * as the target has elements, so that a private buffer costs less than the
+ * atomics it replaces. Otherwise they use plain atomics.
+ *
+ * A scalar target is privatized from the first loop on without probing: its
+ * private copy is a single value, so it never costs more than the atomics.
+ *
+ * A site is meant to be a static object next to the loop, so that each
+ * call site learns its own strategy once per run:
+ *
+ * \code
+ *
+ * static RAJA::accumulate_site site;
+ * RAJA::Accumulator<double> sum(site, &result);
+ *
+ * forall<omp_parallel_for_exec>(seg, [=](Index_type i) { sum += x[i]; });
+ *
+ * \endcode
+ */
+class accumulate_site
+{
+public:
+  explicit accumulate_site(int probe_invocations = 2,
+                           double max_contention = 0.01)
+      : probe_invocations_(probe_invocations), max_contention_(max_contention)
+  {
+  }
+
+  accumulate_site(accumulate_site const&) = delete;
+  accumulate_site& operator=(accumulate_site const&) = delete;
+
+  //! strategy of the loops started from now on
+  accumulate_strategy strategy() const
+  {
+    return static_cast<accumulate_strategy>(strategy_.load());
+  }
+
+  //! compare-and-swap retries per update seen while probing
+  double contention() const
+  {
+    const unsigned long long updates = updates_.load();
+    return updates > 0 ? double(retries_.load()) / double(updates) : 0.0;
+  }
+
+  //! use strategy s for all later loops instead of probing
+  void force(accumulate_strategy s)
+  {
+    invocations_.store(probe_invocations_ + 1);
+    strategy_.store(static_cast<int>(s));
+  }
+
+  //! forget the statistics and probe again, e.g. after the thread count
+  //! or the input changed
+  void reset()
+  {
+    copies_.store(0);
+    updates_.store(0);
+    retries_.store(0);
+    invocations_.store(0);
+    strategy_.store(static_cast<int>(accumulate_strategy::probe));
+  }
+
+  //! called for each loop on a target of size elements, returns the
+  //! strategy the loop uses
+  accumulate_strategy begin_invocation(Index_type size)
+  {
+    if (invocations_.load() > probe_invocations_) {
+      return strategy();
+    }
+    if (size == 1) {
+      force(accumulate_strategy::privatized);
+      return accumulate_strategy::privatized;
+    }
+    const int n = invocations_.fetch_add(1);
+    if (n == probe_invocations_) {
+      const unsigned long long updates = updates_.load();
+      const bool contended =
+          double(retries_.load()) > max_contention_ * double(updates);
+      const bool dense = updates >= copies_.load() * (unsigned long long)size;
+      strategy_.store(static_cast<int>(updates > 0 && (contended || dense)
+                                           ? accumulate_strategy::privatized
+                                           : accumulate_strategy::atomic));
+    }
+    return n < probe_invocations_ ? accumulate_strategy::probe : strategy();
+  }
+
+  //! called by each copy of a probing loop when it is destroyed
+  void record(unsigned long long updates, unsigned long long retries)
+  {
+    if (updates > 0) {
+      copies_.fetch_add(1, std::memory_order_relaxed);
+    }
+    updates_.fetch_add(updates, std::memory_order_relaxed);
+    retries_.fetch_add(retries, std::memory_order_relaxed);
+  }
+
+private:
+  const int probe_invocations_;
+  const double max_contention_;
+
+  std::atomic<int> invocations_{0};
+  std::atomic<int> strategy_{static_cast<int>(accumulate_strategy::probe)};
+  std::atomic<unsigned long long> copies_{0};
+  std::atomic<unsigned long long> updates_{0};
+  std::atomic<unsigned long long> retries_{0};
+};
+
+namespace detail
+{
+
+//! target of an Accumulator and the site it was created for
+template <typename T>
+struct accumulate_target : privatized_target<T> {
+  accumulate_target(accumulate_site& site_, T* data_, Index_type size_)
+      : privatized_target<T>(data_, size_), site(&site_)
+  {
+  }
+
+  accumulate_site* site;
+};
+
+//! updates of one copy of an Accumulator
+template <typename T>
+struct accumulate_local {
+  void merge_into(accumulate_target<T>& target)
+  {
+    buffer.merge_into(target);
+    if (strategy == accumulate_strategy::probe) {
+      target.site->record(updates, retries);
+    }
+  }
+
+  accumulate_strategy strategy = accumulate_strategy::atomic;
+  privatized_buffer<T> buffer;
+  unsigned long long updates = 0;
+  unsigned long long retries = 0;
+};
+
+/*!
+ * Atomic add with a compare-and-swap loop, returning the number of times
+ * the compare-and-swap failed.
+ */
+template <typename T>
+RAJA_INLINE unsigned long long accumulate_counted_add(T volatile* acc,
+                                                      T value)
+{
+  using Bits = typename builtin_atomic_bits<sizeof(T)>::type;
+  unsigned long long retries = 0;
+  Bits oldval = builtin_bit_copy<Bits>(T(*acc));
+  Bits readback;
+  while ((readback = builtin_atomic_CAS(
+              (Bits volatile*)acc,
+              oldval,
+              builtin_bit_copy<Bits>(T(builtin_bit_copy<T>(oldval) + value)))) !=
+         oldval) {
+    oldval = readback;
+    ++retries;
+  }
+  return retries;
+}
+
+}  // namespace detail
+
+/*!
+ * \brief Sum into a scalar or into the elements of an array, updated by the
+ * iterations of a loop.
+ *
+ * The Accumulator constructed by the user updates the target directly with
+ * atomics. Its copies (see detail::privatized_copy) use the strategy that
+ * the accumulate_site chose for the loop:
+ *
+ *   - probe and atomic: every update is an atomic add on the target.
+ *   - privatized: updates go to a buffer of the copy, which is added into
+ *     the target when the copy is destroyed. For a scalar target this is a
+ *     sum reduction; arrays are buffered densely or, when large, in a hash
+ *     table of the touched elements, like privatized_atomic Views.
+ *
+ * The target must not be read in the loop.
+ */
+template <typename T>
+class Accumulator
+{
+  static_assert(std::is_arithmetic<T>::value && (sizeof(T) == 4 ||
+                                                 sizeof(T) == 8),
+                "Accumulator requires a 4 or 8 byte arithmetic value type");
+
+public:
+  using value_type = T;
+
+  //! accumulate into the size elements at target
+  Accumulator(accumulate_site& site, T* target, Index_type size = 1)
+      : m_state{std::make_shared<detail::accumulate_target<T>>(site,
+                                                               target,
+                                                               size)}
+  {
+  }
+
+  Accumulator(Accumulator const& other) : m_state{other.m_state}
+  {
+    detail::accumulate_target<T>& target = m_state.shared();
+    m_state.local()->strategy =
+        other.m_state.local() ? other.m_state.local()->strategy
+                              : target.site->begin_invocation(target.size);
+  }
+
+  Accumulator(Accumulator&& other) = default;
+
+  //! strategy used by this copy
+  accumulate_strategy strategy() const
+  {
+    return m_state.local() ? m_state.local()->strategy
+                           : accumulate_strategy::atomic;
+  }
+
+  //! add value to element i of the target
+  RAJA_INLINE void add(Index_type i, T value) const
+  {
+    detail::accumulate_local<T>* const local = m_state.local();
+    T* const data = m_state.shared().data;
+    if (!local || local->strategy == accumulate_strategy::atomic) {
+      RAJA::atomicAdd(RAJA::auto_atomic{}, data + i, value);
+    } else if (local->strategy == accumulate_strategy::privatized) {
+      local->buffer.add(m_state.shared(), i, value);
+    } else {
+      local->retries += detail::accumulate_counted_add(data + i, value);
+      ++local->updates;
+    }
+  }
+
+  //! element i of an array target, supporting +=, -=, ++ and --
+  RAJA_INLINE detail::privatized_ref<Accumulator> operator()(Index_type i) const
+  {
+    return detail::privatized_ref<Accumulator>(this, i);
+  }
+
+  //! add to a scalar target
+  RAJA_INLINE void operator+=(T value) const { add(0, value); }
+  RAJA_INLINE void operator-=(T value) const { add(0, -value); }
+
+private:
+  detail::privatized_copy<detail::accumulate_target<T>,
+                          detail::accumulate_local<T>>
+      m_state;
+};
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -22,6 +22,9 @@
 
 #include "RAJA/policy/atomic_auto.hpp"
 #include "RAJA/policy/atomic_builtin.hpp"
+#include "RAJA/policy/atomic_backoff.hpp"
+#include "RAJA/policy/atomic_cpp20.hpp"
+#include "RAJA/policy/atomic_valueloc.hpp"
 
 #include "RAJA/util/macros.hpp"
 
@@ -58,6 +61,12 @@ namespace RAJA
  *
  *   builtin_atomic    -- Use the (nonstandard) __sync_fetch_and_XXX functions
  *
+ *   backoff_atomic    -- Like builtin_atomic, with exponential backoff between
+ *                        retries of compare-and-swap loops
+ *
+ *   cpp20_atomic      -- std::atomic_ref with relaxed memory order; use
+ *                        cpp20_atomic_explicit<Order> for other orders
+ *
  *   seq_atomic        -- Non-atomic, does an unprotected (raw) operation
  *
  *
@@ -71,10 +80,20 @@ namespace RAJA
  *
  *   32-bit and 64-bit floating point types:  float and double
  *
+ *   128-bit types, via CAS algorithm, with builtin_atomic (cmpxchg16b where
+ *   available, striped locks otherwise)
+ *
+ *   (value, index) pairs, RAJA::MinLoc and RAJA::MaxLoc, with atomicMin,
+ *   atomicMax, atomicExchange and atomicCAS for the builtin, omp, seq and
+ *   auto policies
+ *
  *
  * The implementation code lives in:
  * RAJA/policy/atomic_auto.hpp     -- for auto_atomic
  * RAJA/policy/atomic_builtin.hpp  -- for builtin_atomic
+ * RAJA/policy/atomic_backoff.hpp  -- for backoff_atomic
+ * RAJA/policy/atomic_cpp20.hpp    -- for cpp20_atomic
+ * RAJA/policy/atomic_valueloc.hpp -- for (value, index) pairs
  * RAJA/policy/XXX/atomic.hpp      -- for omp_atomic, cuda_atomic, etc.
  *
  */
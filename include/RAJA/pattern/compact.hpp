@@ -0,0 +1,260 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA stream compaction declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_compact_HPP
+#define RAJA_compact_HPP
+
+#include "RAJA/config.hpp"
+
+#include <iterator>
+#include <type_traits>
+
+#include "camp/concepts.hpp"
+#include "camp/helpers.hpp"
+
+#include "RAJA/pattern/detail/compact.hpp"
+#include "RAJA/policy/PolicyBase.hpp"
+#include "RAJA/util/Operators.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+template <typename Container>
+using ContainerCompactSize = CompactSize<camp::iterator_from<Container>>;
+
+}  // end namespace detail
+
+/*!
+******************************************************************************
+*
+* \brief  copy_if execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] begin Pointer or Random-Access Iterator to start of data range
+* \param[in] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[out] out Pointer or Random-Access Iterator to start of output data
+*range
+* \param[in] pred unary predicate selecting the elements to copy
+*
+* \return number of elements copied to out, which keep their relative order
+*
+* \note{The range of [begin, end) must be separate from [out, out + (end -
+*begin)). Copying the iterators of a RangeSegment into an Index_type array
+*gives the values of a ListSegment.}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename IterOut,
+          typename Predicate>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value
+                            && type_traits::is_iterator<Iter>::value
+                            && type_traits::is_iterator<IterOut>::value,
+                        detail::CompactSize<Iter>>::type
+copy_if(const ExecPolicy &p,
+        Iter begin,
+        Iter end,
+        IterOut out,
+        Predicate pred)
+{
+  using R = detail::CompactVal<Iter>;
+  static_assert(type_traits::is_unary_function<Predicate, bool, R>::value,
+                "Predicate must model UnaryFunction");
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<IterOut>::value,
+                "Output Iterator must model RandomAccessIterator");
+  if (begin == end) {
+    return 0;
+  }
+  return impl::compact::copy_if(p, begin, end, out, pred);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  remove_if execution pattern
+*
+* \param[in] p Execution policy
+* \param[in,out] begin Pointer or Random-Access Iterator to start of data range
+* \param[in,out] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[in] pred unary predicate selecting the elements to remove
+*
+* \return number of elements kept, which are moved to the front of the range
+*in their relative order
+*
+******************************************************************************
+*/
+template <typename ExecPolicy, typename Iter, typename Predicate>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value
+                            && type_traits::is_iterator<Iter>::value,
+                        detail::CompactSize<Iter>>::type
+remove_if(const ExecPolicy &p, Iter begin, Iter end, Predicate pred)
+{
+  using R = detail::CompactVal<Iter>;
+  static_assert(type_traits::is_unary_function<Predicate, bool, R>::value,
+                "Predicate must model UnaryFunction");
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  if (begin == end) {
+    return 0;
+  }
+  return impl::compact::remove_if(p, begin, end, pred);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  partition execution pattern
+*
+* \param[in] p Execution policy
+* \param[in,out] begin Pointer or Random-Access Iterator to start of data range
+* \param[in,out] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[in] pred unary predicate selecting the elements to move to the front
+*
+* \return number of elements for which pred is true
+*
+* \note{The partition is stable: both parts keep their relative order.}
+******************************************************************************
+*/
+template <typename ExecPolicy, typename Iter, typename Predicate>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value
+                            && type_traits::is_iterator<Iter>::value,
+                        detail::CompactSize<Iter>>::type
+partition(const ExecPolicy &p, Iter begin, Iter end, Predicate pred)
+{
+  using R = detail::CompactVal<Iter>;
+  static_assert(type_traits::is_unary_function<Predicate, bool, R>::value,
+                "Predicate must model UnaryFunction");
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  if (begin == end) {
+    return 0;
+  }
+  return impl::compact::partition(p, begin, end, pred);
+}
+
+// =============================================================================
+
+/*!
+******************************************************************************
+*
+* \brief  copy_if execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] c Random-Access Container
+* \param[out] out Pointer or Random-Access Iterator to start of output data
+*range
+* \param[in] pred unary predicate selecting the elements to copy
+*
+* \return number of elements copied to out
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Container,
+          typename IterOut,
+          typename Predicate>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value
+                            && type_traits::is_range<Container>::value
+                            && type_traits::is_iterator<IterOut>::value,
+                        detail::ContainerCompactSize<Container>>::type
+copy_if(const ExecPolicy &p, const Container &c, IterOut out, Predicate pred)
+{
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+  return ::RAJA::copy_if(p, std::begin(c), std::end(c), out, pred);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  remove_if execution pattern
+*
+* \param[in] p Execution policy
+* \param[in,out] c Random-Access Container
+* \param[in] pred unary predicate selecting the elements to remove
+*
+* \return number of elements kept
+*
+******************************************************************************
+*/
+template <typename ExecPolicy, typename Container, typename Predicate>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value
+                            && type_traits::is_range<Container>::value,
+                        detail::ContainerCompactSize<Container>>::type
+remove_if(const ExecPolicy &p, Container &&c, Predicate pred)
+{
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+  return ::RAJA::remove_if(p, std::begin(c), std::end(c), pred);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  partition execution pattern
+*
+* \param[in] p Execution policy
+* \param[in,out] c Random-Access Container
+* \param[in] pred unary predicate selecting the elements to move to the front
+*
+* \return number of elements for which pred is true
+*
+******************************************************************************
+*/
+template <typename ExecPolicy, typename Container, typename Predicate>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value
+                            && type_traits::is_range<Container>::value,
+                        detail::ContainerCompactSize<Container>>::type
+partition(const ExecPolicy &p, Container &&c, Predicate pred)
+{
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+  return ::RAJA::partition(p, std::begin(c), std::end(c), pred);
+}
+
+template <typename ExecPolicy, typename... Args>
+auto copy_if(Args &&... args)
+    -> decltype(::RAJA::copy_if(ExecPolicy{}, std::forward<Args>(args)...))
+{
+  return ::RAJA::copy_if(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+auto remove_if(Args &&... args)
+    -> decltype(::RAJA::remove_if(ExecPolicy{}, std::forward<Args>(args)...))
+{
+  return ::RAJA::remove_if(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+auto partition(Args &&... args)
+    -> decltype(::RAJA::partition(ExecPolicy{}, std::forward<Args>(args)...))
+{
+  return ::RAJA::partition(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,238 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing RAJA Counter, a shared counter that
+ *          combines the updates of each thread before publishing them.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_counter_HPP
+#define RAJA_pattern_counter_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/mutex.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/pattern/detail/privatized_copy.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! state shared by a Counter and all of its copies
+template <typename T>
+struct counter_shared {
+  counter_shared(T init, T block) : total(init), next(init), block_size(block)
+  {
+  }
+
+  //! give [begin, end) back, or record it as a gap if values were reserved
+  //! after it
+  void retire(T begin, T end)
+  {
+    if (begin == end) {
+      return;
+    }
+    T last = end;
+    if (!next.compare_exchange_strong(last,
+                                      begin,
+                                      std::memory_order_relaxed)) {
+      lock_guard<spin_mutex> guard(lock);
+      unused.emplace_back(begin, end);
+    }
+  }
+
+  //! published value of the counter
+  std::atomic<T> total;
+  //! first value not yet handed out by fetch_add
+  std::atomic<T> next;
+  const T block_size;
+
+  spin_mutex lock;
+  //! [begin, end) ranges reserved by copies but never handed out
+  std::vector<std::pair<T, T>> unused;
+};
+
+//! updates of one copy of a Counter that are not published yet
+template <typename T>
+struct counter_local {
+  //! add the pending updates to the published value
+  void publish(counter_shared<T>& shared)
+  {
+    if (pending != T(0)) {
+      shared.total.fetch_add(pending, std::memory_order_relaxed);
+      pending = T(0);
+    }
+    updates = 0;
+  }
+
+  void merge_into(counter_shared<T>& shared)
+  {
+    publish(shared);
+    shared.retire(next, end);
+  }
+
+  T pending = 0;
+  unsigned updates = 0;
+  //! [next, end) reserved from the shared counter, not handed out yet
+  T next = 0;
+  T end = 0;
+};
+
+}  // namespace detail
+
+/*!
+ * \brief Counter hit by every iteration of a loop, such as the number of
+ * particles that escaped or the next free slot of an output array.
+ *
+ * The Counter constructed by the user updates the shared value directly
+ * with atomics. Its copies (see detail::privatized_copy) accumulate their
+ * increments privately and add them to the shared value every
+ * publish_interval updates and when they are destroyed. After the forall
+ * statement get() returns the exact count; during the loop it may lag
+ * behind.
+ *
+ * fetch_add(n) hands out n consecutive values. A copy reserves block_size
+ * values at a time from the shared counter and serves its fetch_adds from
+ * that block, so threads only touch the shared counter once per block. The
+ * values handed out by different threads are unique. A copy gives the rest
+ * of its block back when nothing was reserved after it, otherwise the rest
+ * is left as a gap; unused() lists the gaps once the loop is finished.
+ * Values are dense with a sequential policy.
+ */
+template <typename T = Index_type>
+class Counter
+{
+  static_assert(std::is_integral<T>::value,
+                "Counter requires an integral value type");
+
+public:
+  using value_type = T;
+
+  //! number of updates a copy combines before publishing them
+  static constexpr unsigned publish_interval = 1024;
+
+  explicit Counter(T init = T(0), T block_size = T(64))
+      : m_state{std::make_shared<detail::counter_shared<T>>(init, block_size)}
+  {
+  }
+
+  //! add n to the counter
+  void operator+=(T n) const
+  {
+    if (detail::counter_local<T>* local = m_state.local()) {
+      local->pending += n;
+      if (++local->updates == publish_interval) {
+        local->publish(m_state.shared());
+      }
+    } else {
+      m_state.shared().total.fetch_add(n, std::memory_order_relaxed);
+    }
+  }
+
+  //! subtract n from the counter
+  void operator-=(T n) const { *this += T(0) - n; }
+
+  void operator++() const { *this += T(1); }
+  void operator++(int) const { *this += T(1); }
+  void operator--() const { *this -= T(1); }
+  void operator--(int) const { *this -= T(1); }
+
+  /*!
+   * Add n to the counter and return the first of n consecutive values that
+   * no other fetch_add on this counter returns.
+   */
+  T fetch_add(T n = T(1)) const
+  {
+    detail::counter_shared<T>& shared = m_state.shared();
+    detail::counter_local<T>* const local = m_state.local();
+    if (!local) {
+      shared.total.fetch_add(n, std::memory_order_relaxed);
+      return shared.next.fetch_add(n, std::memory_order_relaxed);
+    }
+    if (T(local->end - local->next) < n) {
+      if (n >= shared.block_size) {
+        *this += n;
+        return shared.next.fetch_add(n, std::memory_order_relaxed);
+      }
+      shared.retire(local->next, local->end);
+      local->next =
+          shared.next.fetch_add(shared.block_size, std::memory_order_relaxed);
+      local->end = local->next + shared.block_size;
+    }
+    const T start = local->next;
+    local->next += n;
+    *this += n;
+    return start;
+  }
+
+  //! the published value, plus the pending updates of this copy
+  T get() const
+  {
+    T value = m_state.shared().total.load(std::memory_order_relaxed);
+    if (detail::counter_local<T>* local = m_state.local()) {
+      value += local->pending;
+    }
+    return value;
+  }
+
+  operator T() const { return get(); }
+
+  //! end of the values reserved by fetch_add, gaps included
+  T reserved() const
+  {
+    return m_state.shared().next.load(std::memory_order_relaxed);
+  }
+
+  //! [begin, end) ranges of reserved values fetch_add did not hand out
+  std::vector<std::pair<T, T>> unused() const
+  {
+    detail::counter_shared<T>& shared = m_state.shared();
+    std::vector<std::pair<T, T>> ranges;
+    {
+      lock_guard<spin_mutex> guard(shared.lock);
+      ranges = shared.unused;
+    }
+    std::sort(ranges.begin(), ranges.end());
+    return ranges;
+  }
+
+  //! set the counter to init, forgetting all reservations
+  void reset(T init = T(0))
+  {
+    detail::counter_shared<T>& shared = m_state.shared();
+    shared.total.store(init);
+    shared.next.store(init);
+    lock_guard<spin_mutex> guard(shared.lock);
+    shared.unused.clear();
+  }
+
+private:
+  detail::privatized_copy<detail::counter_shared<T>, detail::counter_local<T>>
+      m_state;
+};
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
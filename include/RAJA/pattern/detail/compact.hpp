@@ -0,0 +1,51 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Backend-independent helpers for the RAJA stream compaction
+ *          patterns.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_detail_compact_HPP
+#define RAJA_pattern_detail_compact_HPP
+
+#include "RAJA/config.hpp"
+
+#include <iterator>
+#include <type_traits>
+
+#include "camp/helpers.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+template <typename Iter>
+using CompactVal = camp::decay<decltype(*camp::val<Iter>())>;
+
+//! number of elements selected by a compaction over Iter
+template <typename Iter>
+using CompactSize = typename std::iterator_traits<Iter>::difference_type;
+
+//! CompactSize<Iter> when Cond holds, for overload selection by policy
+template <typename Cond, typename Iter>
+using compact_enable_if =
+    typename std::enable_if<Cond::value, CompactSize<Iter>>::type;
+
+}  // namespace detail
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
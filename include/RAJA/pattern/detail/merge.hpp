@@ -0,0 +1,234 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Backend-independent building blocks for the RAJA merge and set
+ *          operation patterns.
+ *
+ *          The algorithms here split the output of merging two sorted
+ *          ranges into equal parts along the merge path and run them with
+ *          the block runners of the sort patterns (see
+ *          RAJA/pattern/detail/sort.hpp).
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_detail_merge_HPP
+#define RAJA_pattern_detail_merge_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include "camp/helpers.hpp"
+
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/pattern/detail/sort.hpp"
+
+#include "RAJA/policy/loop/policy.hpp"
+#include "RAJA/policy/loop/scan.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! number of elements written by a merge or set operation over Iter
+template <typename Iter>
+using MergeSize = typename std::iterator_traits<Iter>::difference_type;
+
+//! MergeSize<Iter> when Cond holds, for overload selection by policy
+template <typename Cond, typename Iter>
+using merge_enable_if =
+    typename std::enable_if<Cond::value, MergeSize<Iter>>::type;
+
+//! selects the standard algorithm run on each part of a set operation
+enum class set_op { set_union, set_intersection };
+
+//! output iterator that only counts the elements written to it
+template <typename Size>
+struct counting_output {
+  using iterator_category = std::output_iterator_tag;
+  using value_type = void;
+  using difference_type = Size;
+  using pointer = void;
+  using reference = void;
+
+  Size count = 0;
+
+  template <typename T>
+  RAJA_INLINE counting_output& operator=(T const&)
+  {
+    ++count;
+    return *this;
+  }
+  RAJA_INLINE counting_output& operator*() { return *this; }
+  RAJA_INLINE counting_output& operator++() { return *this; }
+  RAJA_INLINE counting_output& operator++(int) { return *this; }
+};
+
+template <set_op Op,
+          typename IterA,
+          typename IterB,
+          typename OutIter,
+          typename Compare>
+RAJA_INLINE OutIter run_set_op(IterA a0,
+                               IterA a1,
+                               IterB b0,
+                               IterB b1,
+                               OutIter out,
+                               Compare comp)
+{
+  return Op == set_op::set_union
+             ? std::set_union(a0, a1, b0, b1, out, comp)
+             : std::set_intersection(a0, a1, b0, b1, out, comp);
+}
+
+/*!
+ * Stable merge of sorted ranges a (length m) and b (length l) into out,
+ * which receives m + l elements. Each of the nb parts of the output finds
+ * its inputs with merge_path_split and merges them independently.
+ */
+template <typename Runner,
+          typename IterA,
+          typename IterB,
+          typename OutIter,
+          typename Size,
+          typename Compare>
+Size merge_with(Runner const& run,
+                IterA a,
+                Size m,
+                IterB b,
+                Size l,
+                OutIter out,
+                Compare comp)
+{
+  const Size n = m + l;
+  const int nb = run.num_blocks(n);
+  run(nb, [&](int p) {
+    const Size k0 = block_begin(n, nb, p);
+    const Size k1 = block_begin(n, nb, p + 1);
+    const Size a0 = merge_path_split(k0, a, m, b, l, comp);
+    const Size a1 = merge_path_split(k1, a, m, b, l, comp);
+    std::merge(a + a0,
+               a + a1,
+               b + (k0 - a0),
+               b + (k1 - a1),
+               out + k0,
+               comp);
+  });
+  return n;
+}
+
+/*!
+ * Split of a (length m) and b (length l) near position k of their merge
+ * such that no equivalent elements are separated: a[0, i) and b[0, j) hold
+ * exactly the elements that order before the first element at or after k.
+ */
+template <typename IterA, typename IterB, typename Size, typename Compare>
+RAJA_INLINE void set_split(Size k,
+                           IterA a,
+                           Size m,
+                           IterB b,
+                           Size l,
+                           Compare comp,
+                           Size& i,
+                           Size& j)
+{
+  i = merge_path_split(k, a, m, b, l, comp);
+  j = k - i;
+  if (i == m && j == l) {
+    return;
+  }
+  // x is the first element at or after k; move all equivalent ones after
+  const bool from_b = i == m || (j < l && comp(*(b + j), *(a + i)));
+  const sort_key<IterA> x = from_b ? *(b + j) : *(a + i);
+  i = std::lower_bound(a, a + i, x, comp) - a;
+  j = std::lower_bound(b, b + j, x, comp) - b;
+}
+
+/*!
+ * Union or intersection of sorted ranges a (length m) and b (length l)
+ * with the semantics of std::set_union and std::set_intersection, written
+ * to out. Returns the number of elements written.
+ *
+ * The merge of the inputs is split into nb parts as for merge_with, with
+ * the split points moved back so runs of equivalent elements are never
+ * separated. Each part counts its output, the counts are scanned, and each
+ * part then writes its output starting from the count of the preceding
+ * parts.
+ */
+template <set_op Op,
+          typename Runner,
+          typename IterA,
+          typename IterB,
+          typename OutIter,
+          typename Size,
+          typename Compare>
+Size set_op_with(Runner const& run,
+                 IterA a,
+                 Size m,
+                 IterB b,
+                 Size l,
+                 OutIter out,
+                 Compare comp)
+{
+  const Size n = m + l;
+  const int nb = run.num_blocks(n);
+  if (nb == 1) {
+    return run_set_op<Op>(a, a + m, b, b + l, out, comp) - out;
+  }
+
+  std::vector<Size> as(nb + 1), bs(nb + 1);
+  // one extra entry so the scan leaves the total in counts[nb]
+  std::vector<Size> counts(nb + 1, Size(0));
+  as[nb] = m;
+  bs[nb] = l;
+
+  run(nb, [&](int p) {
+    set_split(block_begin(n, nb, p), a, m, b, l, comp, as[p], bs[p]);
+  });
+  run(nb, [&](int p) {
+    counts[p] = run_set_op<Op>(a + as[p],
+                               a + as[p + 1],
+                               b + bs[p],
+                               b + bs[p + 1],
+                               counting_output<Size>{},
+                               comp)
+                    .count;
+  });
+  ::RAJA::impl::scan::exclusive_inplace(::RAJA::loop_exec{},
+                                        counts.data(),
+                                        counts.data() + nb + 1,
+                                        operators::plus<Size>{},
+                                        Size(0));
+  run(nb, [&](int p) {
+    run_set_op<Op>(a + as[p],
+                   a + as[p + 1],
+                   b + bs[p],
+                   b + bs[p + 1],
+                   out + counts[p],
+                   comp);
+  });
+  return counts[nb];
+}
+
+}  // namespace detail
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
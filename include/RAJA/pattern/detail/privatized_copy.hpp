@@ -0,0 +1,93 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing the state of objects whose copies collect
+ *          their updates privately, such as privatized atomic Views,
+ *          Counters and Accumulators.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_detail_privatized_copy_HPP
+#define RAJA_pattern_detail_privatized_copy_HPP
+
+#include "RAJA/config.hpp"
+
+#include <memory>
+#include <utility>
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * \brief Shared state of an object and the private state of one of its
+ * copies.
+ *
+ * The object constructed by the user has no Local state and updates the
+ * Shared state directly. Each copy of it, such as the one captured by a loop
+ * body and the per-thread copies made by the parallel forall
+ * implementations, owns a new Local state that collects its updates.
+ * Local::merge_into(Shared&) adds them into the shared state when the copy
+ * is destroyed. The updates of a loop are therefore complete once the loop
+ * body passed to forall has been destroyed, at the end of the forall
+ * statement for a lambda written in place. Moving an object moves its Local
+ * state along.
+ *
+ * As with reducers, a copy must not be shared between threads.
+ */
+template <typename Shared, typename Local>
+class privatized_copy
+{
+public:
+  explicit privatized_copy(std::shared_ptr<Shared> shared)
+      : m_shared{std::move(shared)}
+  {
+  }
+
+  privatized_copy(privatized_copy const& other)
+      : m_shared{other.m_shared}, m_local{new Local}
+  {
+  }
+
+  privatized_copy(privatized_copy&& other) = default;
+
+  privatized_copy& operator=(privatized_copy const&) = delete;
+  privatized_copy& operator=(privatized_copy&&) = delete;
+
+  ~privatized_copy()
+  {
+    if (m_local) {
+      m_local->merge_into(*m_shared);
+    }
+  }
+
+  //! state shared by the object and all of its copies
+  RAJA_INLINE Shared& shared() const { return *m_shared; }
+
+  //! state of this copy, null for the object constructed by the user
+  RAJA_INLINE Local* local() const { return m_local.get(); }
+
+private:
+  std::shared_ptr<Shared> m_shared;
+  std::unique_ptr<Local> m_local;
+};
+
+}  // namespace detail
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -18,6 +18,8 @@
 #ifndef RAJA_PATTERN_DETAIL_REDUCE_HPP
 #define RAJA_PATTERN_DETAIL_REDUCE_HPP
 
+#include <algorithm>
+
 #include "RAJA/util/Operators.hpp"
 #include "RAJA/util/types.hpp"
 
@@ -41,12 +43,24 @@
     using Base::Base;                                                    \
   };
 
+#define RAJA_DECLARE_INDEX_K_REDUCER(OP, POL, COMBINER)                     \
+  template <typename T, typename IndexType, size_t K>                       \
+  class Reduce##OP<POL, T, IndexType, K>                                    \
+      : public reduce::detail::BaseReduce##OP<T, IndexType, K, COMBINER>    \
+  {                                                                         \
+  public:                                                                   \
+    using Base = reduce::detail::BaseReduce##OP<T, IndexType, K, COMBINER>; \
+    using Base::Base;                                                       \
+  };
+
 #define RAJA_DECLARE_ALL_REDUCERS(POL, COMBINER)       \
   RAJA_DECLARE_REDUCER(Sum, POL, COMBINER)             \
   RAJA_DECLARE_REDUCER(Min, POL, COMBINER)             \
   RAJA_DECLARE_REDUCER(Max, POL, COMBINER)             \
   RAJA_DECLARE_INDEX_REDUCER(MinLoc, POL, COMBINER)    \
-  RAJA_DECLARE_INDEX_REDUCER(MaxLoc, POL, COMBINER)
+  RAJA_DECLARE_INDEX_REDUCER(MaxLoc, POL, COMBINER)    \
+  RAJA_DECLARE_INDEX_K_REDUCER(MinLocK, POL, COMBINER) \
+  RAJA_DECLARE_INDEX_K_REDUCER(MaxLocK, POL, COMBINER)
 
 namespace RAJA
 {
@@ -110,8 +124,22 @@ struct DefaultLoc<T, true>
   RAJA_HOST_DEVICE constexpr T value() const { return -1; }
 };
 
+/*!
+ * Alignment of a ValueLoc: pairs of 8 or 16 bytes are aligned to their size
+ * so the atomics can update them with a single compare-and-swap.
+ */
+template <typename T, typename IndexType>
+struct ValueLocAlign {
+  struct pair {
+    T val;
+    IndexType loc;
+  };
+  static constexpr size_t value =
+      (sizeof(pair) == 8 || sizeof(pair) == 16) ? sizeof(pair) : alignof(pair);
+};
+
 template <typename T, typename IndexType, bool doing_min = true>
-class ValueLoc
+class alignas(ValueLocAlign<T, IndexType>::value) ValueLoc
 {
 public:
   T val = doing_min ? operators::limits<T>::max() : operators::limits<T>::min();
@@ -146,6 +174,96 @@ public:
   }
 };
 
+/*!
+ * The K best (value, index) pairs seen so far, kept as a binary heap with
+ * the least restrictive pair at the root so that a new candidate only has
+ * to be compared against the root once the heap is full.
+ *
+ * Pairs are ordered by value, with ties broken by the smaller index, so the
+ * selected set does not depend on how the iterations were split between
+ * threads.
+ */
+template <typename T, typename IndexType, size_t K, bool doing_min = true>
+class ValueLocK
+{
+  static_assert(K > 0, "ValueLocK requires K > 0");
+
+public:
+  struct entry {
+    T val;
+    IndexType loc;
+  };
+
+  entry data[K];
+  size_t count = 0;
+
+  //! true if a is more restrictive than b
+  static bool better(entry const &a, entry const &b)
+  {
+    return (doing_min ? a.val < b.val : b.val < a.val)
+           || (!(a.val < b.val) && !(b.val < a.val) && a.loc < b.loc);
+  }
+
+  void insert(T const &val, IndexType const &loc)
+  {
+    entry const e{val, loc};
+    if (count < K) {
+      data[count++] = e;
+      std::push_heap(data, data + count, better);
+    } else if (better(e, data[0])) {
+      std::pop_heap(data, data + K, better);
+      data[K - 1] = e;
+      std::push_heap(data, data + K, better);
+    }
+  }
+
+  void merge(ValueLocK const &other)
+  {
+    for (size_t i = 0; i < other.count; ++i) {
+      insert(other.data[i].val, other.data[i].loc);
+    }
+  }
+
+  //! copy of the pairs ordered from most to least restrictive
+  ValueLocK sorted() const
+  {
+    ValueLocK res(*this);
+    std::sort_heap(res.data, res.data + res.count, better);
+    return res;
+  }
+
+  size_t size() const { return count; }
+
+  bool operator==(ValueLocK const &rhs) const
+  {
+    if (count != rhs.count) return false;
+    for (size_t i = 0; i < count; ++i) {
+      if (data[i].val != rhs.data[i].val || data[i].loc != rhs.data[i].loc) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool operator!=(ValueLocK const &rhs) const { return !(*this == rhs); }
+};
+
+//! reduction operator merging two ValueLocK heaps; the identity is empty
+template <typename VK>
+struct merge_k {
+  struct operator_type {
+    VK operator()(VK lhs, VK const &rhs) const
+    {
+      lhs.merge(rhs);
+      return lhs;
+    }
+  };
+
+  static VK identity() { return VK(); }
+
+  void operator()(VK &val, VK const &v) const { val.merge(v); }
+};
+
 }  // namespace detail
 
 }  // namespace reduce
@@ -462,6 +580,100 @@ public:
   operator T() const { return Base::get(); }
 };
 
+/*!
+ **************************************************************************
+ *
+ * \brief  Common base of the K-smallest and K-largest loc reducers.
+ *
+ **************************************************************************
+ */
+template <typename T,
+          typename IndexType,
+          size_t K,
+          bool doing_min,
+          template <typename, typename> class Combiner>
+class BaseReduceLocK
+    : public BaseReduce<ValueLocK<T, IndexType, K, doing_min>,
+                        merge_k,
+                        Combiner>
+{
+public:
+  using Base =
+      BaseReduce<ValueLocK<T, IndexType, K, doing_min>, merge_k, Combiner>;
+  using value_type = typename Base::value_type;
+  using Base::Base;
+  using Base::get;
+
+  void reset() { Base::reset(value_type()); }
+
+  //! Number of pairs found, at most K
+  size_t size() const { return Base::get().size(); }
+
+  //! Get the i-th most restrictive value, 0 <= i < size()
+  T get(size_t i) const { return Base::get().sorted().data[i].val; }
+
+  //! Get the index of the i-th most restrictive value, 0 <= i < size()
+  IndexType getLoc(size_t i) const
+  {
+    return Base::get().sorted().data[i].loc;
+  }
+
+protected:
+  void insert(T rhs, IndexType loc) const { this->local().insert(rhs, loc); }
+};
+
+/*!
+ **************************************************************************
+ *
+ * \brief  K-smallest-with-location reducer class template.
+ *
+ **************************************************************************
+ */
+template <typename T,
+          typename IndexType,
+          size_t K,
+          template <typename, typename> class Combiner>
+class BaseReduceMinLocK
+    : public BaseReduceLocK<T, IndexType, K, true, Combiner>
+{
+public:
+  using Base = BaseReduceLocK<T, IndexType, K, true, Combiner>;
+  using Base::Base;
+
+  //! reducer function; updates the current instance's state
+  const BaseReduceMinLocK &minloc(T rhs, IndexType loc) const
+  {
+    this->insert(rhs, loc);
+    return *this;
+  }
+};
+
+/*!
+ **************************************************************************
+ *
+ * \brief  K-largest-with-location reducer class template.
+ *
+ **************************************************************************
+ */
+template <typename T,
+          typename IndexType,
+          size_t K,
+          template <typename, typename> class Combiner>
+class BaseReduceMaxLocK
+    : public BaseReduceLocK<T, IndexType, K, false, Combiner>
+{
+public:
+  using Base = BaseReduceLocK<T, IndexType, K, false, Combiner>;
+  using Base::Base;
+
+  //! reducer function; updates the current instance's state
+  const BaseReduceMaxLocK &maxloc(T rhs, IndexType loc) const
+  {
+    this->insert(rhs, loc);
+    return *this;
+  }
+};
+
 }  // namespace detail
 
 }  // namespace reduce
@@ -0,0 +1,279 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Backend-independent building blocks for the RAJA transform
+ *          scans and the segmented scans and reductions.
+ *
+ *          Segment boundaries are described by a heads object:
+ *
+ *            struct Heads {
+ *              // copy of the heads positioned at element i0
+ *              template <typename Size> Heads at(Size i0) const;
+ *              // true if element i starts a segment; called for
+ *              // i0, i0 + 1, ... in order on the copy returned by at(i0)
+ *              template <typename Size> bool operator()(Size i);
+ *            };
+ *
+ *          Element 0 always starts a segment.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_detail_scan_HPP
+#define RAJA_pattern_detail_scan_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! segments are runs of consecutive keys that compare equal
+template <typename KeyIter, typename Equal>
+struct key_heads {
+  KeyIter keys;
+  Equal eq;
+
+  template <typename Size>
+  RAJA_INLINE key_heads at(Size) const
+  {
+    return *this;
+  }
+
+  template <typename Size>
+  RAJA_INLINE bool operator()(Size i) const
+  {
+    return i == 0 || !eq(*(keys + (i - 1)), *(keys + i));
+  }
+};
+
+//! segments start at the elements whose flag is nonzero
+template <typename FlagIter>
+struct flag_heads {
+  FlagIter flags;
+
+  template <typename Size>
+  RAJA_INLINE flag_heads at(Size) const
+  {
+    return *this;
+  }
+
+  template <typename Size>
+  RAJA_INLINE bool operator()(Size i) const
+  {
+    return i == 0 || static_cast<bool>(*(flags + i));
+  }
+};
+
+//! segments start at the indices in the sorted range [first, last)
+template <typename OffsetIter>
+struct offset_heads {
+  OffsetIter first;
+  OffsetIter last;
+
+  template <typename Size>
+  RAJA_INLINE offset_heads at(Size i0) const
+  {
+    return offset_heads{std::lower_bound(first, last, i0), last};
+  }
+
+  // repeated offsets describe empty segments, so skip all of them
+  template <typename Size>
+  RAJA_INLINE bool operator()(Size i)
+  {
+    bool head = (i == 0);
+    while (first != last && static_cast<Size>(*first) == i) {
+      head = true;
+      ++first;
+    }
+    return head;
+  }
+};
+
+/*!
+ * Scan the values value(i) for i in [i0, i1) starting from agg, reporting
+ * the scan result at i as emit(i, v). On return agg holds the reduction of
+ * the block combined with its initial value.
+ */
+template <bool Inclusive,
+          typename Size,
+          typename Values,
+          typename Emit,
+          typename BinFn,
+          typename Value>
+RAJA_INLINE void transform_scan_block(Size i0,
+                                      Size i1,
+                                      Values const& value,
+                                      Emit const& emit,
+                                      BinFn f,
+                                      Value& agg)
+{
+  for (Size i = i0; i < i1; ++i) {
+    const Value x = value(i);
+    if (Inclusive) {
+      agg = f(agg, x);
+      emit(i, agg);
+    } else {
+      emit(i, agg);
+      agg = f(agg, x);
+    }
+  }
+}
+
+/*!
+ * Reduce [i0, i1) of in into agg, restarting from init at every segment
+ * head. Returns whether the block contains a head; if it does not, agg is
+ * the reduction of the whole block starting from the operator identity.
+ */
+template <typename Iter,
+          typename Size,
+          typename Heads,
+          typename BinFn,
+          typename Value>
+RAJA_INLINE bool segmented_reduce_block(Iter in,
+                                        Size i0,
+                                        Size i1,
+                                        Heads head,
+                                        BinFn f,
+                                        Value const& init,
+                                        Value& agg)
+{
+  bool has_head = false;
+  agg = BinFn::identity();
+  for (Size i = i0; i < i1; ++i) {
+    if (head(i)) {
+      agg = init;
+      has_head = true;
+    }
+    agg = f(agg, *(in + i));
+  }
+  return has_head;
+}
+
+/*!
+ * Scan [i0, i1) of in into out, starting from agg and restarting from init
+ * at every segment head. out may equal in.
+ */
+template <bool Inclusive,
+          typename Iter,
+          typename OutIter,
+          typename Size,
+          typename Heads,
+          typename BinFn,
+          typename Value>
+RAJA_INLINE void segmented_scan_block(Iter in,
+                                      OutIter out,
+                                      Size i0,
+                                      Size i1,
+                                      Heads head,
+                                      BinFn f,
+                                      Value const& init,
+                                      Value agg)
+{
+  for (Size i = i0; i < i1; ++i) {
+    const Value x = *(in + i);
+    if (head(i)) {
+      agg = init;
+    }
+    if (Inclusive) {
+      agg = f(agg, x);
+      *(out + i) = agg;
+    } else {
+      *(out + i) = agg;
+      agg = f(agg, x);
+    }
+  }
+}
+
+/*!
+ * Reduce the values value(i) for i in [i0, i1) into agg, restarting from
+ * the operator identity at every segment head. Returns the number of heads
+ * in the block; if there are none, agg is the reduction of the whole block.
+ */
+template <typename Size,
+          typename Heads,
+          typename Values,
+          typename BinFn,
+          typename Value>
+RAJA_INLINE Size segmented_count_block(Size i0,
+                                       Size i1,
+                                       Heads head,
+                                       Values const& value,
+                                       BinFn f,
+                                       Value& agg)
+{
+  Size heads = 0;
+  agg = BinFn::identity();
+  for (Size i = i0; i < i1; ++i) {
+    if (head(i)) {
+      agg = BinFn::identity();
+      ++heads;
+    }
+    agg = f(agg, value(i));
+  }
+  return heads;
+}
+
+/*!
+ * Reduce every segment that ends in [i0, i1), starting from agg, the
+ * reduction of the segment open at i0, and s, the number of segments that
+ * start before i0. Segment heads i are reported as emit_head(s, i) and
+ * segment reductions as emit_value(s, v); the last segment is only
+ * reported when last is true. On return agg holds the reduction of the
+ * segment open at i1; returns the number of segments that start before i1.
+ */
+template <typename Size,
+          typename Heads,
+          typename Values,
+          typename BinFn,
+          typename Value,
+          typename EmitHead,
+          typename EmitValue>
+RAJA_INLINE Size reduce_segments_block(Size i0,
+                                       Size i1,
+                                       bool last,
+                                       Heads head,
+                                       Values const& value,
+                                       BinFn f,
+                                       Value& agg,
+                                       Size s,
+                                       EmitHead const& emit_head,
+                                       EmitValue const& emit_value)
+{
+  for (Size i = i0; i < i1; ++i) {
+    if (head(i)) {
+      if (s > 0) {
+        emit_value(s - 1, agg);
+      }
+      emit_head(s, i);
+      ++s;
+      agg = BinFn::identity();
+    }
+    agg = f(agg, value(i));
+  }
+  if (last) {
+    emit_value(s - 1, agg);
+  }
+  return s;
+}
+
+}  // namespace detail
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,134 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Backend-independent building blocks for the RAJA scatter_add
+ *          pattern.
+ *
+ *          The algorithm here runs with the block runners of the sort
+ *          patterns (see RAJA/pattern/detail/sort.hpp).
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_detail_scatter_HPP
+#define RAJA_pattern_detail_scatter_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/pattern/detail/sort.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * Add values[i] to target[idx[i]] for i in [0, n).
+ *
+ * Each of the nb blocks of the input sorts its (index, value) pairs by
+ * index and combines the values of repeated indices. The range of indices
+ * is then split into nb equal parts, and each part adds the combined values
+ * of every block that fall into it, so every target element is written by
+ * a single block without atomics.
+ */
+template <typename Runner,
+          typename TargetIter,
+          typename IdxIter,
+          typename ValIter,
+          typename Size>
+void scatter_add_with(Runner const& run,
+                      TargetIter target,
+                      IdxIter idx,
+                      Size n,
+                      ValIter values)
+{
+  using K = sort_key<IdxIter>;
+  using V = sort_key<ValIter>;
+  using Entry = std::pair<K, V>;
+
+  const int nb = run.num_blocks(n);
+  if (nb == 1) {
+    for (Size i = 0; i < n; ++i) {
+      *(target + *(idx + i)) += *(values + i);
+    }
+    return;
+  }
+
+  std::vector<std::vector<Entry>> combined(nb);
+  run(nb, [&](int b) {
+    const Size i0 = block_begin(n, nb, b);
+    const Size i1 = block_begin(n, nb, b + 1);
+    std::vector<Entry>& entries = combined[b];
+    entries.reserve(i1 - i0);
+    for (Size i = i0; i < i1; ++i) {
+      entries.emplace_back(*(idx + i), *(values + i));
+    }
+    std::sort(entries.begin(),
+              entries.end(),
+              [](Entry const& a, Entry const& c) { return a.first < c.first; });
+    auto last = entries.begin();
+    for (auto it = entries.begin() + 1; it != entries.end(); ++it) {
+      if (it->first == last->first) {
+        last->second += it->second;
+      } else {
+        *++last = *it;
+      }
+    }
+    entries.erase(last + 1, entries.end());
+  });
+
+  K lo = combined[0].front().first;
+  K hi = combined[0].back().first;
+  for (int b = 1; b < nb; ++b) {
+    lo = std::min(lo, combined[b].front().first);
+    hi = std::max(hi, combined[b].back().first);
+  }
+  // part q holds the indices [lo + block_begin(span, nb, q), ...), computed
+  // without overflow for any integral index type
+  const std::uint64_t span = static_cast<std::uint64_t>(hi) -
+                             static_cast<std::uint64_t>(lo) + 1;
+
+  run(nb, [&](int q) {
+    const K k0 = static_cast<K>(static_cast<std::uint64_t>(lo) +
+                                block_begin(span, nb, q));
+    const K k1 = static_cast<K>(static_cast<std::uint64_t>(lo) +
+                                block_begin(span, nb, q + 1));
+    auto before = [](Entry const& e, K k) { return e.first < k; };
+    for (int b = 0; b < nb; ++b) {
+      std::vector<Entry> const& entries = combined[b];
+      auto it = q == 0 ? entries.begin()
+                       : std::lower_bound(
+                             entries.begin(), entries.end(), k0, before);
+      auto end = q == nb - 1
+                     ? entries.end()
+                     : std::lower_bound(it, entries.end(), k1, before);
+      for (; it != end; ++it) {
+        *(target + it->first) += it->second;
+      }
+    }
+  });
+}
+
+}  // namespace detail
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
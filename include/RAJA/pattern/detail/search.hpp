@@ -0,0 +1,105 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Backend-independent building blocks for the RAJA search
+ *          patterns.
+ *
+ *          Parallel searches split the range into chunks of
+ *          search_chunk_size elements and share the position of the best
+ *          match found so far. Each chunk checks it before starting, so a
+ *          search stops within a chunk per thread once its answer is known.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_detail_search_HPP
+#define RAJA_pattern_detail_search_HPP
+
+#include "RAJA/config.hpp"
+
+#include <atomic>
+#include <iterator>
+#include <type_traits>
+
+#include "camp/helpers.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+template <typename Iter>
+using SearchVal = camp::decay<decltype(*camp::val<Iter>())>;
+
+//! position found by a search over Iter
+template <typename Iter>
+using SearchSize = typename std::iterator_traits<Iter>::difference_type;
+
+//! SearchSize<Iter> when Cond holds, for overload selection by policy
+template <typename Cond, typename Iter>
+using search_enable_if =
+    typename std::enable_if<Cond::value, SearchSize<Iter>>::type;
+
+//! number of elements a parallel search checks between polls
+constexpr int search_chunk_size = 1 << 12;
+
+//! predicate that holds where Predicate does not
+template <typename Predicate>
+struct negated {
+  Predicate pred;
+
+  template <typename T>
+  RAJA_INLINE bool operator()(T const& x) const
+  {
+    return !pred(x);
+  }
+};
+
+/*!
+ * Search [i0, i1) of a range of length n for an element satisfying pred,
+ * lowering found to its position. The chunk is skipped when it cannot
+ * change the answer: when found is already at most i0 for a search for the
+ * First match, and when any match has been found otherwise.
+ */
+template <bool First, typename Iter, typename Size, typename Predicate>
+RAJA_INLINE void search_chunk(Iter begin,
+                              Size i0,
+                              Size i1,
+                              Size n,
+                              Predicate const& pred,
+                              std::atomic<Size>& found)
+{
+  const Size f = found.load(std::memory_order_relaxed);
+  if (First ? f <= i0 : f != n) {
+    return;
+  }
+  for (Size i = i0; i < i1; ++i) {
+    if (pred(*(begin + i))) {
+      Size cur = found.load(std::memory_order_relaxed);
+      while (i < cur
+             && !found.compare_exchange_weak(cur,
+                                             i,
+                                             std::memory_order_relaxed)) {
+      }
+      return;
+    }
+  }
+}
+
+}  // namespace detail
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
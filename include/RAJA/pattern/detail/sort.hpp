@@ -0,0 +1,684 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Backend-independent building blocks for the RAJA sort and bucket
+ *          patterns.
+ *
+ *          The algorithms here are written in terms of a block runner that
+ *          each backend provides:
+ *
+ *            struct Runner {
+ *              // number of blocks to split n elements into
+ *              template <typename Size> int num_blocks(Size n) const;
+ *              // call body(b) for every b in [0, nb), possibly concurrently
+ *              template <typename Body> void operator()(int nb, Body&&) const;
+ *            };
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_detail_sort_HPP
+#define RAJA_pattern_detail_sort_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "camp/helpers.hpp"
+
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/policy/loop/policy.hpp"
+#include "RAJA/policy/loop/scan.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+template <typename Iter>
+using sort_key = camp::decay<decltype(*camp::val<Iter>())>;
+
+//! first index of the b-th of nb nearly equal blocks of [0, n)
+template <typename Size>
+RAJA_INLINE Size block_begin(Size n, int nb, int b)
+{
+  return (n / nb) * b + std::min<Size>(n % nb, b);
+}
+
+///
+/// Raw bit representation of arithmetic keys, and an order-preserving
+/// mapping of those bits to unsigned integers, so that an LSD radix sort on
+/// the mapped bits sorts the keys.
+///
+template <typename K, typename Enable = void>
+struct radix_traits;
+
+template <typename K>
+struct radix_traits<K,
+                    typename std::enable_if<std::is_integral<K>::value>::type> {
+  using bits_type = typename std::make_unsigned<K>::type;
+
+  static constexpr bits_type sign_bit =
+      std::is_signed<K>::value ? bits_type(bits_type(1) << (sizeof(K) * 8 - 1))
+                               : bits_type(0);
+
+  static RAJA_INLINE bits_type to_bits(K key)
+  {
+    return static_cast<bits_type>(key);
+  }
+
+  static RAJA_INLINE K from_bits(bits_type bits)
+  {
+    return static_cast<K>(bits);
+  }
+
+  static RAJA_INLINE bits_type order(bits_type bits)
+  {
+    return bits_type(bits ^ sign_bit);
+  }
+};
+
+template <typename K>
+struct radix_traits<
+    K,
+    typename std::enable_if<std::is_floating_point<K>::value>::type> {
+  using bits_type = typename std::conditional<sizeof(K) == 4,
+                                              std::uint32_t,
+                                              std::uint64_t>::type;
+
+  static constexpr bits_type sign_bit = bits_type(1) << (sizeof(K) * 8 - 1);
+
+  static RAJA_INLINE bits_type to_bits(K key)
+  {
+    bits_type bits;
+    std::memcpy(&bits, &key, sizeof(K));
+    return bits;
+  }
+
+  static RAJA_INLINE K from_bits(bits_type bits)
+  {
+    K key;
+    std::memcpy(&key, &bits, sizeof(K));
+    return key;
+  }
+
+  // negative values have all bits flipped, positive values only the sign;
+  // -0.0 is mapped like +0.0 since the two compare equal
+  static RAJA_INLINE bits_type order(bits_type bits)
+  {
+    if (bits == sign_bit) {
+      bits = 0;
+    }
+    return (bits & sign_bit) ? bits_type(~bits) : bits_type(bits ^ sign_bit);
+  }
+};
+
+/*!
+ * True if keys of type K ordered by Compare can be radix sorted, i.e. K is
+ * an arithmetic type and Compare is operators::less or operators::greater.
+ */
+template <typename K, typename Compare>
+struct is_radix_sortable : std::false_type {
+};
+
+template <typename K>
+struct is_radix_sortable<K, operators::less<K>>
+    : std::integral_constant<bool,
+                             std::is_arithmetic<K>::value
+                                 && !std::is_same<K, bool>::value
+                                 && (std::is_integral<K>::value
+                                     || sizeof(K) == 4 || sizeof(K) == 8)> {
+};
+
+template <typename K>
+struct is_radix_sortable<K, operators::greater<K>>
+    : is_radix_sortable<K, operators::less<K>> {
+};
+
+template <typename Compare>
+struct is_descending : std::false_type {
+};
+
+template <typename K>
+struct is_descending<operators::greater<K>> : std::true_type {
+};
+
+///
+/// Ping-pong storage for the values moved along with the keys of a radix
+/// sort, or nothing when sorting keys only.
+///
+template <typename ValIter>
+struct radix_values {
+  using value_type = sort_key<ValIter>;
+
+  ValIter vals;
+  std::unique_ptr<value_type[]> buf[2];
+
+  template <typename Size>
+  radix_values(ValIter vals_, Size n)
+      : vals{vals_}, buf{std::unique_ptr<value_type[]>(new value_type[n]),
+                         std::unique_ptr<value_type[]>(new value_type[n])}
+  {
+  }
+
+  template <typename Size>
+  RAJA_INLINE void load(Size i)
+  {
+    buf[0][i] = *(vals + i);
+  }
+
+  template <typename Size>
+  RAJA_INLINE void move(int src, Size from, Size to)
+  {
+    buf[1 - src][to] = buf[src][from];
+  }
+
+  template <typename Size>
+  RAJA_INLINE void store(int src, Size i)
+  {
+    *(vals + i) = buf[src][i];
+  }
+};
+
+template <>
+struct radix_values<std::nullptr_t> {
+  template <typename Size>
+  radix_values(std::nullptr_t, Size)
+  {
+  }
+
+  template <typename Size>
+  RAJA_INLINE void load(Size)
+  {
+  }
+
+  template <typename Size>
+  RAJA_INLINE void move(int, Size, Size)
+  {
+  }
+
+  template <typename Size>
+  RAJA_INLINE void store(int, Size)
+  {
+  }
+};
+
+//! block runner that runs a single block on the calling thread
+struct serial_sort_runner {
+  template <typename Size>
+  int num_blocks(Size) const
+  {
+    return 1;
+  }
+
+  template <typename Body>
+  void operator()(int nb, Body&& body) const
+  {
+    for (int b = 0; b < nb; ++b) {
+      body(b);
+    }
+  }
+};
+
+/*!
+ * Stable LSD radix sort of n keys, moving the values along with them when
+ * vals is not nullptr.
+ *
+ * Each pass over an 8-bit digit histograms the digits of every block, turns
+ * the digit-major table of block histograms into scatter offsets with an
+ * exclusive scan, and scatters each block in order. Passes where every key
+ * has the same digit are skipped.
+ */
+template <bool Descending,
+          typename Runner,
+          typename KeyIter,
+          typename ValIter,
+          typename Size>
+void radix_sort(Runner const& run, KeyIter keys, ValIter vals, Size n)
+{
+  using K = sort_key<KeyIter>;
+  using traits = radix_traits<K>;
+  using U = typename traits::bits_type;
+
+  constexpr int radix_bits = 8;
+  constexpr int radix = 1 << radix_bits;
+  constexpr int passes = sizeof(U) * 8 / radix_bits;
+
+  // keys are moved as their raw bits, and only mapped to ordered bits to
+  // pick out a digit, so keys that compare equal are never told apart
+  auto digit = [](U bits, int shift) {
+    const U ordered = traits::order(bits);
+    return static_cast<int>(((Descending ? U(~ordered) : ordered) >> shift)
+                            & (radix - 1));
+  };
+
+  const int nb = run.num_blocks(n);
+
+  std::unique_ptr<U[]> kbuf[2] = {std::unique_ptr<U[]>(new U[n]),
+                                  std::unique_ptr<U[]>(new U[n])};
+  radix_values<ValIter> vbuf(vals, n);
+  std::vector<Size> counts(static_cast<size_t>(radix) * nb);
+
+  run(nb, [&](int b) {
+    const Size i1 = block_begin(n, nb, b + 1);
+    for (Size i = block_begin(n, nb, b); i < i1; ++i) {
+      kbuf[0][i] = traits::to_bits(*(keys + i));
+      vbuf.load(i);
+    }
+  });
+
+  int src = 0;
+  for (int pass = 0; pass < passes; ++pass) {
+    const int shift = pass * radix_bits;
+    U const* const skeys = kbuf[src].get();
+    U* const dkeys = kbuf[1 - src].get();
+
+    run(nb, [&](int b) {
+      Size* const cnt = counts.data();
+      for (int d = 0; d < radix; ++d) {
+        cnt[d * nb + b] = 0;
+      }
+      const Size i1 = block_begin(n, nb, b + 1);
+      for (Size i = block_begin(n, nb, b); i < i1; ++i) {
+        ++cnt[digit(skeys[i], shift) * nb + b];
+      }
+    });
+
+    const int first_digit = digit(skeys[0], shift);
+    Size first_count = 0;
+    for (int b = 0; b < nb; ++b) {
+      first_count += counts[first_digit * nb + b];
+    }
+    if (first_count == n) {
+      continue;
+    }
+
+    impl::scan::exclusive_inplace(::RAJA::loop_exec{},
+                                  counts.data(),
+                                  counts.data() + counts.size(),
+                                  operators::plus<Size>{},
+                                  Size(0));
+
+    run(nb, [&](int b) {
+      Size offset[radix];
+      for (int d = 0; d < radix; ++d) {
+        offset[d] = counts[d * nb + b];
+      }
+      const Size i1 = block_begin(n, nb, b + 1);
+      for (Size i = block_begin(n, nb, b); i < i1; ++i) {
+        const Size to = offset[digit(skeys[i], shift)]++;
+        dkeys[to] = skeys[i];
+        vbuf.move(src, i, to);
+      }
+    });
+
+    src = 1 - src;
+  }
+
+  run(nb, [&](int b) {
+    const Size i1 = block_begin(n, nb, b + 1);
+    for (Size i = block_begin(n, nb, b); i < i1; ++i) {
+      *(keys + i) = traits::from_bits(kbuf[src][i]);
+      vbuf.store(src, i);
+    }
+  });
+}
+
+/*!
+ * Number of elements of a that precede the k-th element of the stable
+ * merge of sorted ranges a (length m) and b (length l), found by binary
+ * search along the merge path.
+ */
+template <typename IterA, typename IterB, typename Size, typename Compare>
+RAJA_INLINE Size merge_path_split(Size k,
+                                  IterA a,
+                                  Size m,
+                                  IterB b,
+                                  Size l,
+                                  Compare comp)
+{
+  Size lo = k > l ? k - l : Size(0);
+  Size hi = k < m ? k : m;
+  while (lo < hi) {
+    const Size i = lo + (hi - lo) / 2;
+    const Size j = k - i;
+    // a[i] precedes b[j-1] in a stable merge, so more of a is needed
+    if (j > 0 && !comp(*(b + (j - 1)), *(a + i))) {
+      lo = i + 1;
+    } else {
+      hi = i;
+    }
+  }
+  return lo;
+}
+
+/*!
+ * Merge neighboring pairs of the sorted runs of src delimited by bounds
+ * into dst. The output is split into nb equal parts, each of which finds
+ * its portion of every run pair it overlaps with merge_path_split, so the
+ * work stays balanced even when only one pair is left.
+ */
+template <typename Runner,
+          typename SrcIter,
+          typename DstIter,
+          typename Size,
+          typename Compare>
+void merge_runs(Runner const& run,
+                int nb,
+                SrcIter src,
+                DstIter dst,
+                std::vector<Size> const& bounds,
+                Size n,
+                Compare comp)
+{
+  const int runs = static_cast<int>(bounds.size()) - 1;
+
+  run(nb, [&](int p) {
+    const Size k0 = block_begin(n, nb, p);
+    const Size k1 = block_begin(n, nb, p + 1);
+
+    for (int r = 0; r < runs; r += 2) {
+      const Size lo = bounds[r];
+      const Size mid = bounds[r + 1];
+      const Size hi = bounds[std::min(r + 2, runs)];
+      if (hi <= k0 || lo >= k1) {
+        continue;
+      }
+      const Size s = std::max(k0, lo) - lo;
+      const Size e = std::min(k1, hi) - lo;
+
+      if (r + 1 == runs) {
+        std::copy(src + lo + s, src + lo + e, dst + lo + s);
+        continue;
+      }
+
+      const Size m = mid - lo;
+      const Size l = hi - mid;
+      const Size a0 = merge_path_split(s, src + lo, m, src + mid, l, comp);
+      const Size a1 = merge_path_split(e, src + lo, m, src + mid, l, comp);
+      std::merge(src + lo + a0,
+                 src + lo + a1,
+                 src + mid + (s - a0),
+                 src + mid + (e - a1),
+                 dst + lo + s,
+                 comp);
+    }
+  });
+}
+
+/*!
+ * Parallel merge sort: sort nb blocks independently, then merge pairs of
+ * runs until one is left, ping-ponging through a temporary buffer.
+ */
+template <bool Stable,
+          typename Runner,
+          typename Iter,
+          typename Size,
+          typename Compare>
+void merge_sort(Runner const& run, Iter begin, Size n, Compare comp)
+{
+  using T = sort_key<Iter>;
+
+  const int nb = run.num_blocks(n);
+
+  std::vector<Size> bounds(nb + 1);
+  for (int b = 0; b <= nb; ++b) {
+    bounds[b] = block_begin(n, nb, b);
+  }
+
+  run(nb, [&](int b) {
+    if (Stable) {
+      std::stable_sort(begin + bounds[b], begin + bounds[b + 1], comp);
+    } else {
+      std::sort(begin + bounds[b], begin + bounds[b + 1], comp);
+    }
+  });
+
+  if (nb == 1) {
+    return;
+  }
+
+  std::unique_ptr<T[]> tmp(new T[n]);
+  bool in_tmp = false;
+
+  while (bounds.size() > 2) {
+    if (in_tmp) {
+      merge_runs(run, nb, tmp.get(), begin, bounds, n, comp);
+    } else {
+      merge_runs(run, nb, begin, tmp.get(), bounds, n, comp);
+    }
+    in_tmp = !in_tmp;
+
+    std::vector<Size> merged;
+    for (size_t r = 0; r < bounds.size(); r += 2) {
+      merged.push_back(bounds[r]);
+    }
+    if (merged.back() != n) {
+      merged.push_back(n);
+    }
+    bounds.swap(merged);
+  }
+
+  if (in_tmp) {
+    T* const t = tmp.get();
+    run(nb, [&](int b) {
+      std::copy(t + block_begin(n, nb, b),
+                t + block_begin(n, nb, b + 1),
+                begin + block_begin(n, nb, b));
+    });
+  }
+}
+
+/*!
+ * Comparator on (key, value) pairs that only looks at the keys.
+ */
+template <typename Compare>
+struct pair_first_compare {
+  Compare comp;
+
+  template <typename Pair>
+  RAJA_INLINE bool operator()(Pair const& lhs, Pair const& rhs) const
+  {
+    return comp(lhs.first, rhs.first);
+  }
+};
+
+/*!
+ * Merge sort of (key, value) pairs for comparators that cannot be radix
+ * sorted: keys and values are zipped into one buffer, sorted, and unzipped.
+ */
+template <bool Stable,
+          typename Runner,
+          typename KeyIter,
+          typename ValIter,
+          typename Size,
+          typename Compare>
+void merge_sort_pairs(Runner const& run,
+                      KeyIter keys,
+                      ValIter vals,
+                      Size n,
+                      Compare comp)
+{
+  using K = sort_key<KeyIter>;
+  using V = sort_key<ValIter>;
+  using P = std::pair<K, V>;
+
+  const int nb = run.num_blocks(n);
+  std::unique_ptr<P[]> zipped(new P[n]);
+  P* const z = zipped.get();
+
+  run(nb, [&](int b) {
+    const Size i1 = block_begin(n, nb, b + 1);
+    for (Size i = block_begin(n, nb, b); i < i1; ++i) {
+      z[i].first = *(keys + i);
+      z[i].second = *(vals + i);
+    }
+  });
+
+  merge_sort<Stable>(run, z, n, pair_first_compare<Compare>{comp});
+
+  run(nb, [&](int b) {
+    const Size i1 = block_begin(n, nb, b + 1);
+    for (Size i = block_begin(n, nb, b); i < i1; ++i) {
+      *(keys + i) = z[i].first;
+      *(vals + i) = z[i].second;
+    }
+  });
+}
+
+/*!
+ * Sort dispatch shared by the backends: radix sort when the keys and the
+ * comparator allow it (radix sort is stable, so it serves both sort and
+ * stable_sort), merge sort otherwise.
+ */
+template <bool Stable, typename Runner, typename Iter, typename Compare>
+RAJA_INLINE concepts::enable_if<
+    is_radix_sortable<sort_key<Iter>, Compare>>
+sort_with(Runner const& run, Iter begin, Iter end, Compare)
+{
+  radix_sort<is_descending<Compare>::value>(run, begin, nullptr, end - begin);
+}
+
+template <bool Stable, typename Runner, typename Iter, typename Compare>
+RAJA_INLINE concepts::enable_if<concepts::negate<
+    is_radix_sortable<sort_key<Iter>, Compare>>>
+sort_with(Runner const& run, Iter begin, Iter end, Compare comp)
+{
+  merge_sort<Stable>(run, begin, end - begin, comp);
+}
+
+template <bool Stable,
+          typename Runner,
+          typename KeyIter,
+          typename ValIter,
+          typename Compare>
+RAJA_INLINE concepts::enable_if<
+    is_radix_sortable<sort_key<KeyIter>,
+                      Compare>>
+sort_pairs_with(Runner const& run,
+                KeyIter keys_begin,
+                KeyIter keys_end,
+                ValIter vals_begin,
+                Compare)
+{
+  radix_sort<is_descending<Compare>::value>(run,
+                                            keys_begin,
+                                            vals_begin,
+                                            keys_end - keys_begin);
+}
+
+template <bool Stable,
+          typename Runner,
+          typename KeyIter,
+          typename ValIter,
+          typename Compare>
+RAJA_INLINE concepts::enable_if<concepts::negate<
+    is_radix_sortable<sort_key<KeyIter>,
+                      Compare>>>
+sort_pairs_with(Runner const& run,
+                KeyIter keys_begin,
+                KeyIter keys_end,
+                ValIter vals_begin,
+                Compare comp)
+{
+  merge_sort_pairs<Stable>(
+      run, keys_begin, vals_begin, keys_end - keys_begin, comp);
+}
+
+//! number of elements and buckets of a bucket pattern over KeyIter
+template <typename KeyIter>
+using bucket_size = typename std::iterator_traits<KeyIter>::difference_type;
+
+/*!
+ * Counting sort of the indices [0, n) by their keys, which must lie in
+ * [0, nbuckets). perm receives the indices ordered by key, keeping their
+ * order within a bucket, and offsets[k] the position in perm of the first
+ * index with key k, offsets[nbuckets] being n.
+ *
+ * Each block counts its keys into its own row of a table, so no counts are
+ * shared between threads. The table is then scanned bucket-major to give
+ * every block its starting position within every bucket, and each block
+ * scatters its indices in order. Rows start on their own cache line so the
+ * blocks do not write to lines holding the counts of their neighbours.
+ */
+template <typename Runner,
+          typename KeyIter,
+          typename Size,
+          typename OffsetIter,
+          typename PermIter>
+void bucket_with(Runner const& run,
+                 KeyIter keys,
+                 Size n,
+                 Size nbuckets,
+                 OffsetIter offsets,
+                 PermIter perm)
+{
+  constexpr std::size_t line_bytes = 64;
+  constexpr std::size_t line =
+      sizeof(Size) < line_bytes ? line_bytes / sizeof(Size) : 1;
+  const std::size_t stride =
+      (static_cast<std::size_t>(nbuckets) + line - 1) / line * line;
+
+  const int nb = run.num_blocks(n);
+  std::vector<Size> table(static_cast<std::size_t>(nb) * stride + line + 1,
+                          Size(0));
+  void* base = table.data();
+  std::size_t space = table.size() * sizeof(Size);
+  Size* const counts = static_cast<Size*>(
+      std::align(line_bytes, nb * stride * sizeof(Size), base, space));
+
+  run(nb, [&](int b) {
+    Size* const row = counts + b * stride;
+    const Size i1 = block_begin(n, nb, b + 1);
+    for (Size i = block_begin(n, nb, b); i < i1; ++i) {
+      ++row[static_cast<Size>(*(keys + i))];
+    }
+  });
+
+  Size pos = 0;
+  for (Size k = 0; k < nbuckets; ++k) {
+    *(offsets + k) = pos;
+    for (int b = 0; b < nb; ++b) {
+      Size& count = counts[b * stride + k];
+      const Size c = count;
+      count = pos;
+      pos += c;
+    }
+  }
+  *(offsets + nbuckets) = pos;
+
+  run(nb, [&](int b) {
+    Size* const row = counts + b * stride;
+    const Size i1 = block_begin(n, nb, b + 1);
+    for (Size i = block_begin(n, nb, b); i < i1; ++i) {
+      *(perm + row[static_cast<Size>(*(keys + i))]++) = i;
+    }
+  });
+}
+
+}  // namespace detail
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -76,6 +76,7 @@
 
 #include "RAJA/pattern/detail/forall.hpp"
 #include "RAJA/pattern/detail/privatizer.hpp"
+#include "RAJA/pattern/params/reducer.hpp"
 
 #include "RAJA/internal/get_platform.hpp"
 #include "RAJA/util/plugins.hpp"
@@ -142,6 +143,29 @@ struct CallForallIcount {
 
   const int start;
 };
+
+/// Split (params..., body) and hand the parameter pack to the backend
+template <typename ExecutionPolicy,
+          typename Container,
+          typename ArgTuple,
+          camp::idx_t... Is>
+RAJA_INLINE void forall_param(ExecutionPolicy&& p,
+                              Container&& c,
+                              ArgTuple&& args,
+                              camp::idx_seq<Is...>)
+{
+  using RAJA::internal::trigger_updates_before;
+  auto body = trigger_updates_before(camp::get<sizeof...(Is)>(args));
+
+  auto params = make_param_pack(camp::get<Is>(args)...);
+
+  forall_impl(std::forward<ExecutionPolicy>(p),
+              std::forward<Container>(c),
+              body,
+              params);
+
+  params.resolve();
+}
 }  // namespace detail
 
 /*!
@@ -177,6 +201,27 @@ forall(ExecutionPolicy&& p, Container&& c, LoopBody&& loop_body)
               body);
 }
 
+/*!
+ ******************************************************************************
+ *
+ * \brief Generic dispatch over containers with a value-based policy and
+ *        kernel parameters, e.g., reduce_sum(&x), preceding the loop body
+ *
+ ******************************************************************************
+ */
+template <typename ExecutionPolicy, typename Container, typename... Args>
+RAJA_INLINE concepts::enable_if<
+    concepts::negate<type_traits::is_indexset_policy<ExecutionPolicy>>,
+    type_traits::is_range<Container>,
+    type_traits::is_forall_param_list<Args...>>
+forall(ExecutionPolicy&& p, Container&& c, Args&&... args)
+{
+  detail::forall_param(std::forward<ExecutionPolicy>(p),
+                       std::forward<Container>(c),
+                       camp::forward_as_tuple(std::forward<Args>(args)...),
+                       camp::make_idx_seq_t<sizeof...(Args) - 1>{});
+}
+
 /*!
  ******************************************************************************
  *
@@ -371,6 +416,40 @@ forall(ExecutionPolicy&& p, Container&& c, LoopBody&& loop_body)
   util::callPostLaunchPlugins(context);
 }
 
+/*!
+ ******************************************************************************
+ *
+ * \brief Generic dispatch over containers with a value-based policy and
+ *        kernel parameters
+ *
+ *         The loop body receives a reference to a private value for each
+ *         kernel parameter after the loop index, e.g.,
+ *
+ *         forall(exec_policy{}, segment, reduce_sum(&sum),
+ *                [=](Index_type i, Real_type& s) { s += x[i]; });
+ *
+ ******************************************************************************
+ */
+template <typename ExecutionPolicy, typename Container, typename... Args>
+RAJA_INLINE concepts::enable_if<
+    concepts::negate<type_traits::is_indexset_policy<ExecutionPolicy>>,
+    type_traits::is_range<Container>,
+    type_traits::is_forall_param_list<Args...>>
+forall(ExecutionPolicy&& p, Container&& c, Args&&... args)
+{
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container does not model RandomAccessIterator");
+
+  util::PluginContext context{util::make_context<ExecutionPolicy>()};
+  util::callPreLaunchPlugins(context);
+
+  wrap::forall(std::forward<ExecutionPolicy>(p),
+               std::forward<Container>(c),
+               std::forward<Args>(args)...);
+
+  util::callPostLaunchPlugins(context);
+}
+
 //
 //////////////////////////////////////////////////////////////////////
 //
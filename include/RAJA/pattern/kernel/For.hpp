@@ -23,6 +23,7 @@
 #include <iostream>
 #include <type_traits>
 
+#include "RAJA/pattern/kernel/Reduce.hpp"
 #include "RAJA/pattern/kernel/internal.hpp"
 
 namespace RAJA
@@ -91,10 +92,22 @@ struct StatementExecutor<
   template <typename Data>
   static RAJA_INLINE void exec(Data &&data)
   {
+    check_team_reduce_nesting<ExecPolicy, EnclosedStmts...>{};
 
     // Set the argument type for this loop
     using NewTypes = setSegmentTypeFromData<Types, ArgumentId, Data>;
 
+    exec_loop<NewTypes>(
+        data,
+        std::integral_constant<bool,
+                               (count_loop_reduce<EnclosedStmts...>::value >
+                                0)>{});
+  }
+
+private:
+  template <typename NewTypes, typename Data>
+  static RAJA_INLINE void exec_loop(Data &data, std::false_type)
+  {
     // Create a wrapper, just in case forall_impl needs to thread_privatize
     ForWrapper<ArgumentId, Data, NewTypes, EnclosedStmts...> for_wrapper(data);
 
@@ -103,6 +116,14 @@ struct StatementExecutor<
 
     forall_impl(ExecPolicy{}, TypedRangeSegment<len_t>(0, len), for_wrapper);
   }
+
+  // the body ends with a Reduce combining the values of all iterations
+  template <typename NewTypes, typename Data>
+  static RAJA_INLINE void exec_loop(Data &data, std::true_type)
+  {
+    LoopReduceForExecutor<ArgumentId, ExecPolicy, NewTypes, EnclosedStmts...>::
+        exec(data);
+  }
 };
 
 
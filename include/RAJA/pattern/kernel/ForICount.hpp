@@ -23,6 +23,7 @@
 #include <iostream>
 #include <type_traits>
 
+#include "RAJA/pattern/kernel/Reduce.hpp"
 #include "RAJA/pattern/kernel/internal.hpp"
 #include "RAJA/pattern/kernel/Param.hpp"
 
@@ -99,6 +100,8 @@ struct StatementExecutor<
   template <typename Data>
   static RAJA_INLINE void exec(Data &&data)
   {
+    check_team_reduce_nesting<ExecPolicy, EnclosedStmts...>{};
+
 
     // Set the argument type for this loop
     using NewTypes = setSegmentTypeFromData<Types, ArgumentId, Data>;
@@ -25,6 +25,10 @@
 
 #include "RAJA/pattern/kernel/internal.hpp"
 
+#include "RAJA/policy/PolicyBase.hpp"
+
+#include "RAJA/util/mutex.hpp"
+
 namespace RAJA
 {
 
@@ -37,6 +41,12 @@ namespace statement
  * This reduces a value down to a "root" thread, and then only executes
  * the enclosed statements on the thread which contains the reduced value.
  *
+ * With a loop reduce policy (seq_reduce, tbb_reduce) the Reduce is the last
+ * statement of the body of a statement::For, and the values are those left
+ * in the Param by each iteration of that loop. With a team reduce policy
+ * (omp_reduce, omp_reduce_ordered, cuda_block_reduce) the values are those
+ * of the threads of the team, which must all reach the Reduce.
+ *
  */
 template <typename ReducePolicy,
           template <typename...> class ReduceOperator,
@@ -54,6 +64,333 @@ struct Reduce : public internal::Statement<camp::nil, EnclosedStmts...> {
 
 }  // end namespace statement
 
+namespace internal
+{
+
+/*!
+ * Reduce policies whose Reduce statement combines the values of the Param
+ * over the iterations of the statement::For loop it ends, specialized by the
+ * backends providing them.
+ */
+template <typename ReducePolicy>
+struct is_loop_reduce_policy : std::false_type {
+};
+
+/*!
+ * Reduce policies whose Reduce statement combines the values of the Param
+ * across a team of threads that must all reach it, so it cannot be nested in
+ * a loop that is shared out over that team.
+ */
+template <typename ReducePolicy>
+struct is_team_reduce_policy : std::false_type {
+};
+
+template <typename Stmt>
+struct is_loop_reduce_statement : std::false_type {
+};
+
+template <typename ReducePolicy,
+          template <typename...> class ReduceOperator,
+          typename ParamId,
+          typename... EnclosedStmts>
+struct is_loop_reduce_statement<
+    statement::Reduce<ReducePolicy, ReduceOperator, ParamId, EnclosedStmts...>>
+    : is_loop_reduce_policy<ReducePolicy> {
+};
+
+template <typename Stmt>
+struct is_team_reduce_statement : std::false_type {
+};
+
+template <typename ReducePolicy,
+          template <typename...> class ReduceOperator,
+          typename ParamId,
+          typename... EnclosedStmts>
+struct is_team_reduce_statement<
+    statement::Reduce<ReducePolicy, ReduceOperator, ParamId, EnclosedStmts...>>
+    : is_team_reduce_policy<ReducePolicy> {
+};
+
+//! number of loop Reduce statements in EnclosedStmts
+template <typename... EnclosedStmts>
+struct count_loop_reduce : std::integral_constant<int, 0> {
+};
+
+template <typename Stmt, typename... EnclosedStmts>
+struct count_loop_reduce<Stmt, EnclosedStmts...>
+    : std::integral_constant<int,
+                             is_loop_reduce_statement<Stmt>::value +
+                                 count_loop_reduce<EnclosedStmts...>::value> {
+};
+
+//! last statement of EnclosedStmts, void if there is none
+template <typename... EnclosedStmts>
+struct last_statement {
+  using type = void;
+};
+
+template <typename Stmt>
+struct last_statement<Stmt> {
+  using type = Stmt;
+};
+
+template <typename Stmt, typename... EnclosedStmts>
+struct last_statement<Stmt, EnclosedStmts...>
+    : last_statement<EnclosedStmts...> {
+};
+
+template <typename Stmt>
+class has_enclosed_statements
+{
+private:
+  template <typename C>
+  static auto Test(void*)
+      -> decltype(camp::val<typename C::enclosed_statements_t>(),
+                  camp::true_type{});
+
+  template <typename>
+  static camp::false_type Test(...);
+
+public:
+  static bool const value = decltype(Test<Stmt>(0))::value;
+};
+
+template <typename StmtList>
+struct list_contains_team_reduce;
+
+//! true if Stmt is, or encloses at any depth, a team Reduce statement
+template <typename Stmt, bool = has_enclosed_statements<Stmt>::value>
+struct contains_team_reduce : is_team_reduce_statement<Stmt> {
+};
+
+template <typename Stmt>
+struct contains_team_reduce<Stmt, true>
+    : std::integral_constant<
+          bool,
+          is_team_reduce_statement<Stmt>::value ||
+              list_contains_team_reduce<
+                  typename Stmt::enclosed_statements_t>::value> {
+};
+
+template <>
+struct list_contains_team_reduce<camp::list<>> : std::false_type {
+};
+
+template <typename Stmt, typename... EnclosedStmts>
+struct list_contains_team_reduce<camp::list<Stmt, EnclosedStmts...>>
+    : std::integral_constant<
+          bool,
+          contains_team_reduce<Stmt>::value ||
+              list_contains_team_reduce<camp::list<EnclosedStmts...>>::value> {
+};
+
+/*!
+ * Rejects team Reduce statements nested in a loop with an OpenMP policy.
+ * Each thread executes only its share of such a loop, so the threads do not
+ * reach the Reduce together, and the single/barrier constructs of the team
+ * reduction would be nested in an OpenMP worksharing region.
+ */
+template <typename ExecPolicy, typename... EnclosedStmts>
+struct check_team_reduce_nesting {
+  static_assert(
+      !(type_traits::is_openmp_policy<ExecPolicy>::value &&
+        list_contains_team_reduce<camp::list<EnclosedStmts...>>::value),
+      "omp_reduce and omp_reduce_ordered must be reached by every thread of "
+      "a statement::Region and cannot be nested in a loop with an OpenMP "
+      "policy; place the Reduce after the loop, inside the Region");
+};
+
+//! pieces of a loop Reduce statement
+template <typename ReduceStmt>
+struct loop_reduce_traits;
+
+template <typename ReducePolicy,
+          template <typename...> class ReduceOperator,
+          typename ParamId,
+          typename... EnclosedStmts>
+struct loop_reduce_traits<
+    statement::Reduce<ReducePolicy, ReduceOperator, ParamId, EnclosedStmts...>> {
+  using param_id = ParamId;
+
+  template <typename T>
+  using reduce_operator = ReduceOperator<T>;
+
+  using enclosed_statements = camp::list<EnclosedStmts...>;
+};
+
+/*!
+ * Value of a loop reduction shared by all threads executing the loop, into
+ * which each thread combines its partial value once.
+ */
+template <typename T, typename ReduceOperator>
+struct LoopReduceTarget {
+  T value;
+  spin_mutex mutex;
+
+  explicit LoopReduceTarget(T const &init) : value(init) {}
+
+  void combine(T const &partial)
+  {
+    lock_guard<spin_mutex> lock(mutex);
+    value = ReduceOperator{}(value, partial);
+  }
+};
+
+template <typename T>
+struct LoopReducePrivatizer;
+
+/*!
+ * A RAJA::kernel forall_impl loop wrapper for a statement::For whose body
+ * ends with a loop Reduce statement. Each iteration executes the other
+ * statements of the body, folds the Param into the partial value of the
+ * wrapper and resets the Param to the identity of the operator.
+ */
+template <camp::idx_t ArgumentId,
+          typename Data,
+          typename Types,
+          typename... EnclosedStmts>
+struct LoopReduceWrapper : GenericWrapperBase {
+  using data_t = camp::decay<Data>;
+  using reduce_stmt = typename last_statement<EnclosedStmts...>::type;
+  using param_id = typename loop_reduce_traits<reduce_stmt>::param_id;
+  using reduce_value_t = camp::decay<decltype(
+      camp::val<data_t>().template get_param<param_id>())>;
+  using reduce_operator_t = typename loop_reduce_traits<
+      reduce_stmt>::template reduce_operator<reduce_value_t>;
+  using target_t = LoopReduceTarget<reduce_value_t, reduce_operator_t>;
+  using privatizer = LoopReducePrivatizer<LoopReduceWrapper>;
+
+  data_t &data;
+  reduce_value_t *partial;
+  target_t *target;
+
+  RAJA_INLINE
+  LoopReduceWrapper(data_t &d, reduce_value_t &p, target_t &t)
+      : data{d}, partial{&p}, target{&t}
+  {
+  }
+
+  template <typename InIndexType>
+  RAJA_INLINE void operator()(InIndexType i)
+  {
+    data.template assign_offset<ArgumentId>(i);
+    StatementListExecutor<0,
+                          sizeof...(EnclosedStmts) - 1,
+                          camp::list<EnclosedStmts...>,
+                          Types>::exec(data);
+    *partial = reduce_operator_t{}(*partial,
+                                   data.template get_param<param_id>());
+    data.template assign_param<param_id>(reduce_operator_t::identity());
+  }
+};
+
+/*!
+ * Thread-private copy of a LoopReduceWrapper, which combines the partial
+ * value of the thread into the shared target when it is destroyed.
+ */
+template <typename T>
+struct LoopReducePrivatizer {
+  using data_t = typename T::data_t;
+  using value_type = camp::decay<T>;
+  using reference_type = value_type &;
+  using reduce_value_t = typename T::reduce_value_t;
+  using target_t = typename T::target_t;
+
+  data_t privatized_data;
+  reduce_value_t partial;
+  target_t *target;
+  value_type privatized_wrapper;
+
+  RAJA_INLINE
+  LoopReducePrivatizer(const T &o)
+      : privatized_data{o.data},
+        partial(T::reduce_operator_t::identity()),
+        target{o.target},
+        privatized_wrapper(privatized_data, partial, *target)
+  {
+  }
+
+  RAJA_INLINE
+  LoopReducePrivatizer(LoopReducePrivatizer &&o)
+      : privatized_data{o.privatized_data},
+        partial(o.partial),
+        target{o.target},
+        privatized_wrapper(privatized_data, partial, *target)
+  {
+    o.target = nullptr;
+  }
+
+  LoopReducePrivatizer(LoopReducePrivatizer const &) = delete;
+  LoopReducePrivatizer &operator=(LoopReducePrivatizer const &) = delete;
+  LoopReducePrivatizer &operator=(LoopReducePrivatizer &&) = delete;
+
+  ~LoopReducePrivatizer()
+  {
+    if (target) {
+      target->combine(partial);
+    }
+  }
+
+  RAJA_INLINE
+  reference_type get_priv() { return privatized_wrapper; }
+};
+
+/*!
+ * Executes a statement::For whose body ends with a loop Reduce statement.
+ *
+ * The value of the Param before the loop starts the reduction, and every
+ * iteration starts from the identity of the operator. After the loop the
+ * Param holds the values of all iterations combined with the operator, and
+ * the statements enclosed by the Reduce are executed once.
+ */
+template <camp::idx_t ArgumentId,
+          typename ExecPolicy,
+          typename Types,
+          typename... EnclosedStmts>
+struct LoopReduceForExecutor {
+
+  static_assert(count_loop_reduce<EnclosedStmts...>::value == 1 &&
+                    is_loop_reduce_statement<typename last_statement<
+                        EnclosedStmts...>::type>::value,
+                "a seq_reduce or tbb_reduce Reduce must be the last "
+                "statement of the body of a statement::For");
+
+  static_assert(!type_traits::is_openmp_policy<ExecPolicy>::value,
+                "seq_reduce and tbb_reduce combine over sequential and TBB "
+                "loops; use omp_reduce inside a statement::Region with "
+                "OpenMP loops");
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &&data)
+  {
+    using wrapper_t = LoopReduceWrapper<ArgumentId, Data, Types, EnclosedStmts...>;
+    using param_id = typename wrapper_t::param_id;
+    using reduce_value_t = typename wrapper_t::reduce_value_t;
+    using reduce_operator_t = typename wrapper_t::reduce_operator_t;
+
+    typename wrapper_t::target_t target(data.template get_param<param_id>());
+    data.template assign_param<param_id>(reduce_operator_t::identity());
+
+    // partial value of the iterations executed without privatization
+    reduce_value_t partial = reduce_operator_t::identity();
+    wrapper_t wrapper(data, partial, target);
+
+    auto len = segment_length<ArgumentId>(data);
+    using len_t = decltype(len);
+
+    forall_impl(ExecPolicy{}, TypedRangeSegment<len_t>(0, len), wrapper);
+
+    target.combine(partial);
+    data.template assign_param<param_id>(target.value);
+
+    execute_statement_list<
+        typename loop_reduce_traits<
+            typename wrapper_t::reduce_stmt>::enclosed_statements,
+        Types>(data);
+  }
+};
+
+}  // namespace internal
 
 }  // end namespace RAJA
 
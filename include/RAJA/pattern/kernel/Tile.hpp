@@ -27,6 +27,7 @@
 #include "camp/concepts.hpp"
 #include "camp/tuple.hpp"
 
+#include "RAJA/pattern/kernel/Reduce.hpp"
 #include "RAJA/pattern/kernel/internal.hpp"
 #include "RAJA/util/macros.hpp"
 #include "RAJA/util/types.hpp"
@@ -212,6 +213,8 @@ struct StatementExecutor<
   template <typename Data>
   static RAJA_INLINE void exec(Data &data)
   {
+    check_team_reduce_nesting<EPol, EnclosedStmts...>{};
+
     // Get the segment we are going to tile
     auto const &segment = camp::get<ArgumentId>(data.segment_tuple);
 
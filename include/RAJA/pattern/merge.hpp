@@ -0,0 +1,360 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA merge and set operation declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_merge_HPP
+#define RAJA_merge_HPP
+
+#include "RAJA/config.hpp"
+
+#include <iterator>
+#include <type_traits>
+
+#include "camp/concepts.hpp"
+#include "camp/helpers.hpp"
+
+#include "RAJA/pattern/detail/merge.hpp"
+#include "RAJA/pattern/detail/sort.hpp"
+#include "RAJA/policy/PolicyBase.hpp"
+#include "RAJA/util/Operators.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+template <typename Container>
+using ContainerMergeSize = MergeSize<camp::iterator_from<Container>>;
+
+}  // end namespace detail
+
+/*!
+******************************************************************************
+*
+* \brief  merge execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] a_begin Pointer or Random-Access Iterator to start of first
+*sorted range
+* \param[in] a_end Pointer or Random-Access Iterator to end of first sorted
+*range (exclusive)
+* \param[in] b_begin Pointer or Random-Access Iterator to start of second
+*sorted range
+* \param[in] b_end Pointer or Random-Access Iterator to end of second sorted
+*range (exclusive)
+* \param[out] out Pointer or Random-Access Iterator to start of output data
+*range
+* \param[in] comp comparison function both ranges are sorted by
+*
+* \return number of elements written to out, which is the total length of
+*the two ranges
+*
+* \note{The merge is stable: equivalent elements of a precede those of b, and
+*keep their relative order. The output is split evenly across threads along
+*the merge path, however the two ranges interleave.}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename IterA,
+          typename IterB,
+          typename IterOut,
+          typename Compare = operators::less<detail::sort_key<IterA>>>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value
+                            && type_traits::is_iterator<IterA>::value
+                            && type_traits::is_iterator<IterB>::value
+                            && type_traits::is_iterator<IterOut>::value,
+                        detail::MergeSize<IterA>>::type
+merge(const ExecPolicy &p,
+      IterA a_begin,
+      IterA a_end,
+      IterB b_begin,
+      IterB b_end,
+      IterOut out,
+      Compare comp = Compare{})
+{
+  using R = detail::sort_key<IterA>;
+  static_assert(type_traits::is_binary_function<Compare, bool, R, R>::value,
+                "Compare must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<IterA>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<IterB>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<IterOut>::value,
+                "Output Iterator must model RandomAccessIterator");
+  return impl::merge::merge(p, a_begin, a_end, b_begin, b_end, out, comp);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  set union execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] a_begin Pointer or Random-Access Iterator to start of first
+*sorted range
+* \param[in] a_end Pointer or Random-Access Iterator to end of first sorted
+*range (exclusive)
+* \param[in] b_begin Pointer or Random-Access Iterator to start of second
+*sorted range
+* \param[in] b_end Pointer or Random-Access Iterator to end of second sorted
+*range (exclusive)
+* \param[out] out Pointer or Random-Access Iterator to start of output data
+*range
+* \param[in] comp comparison function both ranges are sorted by
+*
+* \return number of elements written to out
+*
+* \note{As for std::set_union, an element found k times in a and l times in b
+*is written max(k, l) times. Runs of equivalent elements are never split
+*across threads.}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename IterA,
+          typename IterB,
+          typename IterOut,
+          typename Compare = operators::less<detail::sort_key<IterA>>>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value
+                            && type_traits::is_iterator<IterA>::value
+                            && type_traits::is_iterator<IterB>::value
+                            && type_traits::is_iterator<IterOut>::value,
+                        detail::MergeSize<IterA>>::type
+set_union(const ExecPolicy &p,
+          IterA a_begin,
+          IterA a_end,
+          IterB b_begin,
+          IterB b_end,
+          IterOut out,
+          Compare comp = Compare{})
+{
+  using R = detail::sort_key<IterA>;
+  static_assert(type_traits::is_binary_function<Compare, bool, R, R>::value,
+                "Compare must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<IterA>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<IterB>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<IterOut>::value,
+                "Output Iterator must model RandomAccessIterator");
+  return impl::merge::set_union(p, a_begin, a_end, b_begin, b_end, out, comp);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  set intersection execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] a_begin Pointer or Random-Access Iterator to start of first
+*sorted range
+* \param[in] a_end Pointer or Random-Access Iterator to end of first sorted
+*range (exclusive)
+* \param[in] b_begin Pointer or Random-Access Iterator to start of second
+*sorted range
+* \param[in] b_end Pointer or Random-Access Iterator to end of second sorted
+*range (exclusive)
+* \param[out] out Pointer or Random-Access Iterator to start of output data
+*range
+* \param[in] comp comparison function both ranges are sorted by
+*
+* \return number of elements written to out
+*
+* \note{As for std::set_intersection, an element found k times in a and l
+*times in b is written min(k, l) times, taken from a.}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename IterA,
+          typename IterB,
+          typename IterOut,
+          typename Compare = operators::less<detail::sort_key<IterA>>>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value
+                            && type_traits::is_iterator<IterA>::value
+                            && type_traits::is_iterator<IterB>::value
+                            && type_traits::is_iterator<IterOut>::value,
+                        detail::MergeSize<IterA>>::type
+set_intersection(const ExecPolicy &p,
+                 IterA a_begin,
+                 IterA a_end,
+                 IterB b_begin,
+                 IterB b_end,
+                 IterOut out,
+                 Compare comp = Compare{})
+{
+  using R = detail::sort_key<IterA>;
+  static_assert(type_traits::is_binary_function<Compare, bool, R, R>::value,
+                "Compare must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<IterA>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<IterB>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<IterOut>::value,
+                "Output Iterator must model RandomAccessIterator");
+  return impl::merge::set_intersection(
+      p, a_begin, a_end, b_begin, b_end, out, comp);
+}
+
+// =============================================================================
+
+/*!
+******************************************************************************
+*
+* \brief  merge execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] a first sorted Random-Access Container
+* \param[in] b second sorted Random-Access Container
+* \param[out] out Pointer or Random-Access Iterator to start of output data
+*range
+* \param[in] comp comparison function both containers are sorted by
+*
+* \return number of elements written to out
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename ContainerA,
+          typename ContainerB,
+          typename IterOut,
+          typename Compare = operators::less<
+              detail::sort_key<camp::iterator_from<ContainerA>>>>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value
+                            && type_traits::is_range<ContainerA>::value
+                            && type_traits::is_range<ContainerB>::value
+                            && type_traits::is_iterator<IterOut>::value,
+                        detail::ContainerMergeSize<ContainerA>>::type
+merge(const ExecPolicy &p,
+      const ContainerA &a,
+      const ContainerB &b,
+      IterOut out,
+      Compare comp = Compare{})
+{
+  static_assert(type_traits::is_random_access_range<ContainerA>::value,
+                "Container must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<ContainerB>::value,
+                "Container must model RandomAccessRange");
+  return ::RAJA::merge(
+      p, std::begin(a), std::end(a), std::begin(b), std::end(b), out, comp);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  set union execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] a first sorted Random-Access Container
+* \param[in] b second sorted Random-Access Container
+* \param[out] out Pointer or Random-Access Iterator to start of output data
+*range
+* \param[in] comp comparison function both containers are sorted by
+*
+* \return number of elements written to out
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename ContainerA,
+          typename ContainerB,
+          typename IterOut,
+          typename Compare = operators::less<
+              detail::sort_key<camp::iterator_from<ContainerA>>>>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value
+                            && type_traits::is_range<ContainerA>::value
+                            && type_traits::is_range<ContainerB>::value
+                            && type_traits::is_iterator<IterOut>::value,
+                        detail::ContainerMergeSize<ContainerA>>::type
+set_union(const ExecPolicy &p,
+          const ContainerA &a,
+          const ContainerB &b,
+          IterOut out,
+          Compare comp = Compare{})
+{
+  static_assert(type_traits::is_random_access_range<ContainerA>::value,
+                "Container must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<ContainerB>::value,
+                "Container must model RandomAccessRange");
+  return ::RAJA::set_union(
+      p, std::begin(a), std::end(a), std::begin(b), std::end(b), out, comp);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  set intersection execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] a first sorted Random-Access Container
+* \param[in] b second sorted Random-Access Container
+* \param[out] out Pointer or Random-Access Iterator to start of output data
+*range
+* \param[in] comp comparison function both containers are sorted by
+*
+* \return number of elements written to out
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename ContainerA,
+          typename ContainerB,
+          typename IterOut,
+          typename Compare = operators::less<
+              detail::sort_key<camp::iterator_from<ContainerA>>>>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value
+                            && type_traits::is_range<ContainerA>::value
+                            && type_traits::is_range<ContainerB>::value
+                            && type_traits::is_iterator<IterOut>::value,
+                        detail::ContainerMergeSize<ContainerA>>::type
+set_intersection(const ExecPolicy &p,
+                 const ContainerA &a,
+                 const ContainerB &b,
+                 IterOut out,
+                 Compare comp = Compare{})
+{
+  static_assert(type_traits::is_random_access_range<ContainerA>::value,
+                "Container must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<ContainerB>::value,
+                "Container must model RandomAccessRange");
+  return ::RAJA::set_intersection(
+      p, std::begin(a), std::end(a), std::begin(b), std::end(b), out, comp);
+}
+
+template <typename ExecPolicy, typename... Args>
+auto merge(Args &&... args)
+    -> decltype(::RAJA::merge(ExecPolicy{}, std::forward<Args>(args)...))
+{
+  return ::RAJA::merge(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+auto set_union(Args &&... args)
+    -> decltype(::RAJA::set_union(ExecPolicy{}, std::forward<Args>(args)...))
+{
+  return ::RAJA::set_union(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+auto set_intersection(Args &&... args)
+    -> decltype(::RAJA::set_intersection(ExecPolicy{},
+                                         std::forward<Args>(args)...))
+{
+  return ::RAJA::set_intersection(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,298 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing kernel-parameter reduction objects that
+ *          are passed to forall() ahead of the loop body.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_params_reducer_HPP
+#define RAJA_pattern_params_reducer_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Reduction target passed to forall() as a kernel parameter.
+ *
+ * Unlike the ReduceSum/ReduceMin/... objects, a ParamReducer is never
+ * captured by the loop body. Each backend keeps one private value per
+ * thread (or per task), hands a reference to it to the loop body as an
+ * extra argument, and combines the private values explicitly once the
+ * loop completes. The final value is combined with the value held in the
+ * target when the loop was launched.
+ *
+ ******************************************************************************
+ */
+template <typename Op, typename T>
+struct ParamReducer {
+  using op = Op;
+  using value_type = T;
+
+  value_type* target;
+  value_type val;
+
+  RAJA_HOST_DEVICE explicit ParamReducer(value_type* target_)
+      : target{target_}, val{op::identity()}
+  {
+  }
+
+  //! reset private value to the identity of the reduction operator
+  RAJA_HOST_DEVICE void init() { val = op::identity(); }
+
+  //! fold another private value into this one
+  RAJA_HOST_DEVICE void combine(ParamReducer const& other)
+  {
+    val = op{}(val, other.val);
+  }
+
+  //! write reduced value back to the user's target
+  RAJA_HOST_DEVICE void resolve() { *target = op{}(*target, val); }
+};
+
+template <typename T>
+struct is_param_reducer : std::false_type {
+};
+
+template <typename Op, typename T>
+struct is_param_reducer<ParamReducer<Op, T>> : std::true_type {
+};
+
+}  // namespace detail
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Sum reduction passed to forall() as a kernel parameter.
+ *
+ * Usage example:
+ *
+ * \verbatim
+
+   Real_type sum = 0.0;
+
+   forall<exec_policy>( segment, reduce_sum(&sum),
+     [=] (Index_type i, Real_type& s) {
+       s += data[i];
+   });
+
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template <typename T>
+RAJA_INLINE detail::ParamReducer<operators::plus<T>, T> reduce_sum(T* target)
+{
+  return detail::ParamReducer<operators::plus<T>, T>{target};
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Min reduction passed to forall() as a kernel parameter.
+ *
+ ******************************************************************************
+ */
+template <typename T>
+RAJA_INLINE detail::ParamReducer<operators::minimum<T>, T> reduce_min(
+    T* target)
+{
+  return detail::ParamReducer<operators::minimum<T>, T>{target};
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Max reduction passed to forall() as a kernel parameter.
+ *
+ ******************************************************************************
+ */
+template <typename T>
+RAJA_INLINE detail::ParamReducer<operators::maximum<T>, T> reduce_max(
+    T* target)
+{
+  return detail::ParamReducer<operators::maximum<T>, T>{target};
+}
+
+namespace detail
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Ordered collection of kernel parameters for a single forall().
+ *
+ * Backends copy the pack once per thread, call init() on the copy, run
+ * their portion of the iteration space through invoke(), and combine()
+ * the copy back into the shared pack. resolve() is called by the forall()
+ * front end after the backend returns, unless the backend has already
+ * resolved the pack itself.
+ *
+ ******************************************************************************
+ */
+template <typename... Params>
+struct ParamPack {
+  using index_seq = camp::make_idx_seq_t<sizeof...(Params)>;
+
+  camp::tuple<Params...> params;
+
+  RAJA_HOST_DEVICE explicit ParamPack(Params const&... p) : params{p...} {}
+
+  RAJA_HOST_DEVICE void init() { init_impl(index_seq{}); }
+
+  RAJA_HOST_DEVICE void combine(ParamPack const& other)
+  {
+    combine_impl(index_seq{}, other);
+  }
+
+  //! write the values back to the targets; later calls do nothing
+  RAJA_HOST_DEVICE void resolve()
+  {
+    if (!resolved) {
+      resolve_impl(index_seq{});
+      resolved = true;
+    }
+  }
+
+  //! return a copy of this pack with every value reset to its identity
+  RAJA_HOST_DEVICE ParamPack make_private() const
+  {
+    ParamPack priv{*this};
+    priv.init();
+    return priv;
+  }
+
+  //! call body with the loop arguments followed by the private values
+  RAJA_SUPPRESS_HD_WARN
+  template <typename Body, typename... Args>
+  RAJA_HOST_DEVICE RAJA_INLINE void invoke(Body const& body, Args&&... args)
+  {
+    invoke_impl(index_seq{}, body, std::forward<Args>(args)...);
+  }
+
+private:
+  bool resolved = false;
+
+  template <camp::idx_t... Is>
+  RAJA_HOST_DEVICE void init_impl(camp::idx_seq<Is...>)
+  {
+    camp::sink((camp::get<Is>(params).init(), 0)...);
+  }
+
+  template <camp::idx_t... Is>
+  RAJA_HOST_DEVICE void combine_impl(camp::idx_seq<Is...>,
+                                     ParamPack const& other)
+  {
+    camp::sink(
+        (camp::get<Is>(params).combine(camp::get<Is>(other.params)), 0)...);
+  }
+
+  template <camp::idx_t... Is>
+  RAJA_HOST_DEVICE void resolve_impl(camp::idx_seq<Is...>)
+  {
+    camp::sink((camp::get<Is>(params).resolve(), 0)...);
+  }
+
+  RAJA_SUPPRESS_HD_WARN
+  template <camp::idx_t... Is, typename Body, typename... Args>
+  RAJA_HOST_DEVICE RAJA_INLINE void invoke_impl(camp::idx_seq<Is...>,
+                                                Body const& body,
+                                                Args&&... args)
+  {
+    body(std::forward<Args>(args)..., camp::get<Is>(params).val...);
+  }
+};
+
+/*!
+ * \brief Loop body calling body with the loop arguments followed by the
+ * values of pack, so a backend can run a pack through its loops without
+ * kernel parameters.
+ */
+template <typename Body, typename Pack>
+struct ParamPackBody {
+  Body const& body;
+  Pack& pack;
+
+  template <typename... Args>
+  RAJA_INLINE void operator()(Args&&... args) const
+  {
+    pack.invoke(body, std::forward<Args>(args)...);
+  }
+};
+
+template <typename Body, typename Pack>
+RAJA_INLINE ParamPackBody<Body, Pack> bind_param_pack(Body const& body,
+                                                      Pack& pack)
+{
+  return ParamPackBody<Body, Pack>{body, pack};
+}
+
+template <typename... Params>
+RAJA_INLINE ParamPack<camp::decay<Params>...> make_param_pack(
+    Params&&... params)
+{
+  return ParamPack<camp::decay<Params>...>{params...};
+}
+
+/*!
+ * \brief True if every argument but the last is a kernel parameter, i.e.
+ * the argument list has the form (params..., body).
+ */
+template <typename... Args>
+struct is_param_forall_args : std::false_type {
+};
+
+template <typename Body>
+struct is_param_forall_args<Body> : std::true_type {
+};
+
+template <typename Param, typename... Rest>
+struct is_param_forall_args<Param, Rest...>
+    : std::integral_constant<bool,
+                             sizeof...(Rest) >= 1
+                                 && is_param_reducer<camp::decay<Param>>::value
+                                 && is_param_forall_args<Rest...>::value> {
+};
+
+}  // namespace detail
+
+namespace type_traits
+{
+
+template <typename... Args>
+struct is_forall_param_list
+    : std::integral_constant<bool,
+                             (sizeof...(Args) >= 2)
+                                 && detail::is_param_forall_args<
+                                     Args...>::value> {
+};
+
+}  // namespace type_traits
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
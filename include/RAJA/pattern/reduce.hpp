@@ -156,6 +156,59 @@ class ReduceMax;
 template <typename REDUCE_POLICY_T, typename T, typename IndexType = Index_type>
 class ReduceMaxLoc;
 
+/*!
+ ******************************************************************************
+ *
+ * \brief  K-smallest-with-location reducer class template.
+ *
+ * Keeps the K smallest values and the loop indices where they were found.
+ * Ties are broken in favor of the smaller index.
+ *
+ * Usage example:
+ *
+ * \verbatim
+
+   Real_ptr dt = ...;
+   ReduceMinLocK<reduce_policy, Real_type, Index_type, 8> my_mins;
+
+   forall<exec_policy>( ..., [=] (Index_type i) {
+      my_mins.minloc(dt[i], i);
+   }
+
+   for (size_t k = 0; k < my_mins.size(); ++k) {
+      Real_type minval = my_mins.get(k);     // k-th smallest value
+      Index_type minloc = my_mins.getLoc(k);
+   }
+
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template <typename REDUCE_POLICY_T, typename T, typename IndexType, size_t K>
+class ReduceMinLocK;
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  K-largest-with-location reducer class template.
+ *
+ * Same as ReduceMinLocK, keeping the K largest values instead, e.g.
+ *
+ * \verbatim
+
+   ReduceMaxLocK<reduce_policy, Real_type, Index_type, 8> my_maxs;
+
+   forall<exec_policy>( ..., [=] (Index_type i) {
+      my_maxs.maxloc(err[i], i);
+   }
+
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template <typename REDUCE_POLICY_T, typename T, typename IndexType, size_t K>
+class ReduceMaxLocK;
+
 /*!
  ******************************************************************************
  *
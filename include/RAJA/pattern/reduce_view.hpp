@@ -0,0 +1,522 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing RAJA dimension-wise View reduction
+ *          templates.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_reduce_view_HPP
+#define RAJA_pattern_reduce_view_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/pattern/params/reducer.hpp"
+
+#include "RAJA/util/Layout.hpp"
+#include "RAJA/util/OffsetLayout.hpp"
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/View.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! number of consecutive output elements handled by one work item when the
+//! kept dimensions are the contiguous ones
+constexpr Index_type reduce_view_tile = 128;
+
+//! number of consecutive input elements handled by one work item when the
+//! input is split across threads
+constexpr Index_type reduce_view_chunk = 2048;
+
+//! below this many independent output work items, the input is split across
+//! threads instead
+constexpr Index_type reduce_view_split_threshold = 64;
+
+//
+// Sizes and strides of a layout, ignoring offsets since the reduction only
+// walks the data linearly.
+//
+template <camp::idx_t... RangeInts, typename IdxLin, ptrdiff_t StrideOneDim>
+RAJA_INLINE void get_layout_geometry(
+    LayoutBase_impl<camp::idx_seq<RangeInts...>, IdxLin, StrideOneDim> const&
+        layout,
+    Index_type* sizes,
+    Index_type* strides)
+{
+  camp::sink((sizes[RangeInts] = static_cast<Index_type>(
+                  layout.sizes[RangeInts] ? layout.sizes[RangeInts] : 1),
+              0)...);
+  camp::sink((strides[RangeInts] =
+                  static_cast<Index_type>(layout.strides[RangeInts]),
+              0)...);
+}
+
+template <camp::idx_t... RangeInts, typename IdxLin>
+RAJA_INLINE void get_layout_geometry(
+    internal::OffsetLayout_impl<camp::idx_seq<RangeInts...>, IdxLin> const&
+        layout,
+    Index_type* sizes,
+    Index_type* strides)
+{
+  get_layout_geometry(layout.base_, sizes, strides);
+}
+
+//
+// Access to the untyped View underneath a View or TypedView.
+//
+template <typename ValueType, typename LayoutType, typename PointerType>
+RAJA_INLINE View<ValueType, LayoutType, PointerType> const& untyped_view(
+    View<ValueType, LayoutType, PointerType> const& view)
+{
+  return view;
+}
+
+template <typename ValueType,
+          typename PointerType,
+          typename LayoutType,
+          typename... IndexTypes>
+RAJA_INLINE View<ValueType, LayoutType, PointerType> const& untyped_view(
+    TypedViewBase<ValueType, PointerType, LayoutType, IndexTypes...> const&
+        view)
+{
+  return view.base_;
+}
+
+/*!
+ * Iteration space of a View reduction, split into the dimensions that are
+ * kept (one output element per index) and the dimensions that are reduced.
+ * Each group is ordered from the largest to the smallest input stride, so
+ * the last dimension of a group is the one that is cheapest to walk.
+ */
+template <size_t in_dims>
+struct ViewReduceShape {
+  Index_type n_kept = 0;
+  Index_type kept_size[in_dims];
+  Index_type kept_in_stride[in_dims];
+  Index_type kept_out_stride[in_dims];
+
+  Index_type n_red = 0;
+  Index_type red_size[in_dims];
+  Index_type red_in_stride[in_dims];
+
+  //! product of the first n sizes in arr
+  static Index_type extent(Index_type const* arr, Index_type n)
+  {
+    Index_type len = 1;
+    for (Index_type d = 0; d < n; ++d) {
+      len *= arr[d];
+    }
+    return len;
+  }
+
+  //! offsets of multi-index number idx over the first n dimensions
+  RAJA_INLINE void decode_kept(Index_type idx,
+                               Index_type n,
+                               Index_type& in_off,
+                               Index_type& out_off) const
+  {
+    for (Index_type d = n - 1; d >= 0; --d) {
+      Index_type const i = idx % kept_size[d];
+      idx /= kept_size[d];
+      in_off += i * kept_in_stride[d];
+      out_off += i * kept_out_stride[d];
+    }
+  }
+
+  RAJA_INLINE Index_type decode_red(Index_type idx, Index_type n) const
+  {
+    Index_type off = 0;
+    for (Index_type d = n - 1; d >= 0; --d) {
+      off += (idx % red_size[d]) * red_in_stride[d];
+      idx /= red_size[d];
+    }
+    return off;
+  }
+
+  //! call body(offset) for every index of the first n reduced dimensions
+  template <typename Body>
+  RAJA_INLINE void for_each_red(Index_type n,
+                                Index_type base,
+                                Body&& body) const
+  {
+    Index_type idx[in_dims] = {0};
+    for (;;) {
+      body(base);
+      Index_type d = n - 1;
+      for (; d >= 0; --d) {
+        base += red_in_stride[d];
+        if (++idx[d] < red_size[d]) break;
+        base -= red_size[d] * red_in_stride[d];
+        idx[d] = 0;
+      }
+      if (d < 0) return;
+    }
+  }
+};
+
+//
+// Reduction of len values of ptr spaced by stride. Four independent partial
+// values keep the contiguous case free of a loop-carried dependence so it
+// can be vectorized.
+//
+template <typename Op, typename T, typename Ptr>
+RAJA_INLINE T reduce_view_run(Ptr ptr, Index_type len, Index_type stride)
+{
+  Op op{};
+  T v0 = Op::identity(), v1 = Op::identity(), v2 = Op::identity(),
+    v3 = Op::identity();
+  Index_type i = 0;
+  if (stride == 1) {
+    for (; i + 4 <= len; i += 4) {
+      v0 = op(v0, ptr[i]);
+      v1 = op(v1, ptr[i + 1]);
+      v2 = op(v2, ptr[i + 2]);
+      v3 = op(v3, ptr[i + 3]);
+    }
+    for (; i < len; ++i) {
+      v0 = op(v0, ptr[i]);
+    }
+  } else {
+    for (; i + 4 <= len; i += 4) {
+      v0 = op(v0, ptr[i * stride]);
+      v1 = op(v1, ptr[(i + 1) * stride]);
+      v2 = op(v2, ptr[(i + 2) * stride]);
+      v3 = op(v3, ptr[(i + 3) * stride]);
+    }
+    for (; i < len; ++i) {
+      v0 = op(v0, ptr[i * stride]);
+    }
+  }
+  return op(op(v0, v1), op(v2, v3));
+}
+
+template <size_t in_dims, size_t out_dims, typename InView, typename OutView>
+ViewReduceShape<in_dims> make_view_reduce_shape(InView const& in,
+                                                OutView const& out,
+                                                int const (&dims)[in_dims
+                                                                  - out_dims])
+{
+  constexpr size_t n_red = in_dims - out_dims;
+
+  Index_type in_sizes[in_dims], in_strides[in_dims];
+  Index_type out_sizes[out_dims], out_strides[out_dims];
+  get_layout_geometry(in.layout, in_sizes, in_strides);
+  get_layout_geometry(out.layout, out_sizes, out_strides);
+
+  bool reduced[in_dims] = {false};
+  for (size_t r = 0; r < n_red; ++r) {
+    if (dims[r] < 0 || dims[r] >= static_cast<int>(in_dims)
+        || reduced[dims[r]]) {
+      RAJA_ABORT_OR_THROW("reduce_view: invalid reduction dimension");
+    }
+    reduced[dims[r]] = true;
+  }
+
+  ViewReduceShape<in_dims> shape;
+  for (size_t d = 0; d < in_dims; ++d) {
+    if (reduced[d]) {
+      shape.red_size[shape.n_red] = in_sizes[d];
+      shape.red_in_stride[shape.n_red] = in_strides[d];
+      ++shape.n_red;
+    } else {
+      // output dimensions follow the input's kept dimensions in order
+      if (out_sizes[shape.n_kept] != in_sizes[d]) {
+        RAJA_ABORT_OR_THROW("reduce_view: output View size mismatch");
+      }
+      shape.kept_size[shape.n_kept] = in_sizes[d];
+      shape.kept_in_stride[shape.n_kept] = in_strides[d];
+      shape.kept_out_stride[shape.n_kept] = out_strides[shape.n_kept];
+      ++shape.n_kept;
+    }
+  }
+
+  // order each group by decreasing input stride (insertion sort, n is tiny)
+  for (Index_type i = 1; i < shape.n_kept; ++i) {
+    for (Index_type j = i;
+         j > 0 && shape.kept_in_stride[j - 1] < shape.kept_in_stride[j];
+         --j) {
+      std::swap(shape.kept_size[j - 1], shape.kept_size[j]);
+      std::swap(shape.kept_in_stride[j - 1], shape.kept_in_stride[j]);
+      std::swap(shape.kept_out_stride[j - 1], shape.kept_out_stride[j]);
+    }
+  }
+  for (Index_type i = 1; i < shape.n_red; ++i) {
+    for (Index_type j = i;
+         j > 0 && shape.red_in_stride[j - 1] < shape.red_in_stride[j];
+         --j) {
+      std::swap(shape.red_size[j - 1], shape.red_size[j]);
+      std::swap(shape.red_in_stride[j - 1], shape.red_in_stride[j]);
+    }
+  }
+
+  return shape;
+}
+
+/*!
+ * Each work item owns one output element and walks the reduced dimensions
+ * with the smallest input stride innermost. Used when a reduced dimension
+ * is the contiguous one.
+ */
+template <typename ExecPolicy,
+          typename Op,
+          typename T,
+          size_t in_dims,
+          typename InPtr,
+          typename OutPtr>
+RAJA_INLINE void reduce_view_by_output(ViewReduceShape<in_dims> const& shape,
+                                       InPtr in,
+                                       OutPtr out)
+{
+  Index_type const n_out = shape.extent(shape.kept_size, shape.n_kept);
+  Index_type const n_outer = shape.n_red - 1;
+  Index_type const inner_len = shape.red_size[n_outer];
+  Index_type const inner_stride = shape.red_in_stride[n_outer];
+
+  forall<ExecPolicy>(TypedRangeSegment<Index_type>(0, n_out),
+                     [=](Index_type o) {
+                       Op op{};
+                       Index_type in_off = 0, out_off = 0;
+                       shape.decode_kept(o, shape.n_kept, in_off, out_off);
+
+                       T val = Op::identity();
+                       shape.for_each_red(n_outer, in_off, [&](Index_type off) {
+                         val = op(val,
+                                  reduce_view_run<Op, T>(in + off,
+                                                         inner_len,
+                                                         inner_stride));
+                       });
+                       out[out_off] = val;
+                     });
+}
+
+/*!
+ * Each work item owns a tile of consecutive output elements along the kept
+ * dimension with the smallest input stride, and sweeps the reduced
+ * dimensions over the whole tile. Used when a kept dimension is the
+ * contiguous one, so every input row is read with unit stride.
+ */
+template <typename ExecPolicy,
+          typename Op,
+          typename T,
+          size_t in_dims,
+          typename InPtr,
+          typename OutPtr>
+RAJA_INLINE void reduce_view_by_tile(ViewReduceShape<in_dims> const& shape,
+                                     InPtr in,
+                                     OutPtr out)
+{
+  Index_type const n_outer = shape.n_kept - 1;
+  Index_type const inner_len = shape.kept_size[n_outer];
+  Index_type const inner_in_stride = shape.kept_in_stride[n_outer];
+  Index_type const inner_out_stride = shape.kept_out_stride[n_outer];
+  Index_type const n_tiles =
+      (inner_len + reduce_view_tile - 1) / reduce_view_tile;
+  Index_type const n_work = shape.extent(shape.kept_size, n_outer) * n_tiles;
+
+  forall<ExecPolicy>(
+      TypedRangeSegment<Index_type>(0, n_work), [=](Index_type w) {
+        Op op{};
+        Index_type const tile = w % n_tiles;
+        Index_type const first = tile * reduce_view_tile;
+        Index_type const len = std::min(reduce_view_tile, inner_len - first);
+
+        Index_type in_off = first * inner_in_stride;
+        Index_type out_off = first * inner_out_stride;
+        shape.decode_kept(w / n_tiles, n_outer, in_off, out_off);
+
+        T val[reduce_view_tile];
+        for (Index_type j = 0; j < len; ++j) {
+          val[j] = Op::identity();
+        }
+
+        shape.for_each_red(shape.n_red, in_off, [&](Index_type off) {
+          auto row = in + off;
+          RAJA_SIMD
+          for (Index_type j = 0; j < len; ++j) {
+            val[j] = op(val[j], row[j * inner_in_stride]);
+          }
+        });
+
+        for (Index_type j = 0; j < len; ++j) {
+          out[out_off + j * inner_out_stride] = val[j];
+        }
+      });
+}
+
+/*!
+ * Output elements are processed one at a time and the reduced dimensions of
+ * each are split into chunks across the execution policy, with private
+ * partial values combined through a kernel-parameter reduction. Used when
+ * there are too few outputs to keep the execution policy busy.
+ */
+template <typename ExecPolicy,
+          typename Op,
+          typename T,
+          size_t in_dims,
+          typename InPtr,
+          typename OutPtr>
+RAJA_INLINE void reduce_view_split(ViewReduceShape<in_dims> const& shape,
+                                   InPtr in,
+                                   OutPtr out)
+{
+  Index_type const n_out = shape.extent(shape.kept_size, shape.n_kept);
+  Index_type const n_outer = shape.n_red - 1;
+  Index_type const inner_len = shape.red_size[n_outer];
+  Index_type const inner_stride = shape.red_in_stride[n_outer];
+  Index_type const n_chunks =
+      (inner_len + reduce_view_chunk - 1) / reduce_view_chunk;
+  Index_type const n_work = shape.extent(shape.red_size, n_outer) * n_chunks;
+
+  for (Index_type o = 0; o < n_out; ++o) {
+    Index_type in_off = 0, out_off = 0;
+    shape.decode_kept(o, shape.n_kept, in_off, out_off);
+
+    T result = Op::identity();
+    forall<ExecPolicy>(
+        TypedRangeSegment<Index_type>(0, n_work),
+        ParamReducer<Op, T>{&result},
+        [=](Index_type w, T& val) {
+          Index_type const chunk = w % n_chunks;
+          Index_type const first = chunk * reduce_view_chunk;
+          Index_type const len =
+              std::min(reduce_view_chunk, inner_len - first);
+          Index_type const off = in_off + first * inner_stride
+                                 + shape.decode_red(w / n_chunks, n_outer);
+          val = Op{}(val, reduce_view_run<Op, T>(in + off, len, inner_stride));
+        });
+    out[out_off] = result;
+  }
+}
+
+}  // namespace detail
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Reduce a View along one or more of its dimensions.
+ *
+ * \tparam ExecPolicy  forall execution policy used for the traversal
+ * \tparam Op          reduction operator, e.g. operators::plus<double>
+ *
+ * \param[in]  in    View to reduce
+ * \param[out] out   View holding one element per index of the dimensions of
+ *                   in that are not reduced, in the same order
+ * \param[in]  dims  dimensions of in to reduce over
+ *
+ * Each element of out is overwritten with the reduction of the matching
+ * slice of in, starting from Op::identity(). Only layout sizes and strides
+ * are used, so permuted and offset layouts are supported and the index
+ * ranges of in and out do not need to start at the same offsets.
+ *
+ * The traversal is chosen from the layout strides: when a reduced dimension
+ * is the contiguous one, each work item reduces a whole slice with a unit
+ * stride inner loop; when a kept dimension is the contiguous one, each work
+ * item accumulates a tile of neighboring outputs so that input rows are
+ * still read contiguously. When there are too few outputs to parallelize
+ * over, the reduced slice of each output is split across the execution
+ * policy instead, which requires a policy that supports kernel-parameter
+ * reductions in forall().
+ *
+ * Usage example (sum over the angle dimension of a 3D View):
+ *
+ * \verbatim
+
+   View<double, Layout<3>> psi(psi_ptr, num_zones, num_groups, num_angles);
+   View<double, Layout<2>> phi(phi_ptr, num_zones, num_groups);
+
+   reduce_view<omp_parallel_for_exec, operators::plus<double>>(psi, phi, 2);
+
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template <typename ExecPolicy,
+          typename Op,
+          typename InView,
+          typename OutView,
+          typename... Dims>
+RAJA_INLINE void reduce_view(InView const& in_view,
+                             OutView const& out_view,
+                             Dims... dims)
+{
+  auto const& in = detail::untyped_view(in_view);
+  auto const& out = detail::untyped_view(out_view);
+
+  using in_layout = typename camp::decay<decltype(in)>::layout_type;
+  using out_layout = typename camp::decay<decltype(out)>::layout_type;
+  using value_type = typename std::remove_const<
+      typename camp::decay<decltype(out)>::value_type>::type;
+
+  constexpr size_t in_dims = in_layout::n_dims;
+  constexpr size_t out_dims = out_layout::n_dims;
+
+  static_assert(sizeof...(Dims) >= 1,
+                "reduce_view requires at least one reduction dimension");
+  static_assert(out_dims + sizeof...(Dims) == in_dims,
+                "reduce_view output View must have one dimension per "
+                "dimension of the input View that is not reduced");
+
+  int const red_dims[sizeof...(Dims)] = {static_cast<int>(dims)...};
+  detail::ViewReduceShape<in_dims> const shape =
+      detail::make_view_reduce_shape<in_dims, out_dims>(in, out, red_dims);
+
+  Index_type const n_out = shape.extent(shape.kept_size, shape.n_kept);
+  Index_type const n_red = shape.extent(shape.red_size, shape.n_red);
+  if (n_out == 0) return;
+
+  bool const kept_contiguous =
+      shape.n_kept > 0
+      && shape.kept_in_stride[shape.n_kept - 1]
+             < shape.red_in_stride[shape.n_red - 1];
+
+  Index_type const n_work =
+      kept_contiguous ? (n_out / shape.kept_size[shape.n_kept - 1])
+                            * ((shape.kept_size[shape.n_kept - 1]
+                                + detail::reduce_view_tile - 1)
+                               / detail::reduce_view_tile)
+                      : n_out;
+
+  if (n_work < detail::reduce_view_split_threshold
+      && n_red >= detail::reduce_view_chunk) {
+    detail::reduce_view_split<ExecPolicy, Op, value_type>(shape,
+                                                          in.data,
+                                                          out.data);
+  } else if (kept_contiguous) {
+    detail::reduce_view_by_tile<ExecPolicy, Op, value_type>(shape,
+                                                            in.data,
+                                                            out.data);
+  } else {
+    detail::reduce_view_by_output<ExecPolicy, Op, value_type>(shape,
+                                                              in.data,
+                                                              out.data);
+  }
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -26,6 +26,7 @@
 #include "camp/concepts.hpp"
 #include "camp/helpers.hpp"
 
+#include "RAJA/pattern/detail/scan.hpp"
 #include "RAJA/policy/PolicyBase.hpp"
 #include "RAJA/util/Operators.hpp"
 
@@ -42,6 +43,15 @@ template <typename Container>
 using ContainerVal =
     camp::decay<decltype(*camp::val<camp::iterator_from<Container>>())>;
 
+//! type produced by applying Transform to the elements of Iter
+template <typename Iter, typename Transform>
+using TransformVal =
+    camp::decay<decltype(camp::val<Transform>()(*camp::val<Iter>()))>;
+
+//! number of segments produced by a segmented reduction over Iter
+template <typename Iter>
+using IterDiff = typename std::iterator_traits<Iter>::difference_type;
+
 }  // end namespace detail
 
 /*!
@@ -362,6 +372,810 @@ exclusive_scan(const ExecPolicy &p,
   impl::scan::exclusive(p, std::begin(c), std::end(c), out, binop, value);
 }
 
+// =============================================================================
+
+/*!
+******************************************************************************
+*
+* \brief  inclusive transform scan execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] begin Pointer or Random-Access Iterator to start of data range
+* \param[in] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[out] out Pointer or Random-Access Iterator to start of output data
+*range
+* \param[in] transform unary function producing the value scanned for each
+*element
+* \param[in] binop binary function to apply for scan
+*
+* \note{The transformed values are computed on the fly and never stored.
+*transform may be called more than once per element. out may equal begin.}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename IterOut,
+          typename Transform,
+          typename Function =
+              operators::plus<detail::TransformVal<Iter, Transform>>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<Iter>,
+                    type_traits::is_iterator<IterOut>>
+transform_inclusive_scan(const ExecPolicy &p,
+                         Iter begin,
+                         Iter end,
+                         IterOut out,
+                         Transform transform,
+                         Function binop = Function{})
+{
+  using Size = detail::IterDiff<Iter>;
+  using R = detail::IterVal<IterOut>;
+  using T = detail::TransformVal<Iter, Transform>;
+  static_assert(type_traits::is_binary_function<Function, R, T, R>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<IterOut>::value,
+                "Output Iterator must model RandomAccessIterator");
+  if (begin == end) {
+    return;
+  }
+  impl::scan::transform<true>(
+      p,
+      Size(end - begin),
+      [=](Size i) -> T { return transform(*(begin + i)); },
+      [=](Size i, R const &v) { *(out + i) = v; },
+      binop,
+      Function::identity());
+}
+
+/*!
+******************************************************************************
+*
+* \brief  inclusive transform scan execution pattern with consumer
+*
+* \param[in] p Execution policy
+* \param[in] begin Pointer or Random-Access Iterator to start of data range
+* \param[in] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[in] transform unary function producing the value scanned for each
+*element
+* \param[in] consumer binary function called as consumer(x, v) with each
+*element x and its scan result v
+* \param[in] binop binary function to apply for scan
+*
+* \note{Neither the transformed values nor the scan results are stored, so
+*with a RangeSegment producer and consumer work directly in index space.
+*transform may be called more than once per element; consumer is called
+*exactly once per element, in no particular order.}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename Transform,
+          typename Consumer,
+          typename Function =
+              operators::plus<detail::TransformVal<Iter, Transform>>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<Iter>,
+                    concepts::negate<type_traits::is_iterator<Transform>>>
+transform_inclusive_scan(const ExecPolicy &p,
+                         Iter begin,
+                         Iter end,
+                         Transform transform,
+                         Consumer consumer,
+                         Function binop = Function{})
+{
+  using Size = detail::IterDiff<Iter>;
+  using T = detail::TransformVal<Iter, Transform>;
+  static_assert(type_traits::is_binary_function<Function, T, T, T>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  if (begin == end) {
+    return;
+  }
+  impl::scan::transform<true>(
+      p,
+      Size(end - begin),
+      [=](Size i) -> T { return transform(*(begin + i)); },
+      [=](Size i, T const &v) { consumer(*(begin + i), v); },
+      binop,
+      Function::identity());
+}
+
+/*!
+******************************************************************************
+*
+* \brief  exclusive transform scan execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] begin Pointer or Random-Access Iterator to start of data range
+* \param[in] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[out] out Pointer or Random-Access Iterator to start of output data
+*range
+* \param[in] transform unary function producing the value scanned for each
+*element
+* \param[in] binop binary function to apply for scan
+* \param[in] value initial value for scan
+*
+* \note{The transformed values are computed on the fly and never stored.
+*transform may be called more than once per element. out may equal begin.}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename IterOut,
+          typename Transform,
+          typename T = detail::TransformVal<Iter, Transform>,
+          typename Function = operators::plus<T>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<Iter>,
+                    type_traits::is_iterator<IterOut>>
+transform_exclusive_scan(const ExecPolicy &p,
+                         Iter begin,
+                         Iter end,
+                         IterOut out,
+                         Transform transform,
+                         Function binop = Function{},
+                         T value = Function::identity())
+{
+  using Size = detail::IterDiff<Iter>;
+  using R = detail::IterVal<IterOut>;
+  using U = detail::TransformVal<Iter, Transform>;
+  static_assert(type_traits::is_binary_function<Function, R, T, U>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<IterOut>::value,
+                "Output Iterator must model RandomAccessIterator");
+  if (begin == end) {
+    return;
+  }
+  impl::scan::transform<false>(
+      p,
+      Size(end - begin),
+      [=](Size i) -> U { return transform(*(begin + i)); },
+      [=](Size i, R const &v) { *(out + i) = v; },
+      binop,
+      value);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  exclusive transform scan execution pattern with consumer
+*
+* \param[in] p Execution policy
+* \param[in] begin Pointer or Random-Access Iterator to start of data range
+* \param[in] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[in] transform unary function producing the value scanned for each
+*element
+* \param[in] consumer binary function called as consumer(x, v) with each
+*element x and its scan result v
+* \param[in] binop binary function to apply for scan
+* \param[in] value initial value for scan
+*
+* \note{Neither the transformed values nor the scan results are stored.
+*transform may be called more than once per element; consumer is called
+*exactly once per element, in no particular order.}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename Transform,
+          typename Consumer,
+          typename T = detail::TransformVal<Iter, Transform>,
+          typename Function = operators::plus<T>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<Iter>,
+                    concepts::negate<type_traits::is_iterator<Transform>>>
+transform_exclusive_scan(const ExecPolicy &p,
+                         Iter begin,
+                         Iter end,
+                         Transform transform,
+                         Consumer consumer,
+                         Function binop = Function{},
+                         T value = Function::identity())
+{
+  using Size = detail::IterDiff<Iter>;
+  using U = detail::TransformVal<Iter, Transform>;
+  static_assert(type_traits::is_binary_function<Function, T, T, U>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  if (begin == end) {
+    return;
+  }
+  impl::scan::transform<false>(
+      p,
+      Size(end - begin),
+      [=](Size i) -> U { return transform(*(begin + i)); },
+      [=](Size i, T const &v) { consumer(*(begin + i), v); },
+      binop,
+      value);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  inclusive transform scan execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] c Random-Access Container, e.g. a RangeSegment of indices
+* \param[in] transform unary function producing the value scanned for each
+*element
+* \param[in] consumer binary function called as consumer(x, v) with each
+*element x and its scan result v
+* \param[in] binop binary function to apply for scan
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Container,
+          typename Transform,
+          typename Consumer,
+          typename Function = operators::plus<
+              detail::TransformVal<camp::iterator_from<Container>, Transform>>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_range<Container>,
+                    concepts::negate<type_traits::is_iterator<Transform>>>
+transform_inclusive_scan(const ExecPolicy &p,
+                         const Container &c,
+                         Transform transform,
+                         Consumer consumer,
+                         Function binop = Function{})
+{
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+  ::RAJA::transform_inclusive_scan(
+      p, std::begin(c), std::end(c), transform, consumer, binop);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  exclusive transform scan execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] c Random-Access Container, e.g. a RangeSegment of indices
+* \param[in] transform unary function producing the value scanned for each
+*element
+* \param[in] consumer binary function called as consumer(x, v) with each
+*element x and its scan result v
+* \param[in] binop binary function to apply for scan
+* \param[in] value initial value for scan
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Container,
+          typename Transform,
+          typename Consumer,
+          typename T =
+              detail::TransformVal<camp::iterator_from<Container>, Transform>,
+          typename Function = operators::plus<T>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_range<Container>,
+                    concepts::negate<type_traits::is_iterator<Transform>>>
+transform_exclusive_scan(const ExecPolicy &p,
+                         const Container &c,
+                         Transform transform,
+                         Consumer consumer,
+                         Function binop = Function{},
+                         T value = Function::identity())
+{
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+  ::RAJA::transform_exclusive_scan(
+      p, std::begin(c), std::end(c), transform, consumer, binop, value);
+}
+
+// =============================================================================
+
+/*!
+******************************************************************************
+*
+* \brief  inclusive scan by key execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] keys_begin Pointer or Random-Access Iterator to start of keys
+* \param[in] keys_end Pointer or Random-Access Iterator to end of keys
+*(exclusive)
+* \param[in] vals_begin Pointer or Random-Access Iterator to start of values
+* \param[out] out Pointer or Random-Access Iterator to start of output data
+*range
+* \param[in] binop binary function to apply for scan
+* \param[in] eq key equality; runs of consecutive equal keys form segments
+*
+* \note{The scan restarts at the first value of every segment. out may equal
+*vals_begin.}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename ValIter,
+          typename IterOut,
+          typename Function = operators::plus<detail::IterVal<ValIter>>,
+          typename Equal = operators::equal_to<detail::IterVal<KeyIter>>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<KeyIter>,
+                    type_traits::is_iterator<ValIter>,
+                    type_traits::is_iterator<IterOut>>
+inclusive_scan_by_key(const ExecPolicy &p,
+                      KeyIter keys_begin,
+                      KeyIter keys_end,
+                      ValIter vals_begin,
+                      IterOut out,
+                      Function binop = Function{},
+                      Equal eq = Equal{})
+{
+  using R = detail::IterVal<IterOut>;
+  using T = detail::IterVal<ValIter>;
+  using K = detail::IterVal<KeyIter>;
+  static_assert(type_traits::is_binary_function<Function, R, T, R>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_binary_function<Equal, bool, K, K>::value,
+                "Equal must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<KeyIter>::value,
+                "Keys Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<ValIter>::value,
+                "Values Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<IterOut>::value,
+                "Output Iterator must model RandomAccessIterator");
+  if (keys_begin == keys_end) {
+    return;
+  }
+  impl::scan::segmented<true>(p,
+                              vals_begin,
+                              vals_begin + (keys_end - keys_begin),
+                              detail::key_heads<KeyIter, Equal>{keys_begin,
+                                                                eq},
+                              out,
+                              binop,
+                              Function::identity());
+}
+
+/*!
+******************************************************************************
+*
+* \brief  exclusive scan by key execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] keys_begin Pointer or Random-Access Iterator to start of keys
+* \param[in] keys_end Pointer or Random-Access Iterator to end of keys
+*(exclusive)
+* \param[in] vals_begin Pointer or Random-Access Iterator to start of values
+* \param[out] out Pointer or Random-Access Iterator to start of output data
+*range
+* \param[in] binop binary function to apply for scan
+* \param[in] value initial value of every segment
+* \param[in] eq key equality; runs of consecutive equal keys form segments
+*
+* \note{The first output of every segment is value. out may equal
+*vals_begin.}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename ValIter,
+          typename IterOut,
+          typename T = detail::IterVal<ValIter>,
+          typename Function = operators::plus<T>,
+          typename Equal = operators::equal_to<detail::IterVal<KeyIter>>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<KeyIter>,
+                    type_traits::is_iterator<ValIter>,
+                    type_traits::is_iterator<IterOut>>
+exclusive_scan_by_key(const ExecPolicy &p,
+                      KeyIter keys_begin,
+                      KeyIter keys_end,
+                      ValIter vals_begin,
+                      IterOut out,
+                      Function binop = Function{},
+                      T value = Function::identity(),
+                      Equal eq = Equal{})
+{
+  using R = detail::IterVal<IterOut>;
+  using U = detail::IterVal<ValIter>;
+  using K = detail::IterVal<KeyIter>;
+  static_assert(type_traits::is_binary_function<Function, R, T, U>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_binary_function<Equal, bool, K, K>::value,
+                "Equal must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<KeyIter>::value,
+                "Keys Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<ValIter>::value,
+                "Values Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<IterOut>::value,
+                "Output Iterator must model RandomAccessIterator");
+  if (keys_begin == keys_end) {
+    return;
+  }
+  impl::scan::segmented<false>(p,
+                               vals_begin,
+                               vals_begin + (keys_end - keys_begin),
+                               detail::key_heads<KeyIter, Equal>{keys_begin,
+                                                                 eq},
+                               out,
+                               binop,
+                               value);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  inclusive segmented scan execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] begin Pointer or Random-Access Iterator to start of data range
+* \param[in] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[in] flags Pointer or Random-Access Iterator to start of head flags;
+*a nonzero flag starts a segment
+* \param[out] out Pointer or Random-Access Iterator to start of output data
+*range
+* \param[in] binop binary function to apply for scan
+*
+* \note{out may equal begin.}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename FlagIter,
+          typename IterOut,
+          typename Function = operators::plus<detail::IterVal<Iter>>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<Iter>,
+                    type_traits::is_iterator<FlagIter>,
+                    type_traits::is_iterator<IterOut>>
+inclusive_segmented_scan(const ExecPolicy &p,
+                         Iter begin,
+                         Iter end,
+                         FlagIter flags,
+                         IterOut out,
+                         Function binop = Function{})
+{
+  using R = detail::IterVal<IterOut>;
+  using T = detail::IterVal<Iter>;
+  static_assert(type_traits::is_binary_function<Function, R, T, R>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<FlagIter>::value,
+                "Flags Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<IterOut>::value,
+                "Output Iterator must model RandomAccessIterator");
+  if (begin == end) {
+    return;
+  }
+  impl::scan::segmented<true>(p,
+                              begin,
+                              end,
+                              detail::flag_heads<FlagIter>{flags},
+                              out,
+                              binop,
+                              Function::identity());
+}
+
+/*!
+******************************************************************************
+*
+* \brief  exclusive segmented scan execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] begin Pointer or Random-Access Iterator to start of data range
+* \param[in] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[in] flags Pointer or Random-Access Iterator to start of head flags;
+*a nonzero flag starts a segment
+* \param[out] out Pointer or Random-Access Iterator to start of output data
+*range
+* \param[in] binop binary function to apply for scan
+* \param[in] value initial value of every segment
+*
+* \note{out may equal begin.}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename FlagIter,
+          typename IterOut,
+          typename T = detail::IterVal<Iter>,
+          typename Function = operators::plus<T>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<Iter>,
+                    type_traits::is_iterator<FlagIter>,
+                    type_traits::is_iterator<IterOut>>
+exclusive_segmented_scan(const ExecPolicy &p,
+                         Iter begin,
+                         Iter end,
+                         FlagIter flags,
+                         IterOut out,
+                         Function binop = Function{},
+                         T value = Function::identity())
+{
+  using R = detail::IterVal<IterOut>;
+  using U = detail::IterVal<Iter>;
+  static_assert(type_traits::is_binary_function<Function, R, T, U>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<FlagIter>::value,
+                "Flags Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<IterOut>::value,
+                "Output Iterator must model RandomAccessIterator");
+  if (begin == end) {
+    return;
+  }
+  impl::scan::segmented<false>(
+      p, begin, end, detail::flag_heads<FlagIter>{flags}, out, binop, value);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  inclusive segmented scan execution pattern, segments given by
+*offsets
+*
+* \param[in] p Execution policy
+* \param[in] begin Pointer or Random-Access Iterator to start of data range
+* \param[in] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[in] offsets_begin Pointer or Random-Access Iterator to start of the
+*sorted segment start indices, e.g. a CSR row offsets array
+* \param[in] offsets_end Pointer or Random-Access Iterator to end of the
+*segment start indices (exclusive)
+* \param[out] out Pointer or Random-Access Iterator to start of output data
+*range
+* \param[in] binop binary function to apply for scan
+*
+* \note{Repeated offsets describe empty segments. out may equal begin.}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename OffsetIter,
+          typename IterOut,
+          typename Function = operators::plus<detail::IterVal<Iter>>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<Iter>,
+                    type_traits::is_iterator<OffsetIter>,
+                    type_traits::is_iterator<IterOut>>
+inclusive_segmented_scan_by_offsets(const ExecPolicy &p,
+                                    Iter begin,
+                                    Iter end,
+                                    OffsetIter offsets_begin,
+                                    OffsetIter offsets_end,
+                                    IterOut out,
+                                    Function binop = Function{})
+{
+  using R = detail::IterVal<IterOut>;
+  using T = detail::IterVal<Iter>;
+  static_assert(type_traits::is_binary_function<Function, R, T, R>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<OffsetIter>::value,
+                "Offsets Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<IterOut>::value,
+                "Output Iterator must model RandomAccessIterator");
+  if (begin == end) {
+    return;
+  }
+  impl::scan::segmented<true>(
+      p,
+      begin,
+      end,
+      detail::offset_heads<OffsetIter>{offsets_begin, offsets_end},
+      out,
+      binop,
+      Function::identity());
+}
+
+/*!
+******************************************************************************
+*
+* \brief  exclusive segmented scan execution pattern, segments given by
+*offsets
+*
+* \param[in] p Execution policy
+* \param[in] begin Pointer or Random-Access Iterator to start of data range
+* \param[in] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[in] offsets_begin Pointer or Random-Access Iterator to start of the
+*sorted segment start indices, e.g. a CSR row offsets array
+* \param[in] offsets_end Pointer or Random-Access Iterator to end of the
+*segment start indices (exclusive)
+* \param[out] out Pointer or Random-Access Iterator to start of output data
+*range
+* \param[in] binop binary function to apply for scan
+* \param[in] value initial value of every segment
+*
+* \note{Repeated offsets describe empty segments. out may equal begin.}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename OffsetIter,
+          typename IterOut,
+          typename T = detail::IterVal<Iter>,
+          typename Function = operators::plus<T>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<Iter>,
+                    type_traits::is_iterator<OffsetIter>,
+                    type_traits::is_iterator<IterOut>>
+exclusive_segmented_scan_by_offsets(const ExecPolicy &p,
+                                    Iter begin,
+                                    Iter end,
+                                    OffsetIter offsets_begin,
+                                    OffsetIter offsets_end,
+                                    IterOut out,
+                                    Function binop = Function{},
+                                    T value = Function::identity())
+{
+  using R = detail::IterVal<IterOut>;
+  using U = detail::IterVal<Iter>;
+  static_assert(type_traits::is_binary_function<Function, R, T, U>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<OffsetIter>::value,
+                "Offsets Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<IterOut>::value,
+                "Output Iterator must model RandomAccessIterator");
+  if (begin == end) {
+    return;
+  }
+  impl::scan::segmented<false>(
+      p,
+      begin,
+      end,
+      detail::offset_heads<OffsetIter>{offsets_begin, offsets_end},
+      out,
+      binop,
+      value);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  reduce by key execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] keys_begin Pointer or Random-Access Iterator to start of keys
+* \param[in] keys_end Pointer or Random-Access Iterator to end of keys
+*(exclusive)
+* \param[in] vals_begin Pointer or Random-Access Iterator to start of values
+* \param[out] keys_out Pointer or Random-Access Iterator receiving the first
+*key of every segment
+* \param[out] vals_out Pointer or Random-Access Iterator receiving the
+*reduction of every segment
+* \param[in] binop binary function to apply for the reduction
+* \param[in] eq key equality; runs of consecutive equal keys form segments
+*
+* \return number of segments written to keys_out and vals_out
+*
+* \note{The outputs must be separate from the inputs and hold up to
+*keys_end - keys_begin elements.}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename ValIter,
+          typename KeyOut,
+          typename ValOut,
+          typename Function = operators::plus<detail::IterVal<ValIter>>,
+          typename Equal = operators::equal_to<detail::IterVal<KeyIter>>>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value
+                            && type_traits::is_iterator<KeyIter>::value
+                            && type_traits::is_iterator<ValIter>::value
+                            && type_traits::is_iterator<KeyOut>::value
+                            && type_traits::is_iterator<ValOut>::value,
+                        detail::IterDiff<KeyIter>>::type
+reduce_by_key(const ExecPolicy &p,
+              KeyIter keys_begin,
+              KeyIter keys_end,
+              ValIter vals_begin,
+              KeyOut keys_out,
+              ValOut vals_out,
+              Function binop = Function{},
+              Equal eq = Equal{})
+{
+  using Size = detail::IterDiff<KeyIter>;
+  using R = detail::IterVal<ValOut>;
+  using T = detail::IterVal<ValIter>;
+  using K = detail::IterVal<KeyIter>;
+  static_assert(type_traits::is_binary_function<Function, R, T, R>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_binary_function<Equal, bool, K, K>::value,
+                "Equal must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<KeyIter>::value,
+                "Keys Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<ValIter>::value,
+                "Values Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<KeyOut>::value,
+                "Keys Output Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<ValOut>::value,
+                "Values Output Iterator must model RandomAccessIterator");
+  if (keys_begin == keys_end) {
+    return 0;
+  }
+  return impl::scan::segmented_reduce(
+      p,
+      Size(keys_end - keys_begin),
+      detail::key_heads<KeyIter, Equal>{keys_begin, eq},
+      [=](Size i) -> T { return *(vals_begin + i); },
+      binop,
+      [=](Size s, Size i) { *(keys_out + s) = *(keys_begin + i); },
+      [=](Size s, R const &v) { *(vals_out + s) = v; });
+}
+
+/*!
+******************************************************************************
+*
+* \brief  run-length encoding execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] begin Pointer or Random-Access Iterator to start of data range
+* \param[in] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[out] unique_out Pointer or Random-Access Iterator receiving the
+*value of every run
+* \param[out] counts_out Pointer or Random-Access Iterator receiving the
+*length of every run
+* \param[in] eq equality; runs of consecutive equal values are encoded
+*
+* \return number of runs written to unique_out and counts_out
+*
+* \note{The outputs must be separate from the input and hold up to
+*end - begin elements.}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename IterOut,
+          typename CountOut,
+          typename Equal = operators::equal_to<detail::IterVal<Iter>>>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value
+                            && type_traits::is_iterator<Iter>::value
+                            && type_traits::is_iterator<IterOut>::value
+                            && type_traits::is_iterator<CountOut>::value,
+                        detail::IterDiff<Iter>>::type
+run_length_encode(const ExecPolicy &p,
+                  Iter begin,
+                  Iter end,
+                  IterOut unique_out,
+                  CountOut counts_out,
+                  Equal eq = Equal{})
+{
+  using Size = detail::IterDiff<Iter>;
+  using C = detail::IterVal<CountOut>;
+  using T = detail::IterVal<Iter>;
+  static_assert(type_traits::is_binary_function<Equal, bool, T, T>::value,
+                "Equal must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<IterOut>::value,
+                "Output Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<CountOut>::value,
+                "Counts Output Iterator must model RandomAccessIterator");
+  if (begin == end) {
+    return 0;
+  }
+  return impl::scan::segmented_reduce(
+      p,
+      Size(end - begin),
+      detail::key_heads<Iter, Equal>{begin, eq},
+      [](Size) { return C(1); },
+      operators::plus<C>{},
+      [=](Size s, Size i) { *(unique_out + s) = *(begin + i); },
+      [=](Size s, C const &c) { *(counts_out + s) = c; });
+}
+
 template <typename ExecPolicy, typename... Args>
 concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
 exclusive_scan(Args &&... args)
@@ -390,6 +1204,78 @@ inclusive_scan_inplace(Args &&... args)
   inclusive_scan_inplace(ExecPolicy{}, std::forward<Args>(args)...);
 }
 
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+transform_inclusive_scan(Args &&... args)
+{
+  transform_inclusive_scan(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+transform_exclusive_scan(Args &&... args)
+{
+  transform_exclusive_scan(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+inclusive_scan_by_key(Args &&... args)
+{
+  inclusive_scan_by_key(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+exclusive_scan_by_key(Args &&... args)
+{
+  exclusive_scan_by_key(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+inclusive_segmented_scan(Args &&... args)
+{
+  inclusive_segmented_scan(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+exclusive_segmented_scan(Args &&... args)
+{
+  exclusive_segmented_scan(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+inclusive_segmented_scan_by_offsets(Args &&... args)
+{
+  inclusive_segmented_scan_by_offsets(ExecPolicy{},
+                                      std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+exclusive_segmented_scan_by_offsets(Args &&... args)
+{
+  exclusive_segmented_scan_by_offsets(ExecPolicy{},
+                                      std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+auto reduce_by_key(Args &&... args)
+    -> decltype(reduce_by_key(ExecPolicy{}, std::forward<Args>(args)...))
+{
+  return reduce_by_key(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+auto run_length_encode(Args &&... args)
+    -> decltype(run_length_encode(ExecPolicy{}, std::forward<Args>(args)...))
+{
+  return run_length_encode(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
 }  // namespace RAJA
 
 #endif  // closing endif for header file include guard
@@ -0,0 +1,125 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA scatter-add declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_scatter_HPP
+#define RAJA_scatter_HPP
+
+#include "RAJA/config.hpp"
+
+#include <iterator>
+#include <type_traits>
+
+#include "camp/concepts.hpp"
+#include "camp/helpers.hpp"
+
+#include "RAJA/pattern/detail/scatter.hpp"
+#include "RAJA/pattern/detail/sort.hpp"
+#include "RAJA/policy/PolicyBase.hpp"
+
+namespace RAJA
+{
+
+/*!
+******************************************************************************
+*
+* \brief  scatter-add execution pattern, target[idx[i]] += values[i]
+*
+* \param[in] p Execution policy
+* \param[in,out] target Pointer or Random-Access Iterator to start of the
+*range the values are added to
+* \param[in] idx_begin Pointer or Random-Access Iterator to start of indices
+*into target
+* \param[in] idx_end Pointer or Random-Access Iterator to end of indices
+*(exclusive)
+* \param[in] values Pointer or Random-Access Iterator to start of the values,
+*one per index
+*
+* \note{Indices may repeat. With a parallel policy each thread sorts the
+*(index, value) pairs of its block of the input and combines the values of
+*repeated indices; the range of indices is then split across threads, each
+*adding the combined values that fall into its part, so no atomics are used.
+*The values added to one element may be summed in any order.}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename TargetIter,
+          typename IdxIter,
+          typename ValIter>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<TargetIter>,
+                    type_traits::is_iterator<IdxIter>,
+                    type_traits::is_iterator<ValIter>>
+scatter_add(const ExecPolicy &p,
+            TargetIter target,
+            IdxIter idx_begin,
+            IdxIter idx_end,
+            ValIter values)
+{
+  static_assert(std::is_integral<detail::sort_key<IdxIter>>::value,
+                "Indices must be integers");
+  static_assert(type_traits::is_random_access_iterator<TargetIter>::value,
+                "Target Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<IdxIter>::value,
+                "Indices Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<ValIter>::value,
+                "Values Iterator must model RandomAccessIterator");
+  if (idx_end - idx_begin <= 0) {
+    return;
+  }
+  impl::scatter::add(p, target, idx_begin, idx_end, values);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  scatter-add execution pattern, target[idx[i]] += values[i]
+*
+* \param[in] p Execution policy
+* \param[in,out] target Pointer or Random-Access Iterator to start of the
+*range the values are added to
+* \param[in] idx Random-Access Container of indices into target
+* \param[in] values Pointer or Random-Access Iterator to start of the values,
+*one per index
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename TargetIter,
+          typename IdxContainer,
+          typename ValIter>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_range<IdxContainer>>
+scatter_add(const ExecPolicy &p,
+            TargetIter target,
+            const IdxContainer &idx,
+            ValIter values)
+{
+  static_assert(type_traits::is_random_access_range<IdxContainer>::value,
+                "Indices Container must model RandomAccessRange");
+  ::RAJA::scatter_add(p, target, std::begin(idx), std::end(idx), values);
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>> scatter_add(
+    Args &&... args)
+{
+  ::RAJA::scatter_add(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
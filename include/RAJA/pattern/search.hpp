@@ -0,0 +1,313 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA search declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_search_HPP
+#define RAJA_search_HPP
+
+#include "RAJA/config.hpp"
+
+#include <iterator>
+#include <type_traits>
+
+#include "camp/concepts.hpp"
+#include "camp/helpers.hpp"
+
+#include "RAJA/pattern/detail/search.hpp"
+#include "RAJA/policy/PolicyBase.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+template <typename Container>
+using ContainerSearchSize = SearchSize<camp::iterator_from<Container>>;
+
+}  // end namespace detail
+
+/*!
+******************************************************************************
+*
+* \brief  find_if execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] begin Pointer or Random-Access Iterator to start of data range
+* \param[in] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[in] pred unary predicate to search for
+*
+* \return position of an element of the range for which pred is true, or
+*end - begin if there is none
+*
+* \note{Parallel policies return whichever match they find first, which
+*need not be the one with the lowest position; use find_first for that.
+*Threads stop searching once any match is found.}
+******************************************************************************
+*/
+template <typename ExecPolicy, typename Iter, typename Predicate>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value
+                            && type_traits::is_iterator<Iter>::value,
+                        detail::SearchSize<Iter>>::type
+find_if(const ExecPolicy &p, Iter begin, Iter end, Predicate pred)
+{
+  using R = detail::SearchVal<Iter>;
+  static_assert(type_traits::is_unary_function<Predicate, bool, R>::value,
+                "Predicate must model UnaryFunction");
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  if (begin == end) {
+    return 0;
+  }
+  return impl::search::find<false>(p, begin, end, pred);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  find first execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] begin Pointer or Random-Access Iterator to start of data range
+* \param[in] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[in] pred unary predicate to search for
+*
+* \return position of the first element of the range for which pred is
+*true, or end - begin if there is none
+*
+* \note{Threads stop searching the parts of the range after the first match
+*found so far.}
+******************************************************************************
+*/
+template <typename ExecPolicy, typename Iter, typename Predicate>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value
+                            && type_traits::is_iterator<Iter>::value,
+                        detail::SearchSize<Iter>>::type
+find_first(const ExecPolicy &p, Iter begin, Iter end, Predicate pred)
+{
+  using R = detail::SearchVal<Iter>;
+  static_assert(type_traits::is_unary_function<Predicate, bool, R>::value,
+                "Predicate must model UnaryFunction");
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  if (begin == end) {
+    return 0;
+  }
+  return impl::search::find<true>(p, begin, end, pred);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  any of execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] begin Pointer or Random-Access Iterator to start of data range
+* \param[in] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[in] pred unary predicate to search for
+*
+* \return whether pred is true for any element of the range
+*
+* \note{Threads stop searching once any match is found.}
+******************************************************************************
+*/
+template <typename ExecPolicy, typename Iter, typename Predicate>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value
+                            && type_traits::is_iterator<Iter>::value,
+                        bool>::type
+any_of(const ExecPolicy &p, Iter begin, Iter end, Predicate pred)
+{
+  using R = detail::SearchVal<Iter>;
+  static_assert(type_traits::is_unary_function<Predicate, bool, R>::value,
+                "Predicate must model UnaryFunction");
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  if (begin == end) {
+    return false;
+  }
+  return impl::search::find<false>(p, begin, end, pred) != end - begin;
+}
+
+/*!
+******************************************************************************
+*
+* \brief  all of execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] begin Pointer or Random-Access Iterator to start of data range
+* \param[in] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[in] pred unary predicate to search for
+*
+* \return whether pred is true for every element of the range, which holds
+*for an empty range
+*
+* \note{Threads stop searching once any element fails pred.}
+******************************************************************************
+*/
+template <typename ExecPolicy, typename Iter, typename Predicate>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value
+                            && type_traits::is_iterator<Iter>::value,
+                        bool>::type
+all_of(const ExecPolicy &p, Iter begin, Iter end, Predicate pred)
+{
+  using R = detail::SearchVal<Iter>;
+  static_assert(type_traits::is_unary_function<Predicate, bool, R>::value,
+                "Predicate must model UnaryFunction");
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  if (begin == end) {
+    return true;
+  }
+  return impl::search::find<false>(
+             p, begin, end, detail::negated<Predicate>{pred})
+         == end - begin;
+}
+
+// =============================================================================
+
+/*!
+******************************************************************************
+*
+* \brief  find_if execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] c Random-Access Container
+* \param[in] pred unary predicate to search for
+*
+* \return position of an element for which pred is true, or the
+*size of the container if there is none
+*
+******************************************************************************
+*/
+template <typename ExecPolicy, typename Container, typename Predicate>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value
+                            && type_traits::is_range<Container>::value,
+                        detail::ContainerSearchSize<Container>>::type
+find_if(const ExecPolicy &p, const Container &c, Predicate pred)
+{
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+  return ::RAJA::find_if(p, std::begin(c), std::end(c), pred);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  find first execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] c Random-Access Container
+* \param[in] pred unary predicate to search for
+*
+* \return position of the first element for which pred is true, or
+*the size of the container if there is none
+*
+******************************************************************************
+*/
+template <typename ExecPolicy, typename Container, typename Predicate>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value
+                            && type_traits::is_range<Container>::value,
+                        detail::ContainerSearchSize<Container>>::type
+find_first(const ExecPolicy &p, const Container &c, Predicate pred)
+{
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+  return ::RAJA::find_first(p, std::begin(c), std::end(c), pred);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  any of execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] c Random-Access Container
+* \param[in] pred unary predicate to search for
+*
+* \return whether pred is true for any element
+*
+******************************************************************************
+*/
+template <typename ExecPolicy, typename Container, typename Predicate>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value
+                            && type_traits::is_range<Container>::value,
+                        bool>::type
+any_of(const ExecPolicy &p, const Container &c, Predicate pred)
+{
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+  return ::RAJA::any_of(p, std::begin(c), std::end(c), pred);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  all of execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] c Random-Access Container
+* \param[in] pred unary predicate to search for
+*
+* \return whether pred is true for every element
+*
+******************************************************************************
+*/
+template <typename ExecPolicy, typename Container, typename Predicate>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value
+                            && type_traits::is_range<Container>::value,
+                        bool>::type
+all_of(const ExecPolicy &p, const Container &c, Predicate pred)
+{
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+  return ::RAJA::all_of(p, std::begin(c), std::end(c), pred);
+}
+
+template <typename ExecPolicy, typename... Args>
+auto find_if(Args &&... args)
+    -> decltype(::RAJA::find_if(ExecPolicy{}, std::forward<Args>(args)...))
+{
+  return ::RAJA::find_if(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+auto find_first(Args &&... args)
+    -> decltype(::RAJA::find_first(ExecPolicy{}, std::forward<Args>(args)...))
+{
+  return ::RAJA::find_first(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+auto any_of(Args &&... args)
+    -> decltype(::RAJA::any_of(ExecPolicy{}, std::forward<Args>(args)...))
+{
+  return ::RAJA::any_of(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+auto all_of(Args &&... args)
+    -> decltype(::RAJA::all_of(ExecPolicy{}, std::forward<Args>(args)...))
+{
+  return ::RAJA::all_of(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
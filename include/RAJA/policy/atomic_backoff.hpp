@@ -0,0 +1,341 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining builtin atomic operations whose
+ *          compare-and-swap loops back off exponentially under contention.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_atomic_backoff_HPP
+#define RAJA_policy_atomic_backoff_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <type_traits>
+#include <vector>
+
+#include "RAJA/util/TypeConvert.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/mutex.hpp"
+
+#include "RAJA/policy/atomic_builtin.hpp"
+
+#if defined(RAJA_COMPILER_MSVC) || (defined(_WIN32) && defined(__INTEL_COMPILER))
+#define RAJA_BACKOFF_ATOMIC_FETCH_OPS 0
+#else
+#define RAJA_BACKOFF_ATOMIC_FETCH_OPS 1
+#endif
+
+namespace RAJA
+{
+
+/*!
+ * Atomic policy that uses the compilers builtin atomic routines like
+ * builtin_atomic, but waits for an exponentially growing, randomized number
+ * of spins after each failed compare-and-swap. Host only.
+ */
+struct backoff_atomic {
+};
+
+/*!
+ * Statistics on the contention seen by backoff_atomic operations, collected
+ * when RAJA is configured with RAJA_ENABLE_ATOMIC_STATS. Only operations
+ * that had to retry are recorded, keyed by the address they updated.
+ */
+namespace atomic_stats
+{
+
+struct entry {
+  //! address updated by the operations
+  void const* address;
+  //! number of operations on the address that had to retry
+  unsigned long long contended;
+  //! total number of failed compare-and-swaps on the address
+  unsigned long long retries;
+};
+
+//! record an operation on address that failed retries times
+void record(void const* address, unsigned retries);
+
+//! the n addresses with the most retries, most retried first
+std::vector<entry> hottest(std::size_t n = 10);
+
+//! write the n addresses with the most retries to os
+void report(std::ostream& os, std::size_t n = 10);
+
+//! discard all statistics collected so far
+void reset();
+
+}  // namespace atomic_stats
+
+namespace detail
+{
+
+/*!
+ * Exponential backoff with jitter: the n-th wait spins a pseudo-random
+ * number of times in [limit / 2, limit), the limit doubling from 2 up to
+ * max_spins, so threads that collided retry at different times.
+ */
+class atomic_backoff
+{
+public:
+  static constexpr unsigned max_spins = 1u << 10;
+
+  RAJA_INLINE atomic_backoff(void const volatile* acc)
+      : state_(static_cast<std::uint32_t>(
+                   reinterpret_cast<std::uintptr_t>(&state_) >> 4) ^
+               static_cast<std::uint32_t>(
+                   reinterpret_cast<std::uintptr_t>(acc)) ^
+               0x9E3779B9u)
+#if defined(RAJA_ENABLE_ATOMIC_STATS)
+        ,
+        acc_(const_cast<void const*>(acc))
+#endif
+  {
+  }
+
+#if defined(RAJA_ENABLE_ATOMIC_STATS)
+  ~atomic_backoff()
+  {
+    if (retries_ > 0) {
+      atomic_stats::record(acc_, retries_);
+    }
+  }
+#endif
+
+  RAJA_INLINE void pause()
+  {
+    // xorshift32, seeded by the stack address so threads differ
+    state_ ^= state_ << 13;
+    state_ ^= state_ >> 17;
+    state_ ^= state_ << 5;
+    const unsigned spins = limit_ / 2 + state_ % (limit_ / 2);
+    for (unsigned i = 0; i < spins; ++i) {
+      cpu_relax();
+    }
+    if (limit_ < max_spins) {
+      limit_ *= 2;
+    }
+#if defined(RAJA_ENABLE_ATOMIC_STATS)
+    ++retries_;
+#endif
+  }
+
+private:
+  std::uint32_t state_;
+  unsigned limit_ = 2;
+#if defined(RAJA_ENABLE_ATOMIC_STATS)
+  void const* acc_;
+  unsigned retries_ = 0;
+#endif
+};
+
+//! unsigned integer with the size of T, for comparing values bitwise
+template <typename T>
+using backoff_bits = typename std::conditional<sizeof(T) == sizeof(unsigned),
+                                               unsigned,
+                                               unsigned long long>::type;
+
+/*!
+ * Compare-and-swap loop applying oper to *acc, backing off after every
+ * failed compare-and-swap. The loop stops early once sc holds for the
+ * current value. Returns the OLD value that was replaced by the result of
+ * this operation.
+ */
+template <typename T, typename OPER, typename ShortCircuit>
+RAJA_INLINE T backoff_atomic_CAS_oper_sc(T volatile* acc,
+                                         OPER const& oper,
+                                         ShortCircuit const& sc)
+{
+  static_assert(sizeof(T) == 4 || sizeof(T) == 8,
+                "backoff atomic cas assumes 4 or 8 byte targets");
+  using Bits = backoff_bits<T>;
+  Bits oldval = RAJA::util::reinterp_A_as_B<T, Bits>(*acc);
+  Bits newval = RAJA::util::reinterp_A_as_B<T, Bits>(
+      oper(RAJA::util::reinterp_A_as_B<Bits, T>(oldval)));
+  Bits readback = builtin_atomic_CAS((Bits volatile*)acc, oldval, newval);
+  if (readback != oldval) {
+    atomic_backoff backoff(acc);
+    do {
+      if (sc(RAJA::util::reinterp_A_as_B<Bits, T>(readback))) {
+        oldval = readback;
+        break;
+      }
+      backoff.pause();
+      // reload, since the value seen by the failed CAS is likely stale
+      oldval = RAJA::util::reinterp_A_as_B<T, Bits>(*acc);
+      newval = RAJA::util::reinterp_A_as_B<T, Bits>(
+          oper(RAJA::util::reinterp_A_as_B<Bits, T>(oldval)));
+    } while ((readback = builtin_atomic_CAS(
+                  (Bits volatile*)acc, oldval, newval)) != oldval);
+  }
+  return RAJA::util::reinterp_A_as_B<Bits, T>(oldval);
+}
+
+template <typename T, typename OPER>
+RAJA_INLINE T backoff_atomic_CAS_oper(T volatile* acc, OPER const& oper)
+{
+  return backoff_atomic_CAS_oper_sc(acc, oper, [](T const&) {
+    return false;
+  });
+}
+
+//! integral operations that the hardware performs without retrying
+template <typename T>
+using backoff_fetch_op =
+    std::integral_constant<bool,
+                           RAJA_BACKOFF_ATOMIC_FETCH_OPS &&
+                               std::is_integral<T>::value>;
+
+//
+// Fetch-and-op for integers where the compiler has __atomic builtins, and
+// the backoff compare-and-swap loop otherwise.
+//
+#define RAJA_BACKOFF_FETCH_OP(name, builtin, op)                            \
+  template <typename T>                                                   \
+  RAJA_INLINE T name(std::false_type, T volatile* acc, T value)           \
+  {                                                                       \
+    return backoff_atomic_CAS_oper(acc, [=](T a) { return a op value; }); \
+  }
+#if RAJA_BACKOFF_ATOMIC_FETCH_OPS
+#define RAJA_BACKOFF_NATIVE_FETCH_OP(name, builtin, op)         \
+  RAJA_BACKOFF_FETCH_OP(name, builtin, op)                      \
+  template <typename T>                                         \
+  RAJA_INLINE T name(std::true_type, T volatile* acc, T value)  \
+  {                                                             \
+    return builtin(acc, value, __ATOMIC_ACQ_REL);               \
+  }
+#else
+#define RAJA_BACKOFF_NATIVE_FETCH_OP(name, builtin, op) \
+  RAJA_BACKOFF_FETCH_OP(name, builtin, op)
+#endif
+
+RAJA_BACKOFF_NATIVE_FETCH_OP(backoff_fetch_add, __atomic_fetch_add, +)
+RAJA_BACKOFF_NATIVE_FETCH_OP(backoff_fetch_sub, __atomic_fetch_sub, -)
+RAJA_BACKOFF_NATIVE_FETCH_OP(backoff_fetch_and, __atomic_fetch_and, &)
+RAJA_BACKOFF_NATIVE_FETCH_OP(backoff_fetch_or, __atomic_fetch_or, |)
+RAJA_BACKOFF_NATIVE_FETCH_OP(backoff_fetch_xor, __atomic_fetch_xor, ^)
+
+#undef RAJA_BACKOFF_NATIVE_FETCH_OP
+#undef RAJA_BACKOFF_FETCH_OP
+
+}  // namespace detail
+
+template <typename T>
+RAJA_INLINE T atomicAdd(backoff_atomic, T volatile* acc, T value)
+{
+  return detail::backoff_fetch_add(
+      detail::backoff_fetch_op<T>{}, acc, value);
+}
+
+template <typename T>
+RAJA_INLINE T atomicSub(backoff_atomic, T volatile* acc, T value)
+{
+  return detail::backoff_fetch_sub(
+      detail::backoff_fetch_op<T>{}, acc, value);
+}
+
+template <typename T>
+RAJA_INLINE T atomicMin(backoff_atomic, T volatile* acc, T value)
+{
+  if (*acc < value) {
+    return *acc;
+  }
+  return detail::backoff_atomic_CAS_oper_sc(
+      acc,
+      [=](T a) { return a < value ? a : value; },
+      [=](T current) { return current < value; });
+}
+
+template <typename T>
+RAJA_INLINE T atomicMax(backoff_atomic, T volatile* acc, T value)
+{
+  if (*acc > value) {
+    return *acc;
+  }
+  return detail::backoff_atomic_CAS_oper_sc(
+      acc,
+      [=](T a) { return a > value ? a : value; },
+      [=](T current) { return current > value; });
+}
+
+template <typename T>
+RAJA_INLINE T atomicInc(backoff_atomic, T volatile* acc)
+{
+  return atomicAdd(backoff_atomic{}, acc, T(1));
+}
+
+template <typename T>
+RAJA_INLINE T atomicInc(backoff_atomic, T volatile* acc, T val)
+{
+  return detail::backoff_atomic_CAS_oper(acc, [=](T old) {
+    return ((old >= val) ? 0 : (old + 1));
+  });
+}
+
+template <typename T>
+RAJA_INLINE T atomicDec(backoff_atomic, T volatile* acc)
+{
+  return atomicSub(backoff_atomic{}, acc, T(1));
+}
+
+template <typename T>
+RAJA_INLINE T atomicDec(backoff_atomic, T volatile* acc, T val)
+{
+  return detail::backoff_atomic_CAS_oper(acc, [=](T old) {
+    return (((old == 0) | (old > val)) ? val : (old - 1));
+  });
+}
+
+template <typename T>
+RAJA_INLINE T atomicAnd(backoff_atomic, T volatile* acc, T value)
+{
+  return detail::backoff_fetch_and(
+      detail::backoff_fetch_op<T>{}, acc, value);
+}
+
+template <typename T>
+RAJA_INLINE T atomicOr(backoff_atomic, T volatile* acc, T value)
+{
+  return detail::backoff_fetch_or(
+      detail::backoff_fetch_op<T>{}, acc, value);
+}
+
+template <typename T>
+RAJA_INLINE T atomicXor(backoff_atomic, T volatile* acc, T value)
+{
+  return detail::backoff_fetch_xor(
+      detail::backoff_fetch_op<T>{}, acc, value);
+}
+
+template <typename T>
+RAJA_INLINE T atomicExchange(backoff_atomic, T volatile* acc, T value)
+{
+  return detail::backoff_atomic_CAS_oper(acc, [=](T) { return value; });
+}
+
+template <typename T>
+RAJA_INLINE T atomicCAS(backoff_atomic, T volatile* acc, T compare, T value)
+{
+  return detail::builtin_atomic_CAS(acc, compare, value);
+}
+
+}  // namespace RAJA
+
+// make sure this define doesn't bleed out of this header
+#undef RAJA_BACKOFF_ATOMIC_FETCH_OPS
+
+#endif
@@ -20,8 +20,18 @@
 
 #include "RAJA/config.hpp"
 
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if defined(RAJA_COMPILER_MSVC)
+#include <intrin.h>
+#endif
+
 #include "RAJA/util/TypeConvert.hpp"
 #include "RAJA/util/macros.hpp"
+#include "RAJA/util/mutex.hpp"
 
 #if defined(RAJA_ENABLE_HIP)
 #define RAJA_DEVICE_HIP RAJA_HOST_DEVICE
@@ -101,6 +111,210 @@ RAJA_INLINE unsigned long long builtin_atomic_CAS(
 #endif  // RAJA_COMPILER_MSVC
 
 
+/*!
+ * 16 byte value for the double-width compare-and-swap, lo holding the bytes
+ * at the lower address.
+ */
+struct builtin_atomic_wide {
+  unsigned long long lo;
+  unsigned long long hi;
+};
+
+RAJA_INLINE bool operator==(builtin_atomic_wide const &a,
+                            builtin_atomic_wide const &b)
+{
+  return a.lo == b.lo && a.hi == b.hi;
+}
+
+RAJA_INLINE bool operator!=(builtin_atomic_wide const &a,
+                            builtin_atomic_wide const &b)
+{
+  return !(a == b);
+}
+
+//! copy the bytes of a into a B, for types that reinterp_A_as_B can't copy
+template <typename B, typename A>
+RAJA_INLINE B builtin_bit_copy(A const &a)
+{
+  static_assert(sizeof(A) == sizeof(B), "A and B must be same size");
+  B b;
+  std::memcpy(static_cast<void *>(&b), &a, sizeof(B));
+  return b;
+}
+
+#if defined(__SIZEOF_INT128__) && defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_16)
+
+#define RAJA_BUILTIN_ATOMIC_WIDE_NATIVE
+RAJA_INLINE builtin_atomic_wide builtin_atomic_CAS_wide_native(
+    builtin_atomic_wide volatile *acc,
+    builtin_atomic_wide compare,
+    builtin_atomic_wide value)
+{
+  // the __atomic builtins call into libatomic for 16 byte operands, the
+  // __sync ones are expanded inline when the target has the instruction
+  unsigned __int128 old = __sync_val_compare_and_swap(
+      (unsigned __int128 volatile *)acc,
+      builtin_bit_copy<unsigned __int128>(compare),
+      builtin_bit_copy<unsigned __int128>(value));
+  return builtin_bit_copy<builtin_atomic_wide>(old);
+}
+
+#elif defined(__x86_64__) && defined(__GNUC__)
+
+#define RAJA_BUILTIN_ATOMIC_WIDE_NATIVE
+RAJA_INLINE builtin_atomic_wide builtin_atomic_CAS_wide_native(
+    builtin_atomic_wide volatile *acc,
+    builtin_atomic_wide compare,
+    builtin_atomic_wide value)
+{
+  // cmpxchg16b leaves the old value in rdx:rax whether or not it swapped
+  __asm__ __volatile__("lock cmpxchg16b %0"
+                       : "+m"(*(unsigned __int128 volatile *)acc),
+                         "+a"(compare.lo),
+                         "+d"(compare.hi)
+                       : "b"(value.lo), "c"(value.hi)
+                       : "memory", "cc");
+  return compare;
+}
+
+#elif defined(RAJA_COMPILER_MSVC) && defined(_M_X64)
+
+#define RAJA_BUILTIN_ATOMIC_WIDE_NATIVE
+RAJA_INLINE builtin_atomic_wide builtin_atomic_CAS_wide_native(
+    builtin_atomic_wide volatile *acc,
+    builtin_atomic_wide compare,
+    builtin_atomic_wide value)
+{
+  __int64 old[2] = {static_cast<__int64>(compare.lo),
+                    static_cast<__int64>(compare.hi)};
+  _InterlockedCompareExchange128((__int64 volatile *)acc,
+                                 static_cast<__int64>(value.hi),
+                                 static_cast<__int64>(value.lo),
+                                 old);
+  return builtin_atomic_wide{static_cast<unsigned long long>(old[0]),
+                             static_cast<unsigned long long>(old[1])};
+}
+
+#endif
+
+//! number of locks serializing 16 byte operations without native support
+constexpr std::size_t builtin_atomic_wide_locks = 64;
+
+struct alignas(64) builtin_atomic_wide_lock {
+  spin_mutex mutex;
+};
+
+RAJA_INLINE spin_mutex &builtin_atomic_wide_lock_for(void const volatile *acc)
+{
+  static builtin_atomic_wide_lock locks[builtin_atomic_wide_locks];
+  return locks[(reinterpret_cast<std::uintptr_t>(acc) >> 4) %
+               builtin_atomic_wide_locks]
+      .mutex;
+}
+
+/*!
+ * 16 byte compare-and-swap under one of a fixed set of locks chosen by
+ * address. All the operations on a location use the same lock, so they are
+ * atomic with respect to each other, but not to plain stores.
+ */
+RAJA_INLINE builtin_atomic_wide builtin_atomic_CAS_wide_locked(
+    builtin_atomic_wide volatile *acc,
+    builtin_atomic_wide compare,
+    builtin_atomic_wide value)
+{
+  lock_guard<spin_mutex> guard(builtin_atomic_wide_lock_for(acc));
+  builtin_atomic_wide old;
+  std::memcpy(&old, const_cast<builtin_atomic_wide *>(acc), sizeof(old));
+  if (old == compare) {
+    std::memcpy(const_cast<builtin_atomic_wide *>(acc), &value, sizeof(value));
+  }
+  return old;
+}
+
+/*!
+ * 16 byte compare-and-swap. The native instruction requires 16 byte
+ * alignment, other locations and targets without it use the locks above;
+ * the choice only depends on the address, so the two never mix on one
+ * location.
+ */
+RAJA_INLINE builtin_atomic_wide builtin_atomic_CAS(
+    builtin_atomic_wide volatile *acc,
+    builtin_atomic_wide compare,
+    builtin_atomic_wide value)
+{
+#if defined(RAJA_BUILTIN_ATOMIC_WIDE_NATIVE)
+  if (reinterpret_cast<std::uintptr_t>(acc) % 16 == 0) {
+    return builtin_atomic_CAS_wide_native(acc, compare, value);
+  }
+#endif
+  return builtin_atomic_CAS_wide_locked(acc, compare, value);
+}
+
+
+template <size_t BYTES>
+struct builtin_atomic_bits {
+};
+
+template <>
+struct builtin_atomic_bits<4> {
+  using type = unsigned;
+};
+
+template <>
+struct builtin_atomic_bits<8> {
+  using type = unsigned long long;
+};
+
+template <>
+struct builtin_atomic_bits<16> {
+  using type = builtin_atomic_wide;
+};
+
+/*!
+ * Compare-and-swap of any 4, 8 or 16 byte trivially copyable type, such as
+ * a (value, index) pair. Values are copied bytewise, so unlike the versions
+ * below T need not be a scalar, and compare is matched bitwise, padding
+ * included. For types with padding, compare must hold bytes read from acc.
+ */
+template <typename T>
+RAJA_INLINE T builtin_atomic_CAS_object(T volatile *acc, T compare, T value)
+{
+  using Bits = typename builtin_atomic_bits<sizeof(T)>::type;
+  return builtin_bit_copy<T>(
+      builtin_atomic_CAS((Bits volatile *)acc,
+                         builtin_bit_copy<Bits>(compare),
+                         builtin_bit_copy<Bits>(value)));
+}
+
+/*!
+ * Compare-and-swap loop applying oper to *acc for any type accepted by
+ * builtin_atomic_CAS_object. The loop stops early once sc holds for the
+ * current value. Returns the OLD value that was replaced by the result of
+ * this operation.
+ */
+template <typename T, typename OPER, typename ShortCircuit>
+RAJA_INLINE T builtin_atomic_CAS_object_oper_sc(T volatile *acc,
+                                                OPER const &oper,
+                                                ShortCircuit const &sc)
+{
+  using Bits = typename builtin_atomic_bits<sizeof(T)>::type;
+  // the loop works on the bytes so padding in T can't make it spin; a torn
+  // first read only makes the first compare-and-swap fail
+  Bits oldval;
+  std::memcpy(&oldval, const_cast<T const *>(acc), sizeof(T));
+  Bits newval = builtin_bit_copy<Bits>(oper(builtin_bit_copy<T>(oldval)));
+  Bits readback;
+  while ((readback = builtin_atomic_CAS((Bits volatile *)acc,
+                                        oldval,
+                                        newval)) != oldval) {
+    oldval = readback;
+    if (sc(builtin_bit_copy<T>(oldval))) break;
+    newval = builtin_bit_copy<Bits>(oper(builtin_bit_copy<T>(oldval)));
+  }
+  return builtin_bit_copy<T>(oldval);
+}
+
+
 template <typename T>
 RAJA_DEVICE_HIP RAJA_INLINE
     typename std::enable_if<sizeof(T) == sizeof(unsigned), T>::type
@@ -123,13 +337,20 @@ RAJA_DEVICE_HIP RAJA_INLINE
       RAJA::util::reinterp_A_as_B<T, unsigned long long>(value)));
 }
 
+template <typename T>
+RAJA_INLINE typename std::enable_if<sizeof(T) == 16, T>::type
+builtin_atomic_CAS(T volatile *acc, T compare, T value)
+{
+  return builtin_atomic_CAS_object(acc, compare, value);
+}
+
 
 template <size_t BYTES>
 struct BuiltinAtomicCAS;
 template <size_t BYTES>
 struct BuiltinAtomicCAS {
-  static_assert(!(BYTES == 4 || BYTES == 8),
-                "builtin atomic cas assumes 4 or 8 byte targets");
+  static_assert(!(BYTES == 4 || BYTES == 8 || BYTES == 16),
+                "builtin atomic cas assumes 4, 8 or 16 byte targets");
 };
 
 
@@ -208,6 +429,24 @@ struct BuiltinAtomicCAS<8> {
 
 };
 
+template <>
+struct BuiltinAtomicCAS<16> {
+
+  /*!
+   * Generic impementation of any atomic 128-bit operator.
+   * Implementation uses the 16 byte CAS operator, natively where the target
+   * has it and under a lock otherwise.
+   * Returns the OLD value that was replaced by the result of this operation.
+   */
+  template <typename T, typename OPER, typename ShortCircuit>
+  RAJA_INLINE T operator()(T volatile *acc,
+                           OPER const &oper,
+                           ShortCircuit const &sc) const
+  {
+    return builtin_atomic_CAS_object_oper_sc(acc, oper, sc);
+  }
+};
+
 
 /*!
  * Generic impementation of any atomic 32-bit or 64-bit operator that can be
@@ -357,5 +596,6 @@ atomicCAS(builtin_atomic, T volatile *acc, T compare, T value)
 
 // make sure this define doesn't bleed out of this header
 #undef RAJA_AUTO_ATOMIC
+#undef RAJA_BUILTIN_ATOMIC_WIDE_NATIVE
 
 #endif
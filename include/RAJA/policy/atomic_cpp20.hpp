@@ -0,0 +1,408 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining atomic operations built on
+ *          std::atomic_ref with an explicit memory order.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_atomic_cpp20_HPP
+#define RAJA_policy_atomic_cpp20_HPP
+
+#include "RAJA/config.hpp"
+
+#include <atomic>
+#include <cstring>
+#include <type_traits>
+
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/policy/atomic_builtin.hpp"
+
+//
+// std::atomic_ref is used where the standard library provides it. Before
+// C++20 the GNU __atomic builtins take the same memory orders, and other
+// compilers fall back to the sequentially consistent builtin_atomic
+// compare-and-swap.
+//
+#if defined(__cpp_lib_atomic_ref)
+#define RAJA_CPP20_ATOMIC_REF 1
+#elif !defined(RAJA_COMPILER_MSVC)
+#define RAJA_CPP20_ATOMIC_GNU 1
+#endif
+
+namespace RAJA
+{
+
+/*!
+ * Atomic policy performing each operation as a single std::atomic_ref
+ * operation with memory order Order. Host only.
+ *
+ * Relaxed ordering suits accumulations whose result is read after the
+ * loop; use acquire/release orders when other data is published through
+ * the atomic.
+ */
+template <std::memory_order Order = std::memory_order_relaxed>
+struct cpp20_atomic_explicit {
+};
+
+//! Atomic policy using std::atomic_ref with relaxed memory order
+using cpp20_atomic = cpp20_atomic_explicit<std::memory_order_relaxed>;
+
+//! Atomic policy using std::atomic_ref with sequentially consistent order
+using cpp20_atomic_seq_cst =
+    cpp20_atomic_explicit<std::memory_order_seq_cst>;
+
+namespace detail
+{
+
+//! order for loads and failed compare-and-swaps, which can't release
+constexpr std::memory_order cpp20_atomic_load_order(std::memory_order order)
+{
+  return order == std::memory_order_acq_rel
+             ? std::memory_order_acquire
+             : (order == std::memory_order_release ? std::memory_order_relaxed
+                                                   : order);
+}
+
+#if defined(RAJA_CPP20_ATOMIC_REF)
+
+template <typename T>
+RAJA_INLINE std::atomic_ref<T> cpp20_atomic_ref(T volatile *acc)
+{
+  static_assert(std::atomic_ref<T>::is_always_lock_free,
+                "cpp20_atomic requires a lock-free type, which would "
+                "otherwise need libatomic; use builtin_atomic instead");
+  return std::atomic_ref<T>(*const_cast<T *>(acc));
+}
+
+template <std::memory_order Order, typename T>
+RAJA_INLINE T cpp20_atomic_load(T volatile *acc)
+{
+  return cpp20_atomic_ref(acc).load(cpp20_atomic_load_order(Order));
+}
+
+template <std::memory_order Order, typename T>
+RAJA_INLINE T cpp20_atomic_exchange(T volatile *acc, T value)
+{
+  return cpp20_atomic_ref(acc).exchange(value, Order);
+}
+
+/*!
+ * Replace *acc by desired if it bitwise matches expected. Otherwise
+ * expected is set to the current value and false is returned.
+ */
+template <std::memory_order Order, typename T>
+RAJA_INLINE bool cpp20_atomic_compare_exchange(T volatile *acc,
+                                               T &expected,
+                                               T desired)
+{
+  return cpp20_atomic_ref(acc).compare_exchange_strong(
+      expected, desired, Order, cpp20_atomic_load_order(Order));
+}
+
+#elif defined(RAJA_CPP20_ATOMIC_GNU)
+
+//! acc as the argument of the __atomic builtins, which call libatomic for
+//! types they can't update without a lock
+template <typename T>
+RAJA_INLINE T *cpp20_atomic_ptr(T volatile *acc)
+{
+  static_assert(__atomic_always_lock_free(sizeof(T), 0),
+                "cpp20_atomic requires a lock-free type, which would "
+                "otherwise need libatomic; use builtin_atomic instead");
+  return const_cast<T *>(acc);
+}
+
+template <std::memory_order Order, typename T>
+RAJA_INLINE T cpp20_atomic_load(T volatile *acc)
+{
+  T ret;
+  __atomic_load(cpp20_atomic_ptr(acc),
+                &ret,
+                static_cast<int>(cpp20_atomic_load_order(Order)));
+  return ret;
+}
+
+template <std::memory_order Order, typename T>
+RAJA_INLINE T cpp20_atomic_exchange(T volatile *acc, T value)
+{
+  T ret;
+  __atomic_exchange(cpp20_atomic_ptr(acc),
+                    &value,
+                    &ret,
+                    static_cast<int>(Order));
+  return ret;
+}
+
+template <std::memory_order Order, typename T>
+RAJA_INLINE bool cpp20_atomic_compare_exchange(T volatile *acc,
+                                               T &expected,
+                                               T desired)
+{
+  return __atomic_compare_exchange(
+      cpp20_atomic_ptr(acc),
+      &expected,
+      &desired,
+      false,
+      static_cast<int>(Order),
+      static_cast<int>(cpp20_atomic_load_order(Order)));
+}
+
+#else
+
+template <std::memory_order, typename T>
+RAJA_INLINE T cpp20_atomic_load(T volatile *acc)
+{
+  return *acc;
+}
+
+template <std::memory_order Order, typename T>
+RAJA_INLINE bool cpp20_atomic_compare_exchange(T volatile *acc,
+                                               T &expected,
+                                               T desired)
+{
+  const T old = builtin_atomic_CAS_object(acc, expected, desired);
+  const bool swapped = std::memcmp(&old, &expected, sizeof(T)) == 0;
+  expected = old;
+  return swapped;
+}
+
+template <std::memory_order Order, typename T>
+RAJA_INLINE T cpp20_atomic_exchange(T volatile *acc, T value)
+{
+  T expected = cpp20_atomic_load<Order>(acc);
+  while (!cpp20_atomic_compare_exchange<Order>(acc, expected, value)) {
+  }
+  return expected;
+}
+
+#endif
+
+/*!
+ * Compare-and-swap loop applying oper to *acc. The loop stops early once
+ * sc holds for the current value. Returns the OLD value that was replaced
+ * by the result of this operation.
+ */
+template <std::memory_order Order,
+          typename T,
+          typename OPER,
+          typename ShortCircuit>
+RAJA_INLINE T cpp20_atomic_CAS_oper_sc(T volatile *acc,
+                                       OPER const &oper,
+                                       ShortCircuit const &sc)
+{
+  T expected = cpp20_atomic_load<Order>(acc);
+  while (!sc(expected) &&
+         !cpp20_atomic_compare_exchange<Order>(acc, expected, oper(expected))) {
+  }
+  return expected;
+}
+
+template <std::memory_order Order, typename T, typename OPER>
+RAJA_INLINE T cpp20_atomic_CAS_oper(T volatile *acc, OPER const &oper)
+{
+  return cpp20_atomic_CAS_oper_sc<Order>(acc, oper, [](T const &) {
+    return false;
+  });
+}
+
+//! types with a native fetch_add and fetch_sub
+template <typename T>
+using cpp20_atomic_native_add = std::integral_constant<
+    bool,
+#if defined(RAJA_CPP20_ATOMIC_REF) && defined(__cpp_lib_atomic_float)
+    std::is_integral<T>::value || std::is_floating_point<T>::value
+#elif defined(RAJA_CPP20_ATOMIC_REF) || defined(RAJA_CPP20_ATOMIC_GNU)
+    std::is_integral<T>::value
+#else
+    false
+#endif
+    >;
+
+//! types with a native fetch_and, fetch_or and fetch_xor
+template <typename T>
+using cpp20_atomic_native_bitwise = std::integral_constant<
+    bool,
+#if defined(RAJA_CPP20_ATOMIC_REF) || defined(RAJA_CPP20_ATOMIC_GNU)
+    std::is_integral<T>::value
+#else
+    false
+#endif
+    >;
+
+//
+// Fetch-and-op through std::atomic_ref or the __atomic builtins where the
+// type has it, and the compare-and-swap loop otherwise.
+//
+#define RAJA_CPP20_ATOMIC_FETCH_OP(name, member, builtin, op)             \
+  template <std::memory_order Order, typename T>                          \
+  RAJA_INLINE T name(std::false_type, T volatile *acc, T value)           \
+  {                                                                       \
+    return cpp20_atomic_CAS_oper<Order>(acc,                              \
+                                        [=](T a) { return a op value; }); \
+  }
+#if defined(RAJA_CPP20_ATOMIC_REF)
+#define RAJA_CPP20_ATOMIC_NATIVE_FETCH_OP(name, member, builtin, op) \
+  RAJA_CPP20_ATOMIC_FETCH_OP(name, member, builtin, op)              \
+  template <std::memory_order Order, typename T>                     \
+  RAJA_INLINE T name(std::true_type, T volatile *acc, T value)       \
+  {                                                                  \
+    return cpp20_atomic_ref(acc).member(value, Order);               \
+  }
+#elif defined(RAJA_CPP20_ATOMIC_GNU)
+#define RAJA_CPP20_ATOMIC_NATIVE_FETCH_OP(name, member, builtin, op)  \
+  RAJA_CPP20_ATOMIC_FETCH_OP(name, member, builtin, op)               \
+  template <std::memory_order Order, typename T>                      \
+  RAJA_INLINE T name(std::true_type, T volatile *acc, T value)        \
+  {                                                                   \
+    return builtin(                                                   \
+        cpp20_atomic_ptr(acc), value, static_cast<int>(Order));       \
+  }
+#else
+#define RAJA_CPP20_ATOMIC_NATIVE_FETCH_OP(name, member, builtin, op) \
+  RAJA_CPP20_ATOMIC_FETCH_OP(name, member, builtin, op)
+#endif
+
+RAJA_CPP20_ATOMIC_NATIVE_FETCH_OP(cpp20_atomic_fetch_add,
+                                  fetch_add,
+                                  __atomic_fetch_add,
+                                  +)
+RAJA_CPP20_ATOMIC_NATIVE_FETCH_OP(cpp20_atomic_fetch_sub,
+                                  fetch_sub,
+                                  __atomic_fetch_sub,
+                                  -)
+RAJA_CPP20_ATOMIC_NATIVE_FETCH_OP(cpp20_atomic_fetch_and,
+                                  fetch_and,
+                                  __atomic_fetch_and,
+                                  &)
+RAJA_CPP20_ATOMIC_NATIVE_FETCH_OP(cpp20_atomic_fetch_or,
+                                  fetch_or,
+                                  __atomic_fetch_or,
+                                  |)
+RAJA_CPP20_ATOMIC_NATIVE_FETCH_OP(cpp20_atomic_fetch_xor,
+                                  fetch_xor,
+                                  __atomic_fetch_xor,
+                                  ^)
+
+#undef RAJA_CPP20_ATOMIC_NATIVE_FETCH_OP
+#undef RAJA_CPP20_ATOMIC_FETCH_OP
+
+}  // namespace detail
+
+template <std::memory_order Order, typename T>
+RAJA_INLINE T atomicAdd(cpp20_atomic_explicit<Order>, T volatile *acc, T value)
+{
+  return detail::cpp20_atomic_fetch_add<Order>(
+      detail::cpp20_atomic_native_add<T>{}, acc, value);
+}
+
+template <std::memory_order Order, typename T>
+RAJA_INLINE T atomicSub(cpp20_atomic_explicit<Order>, T volatile *acc, T value)
+{
+  return detail::cpp20_atomic_fetch_sub<Order>(
+      detail::cpp20_atomic_native_add<T>{}, acc, value);
+}
+
+template <std::memory_order Order, typename T>
+RAJA_INLINE T atomicMin(cpp20_atomic_explicit<Order>, T volatile *acc, T value)
+{
+  return detail::cpp20_atomic_CAS_oper_sc<Order>(
+      acc,
+      [=](T a) { return a < value ? a : value; },
+      [=](T current) { return !(value < current); });
+}
+
+template <std::memory_order Order, typename T>
+RAJA_INLINE T atomicMax(cpp20_atomic_explicit<Order>, T volatile *acc, T value)
+{
+  return detail::cpp20_atomic_CAS_oper_sc<Order>(
+      acc,
+      [=](T a) { return a > value ? a : value; },
+      [=](T current) { return !(value > current); });
+}
+
+template <std::memory_order Order, typename T>
+RAJA_INLINE T atomicInc(cpp20_atomic_explicit<Order>, T volatile *acc)
+{
+  return atomicAdd(cpp20_atomic_explicit<Order>{}, acc, T(1));
+}
+
+template <std::memory_order Order, typename T>
+RAJA_INLINE T atomicInc(cpp20_atomic_explicit<Order>, T volatile *acc, T val)
+{
+  return detail::cpp20_atomic_CAS_oper<Order>(acc, [=](T old) {
+    return ((old >= val) ? 0 : (old + 1));
+  });
+}
+
+template <std::memory_order Order, typename T>
+RAJA_INLINE T atomicDec(cpp20_atomic_explicit<Order>, T volatile *acc)
+{
+  return atomicSub(cpp20_atomic_explicit<Order>{}, acc, T(1));
+}
+
+template <std::memory_order Order, typename T>
+RAJA_INLINE T atomicDec(cpp20_atomic_explicit<Order>, T volatile *acc, T val)
+{
+  return detail::cpp20_atomic_CAS_oper<Order>(acc, [=](T old) {
+    return (((old == 0) | (old > val)) ? val : (old - 1));
+  });
+}
+
+template <std::memory_order Order, typename T>
+RAJA_INLINE T atomicAnd(cpp20_atomic_explicit<Order>, T volatile *acc, T value)
+{
+  return detail::cpp20_atomic_fetch_and<Order>(
+      detail::cpp20_atomic_native_bitwise<T>{}, acc, value);
+}
+
+template <std::memory_order Order, typename T>
+RAJA_INLINE T atomicOr(cpp20_atomic_explicit<Order>, T volatile *acc, T value)
+{
+  return detail::cpp20_atomic_fetch_or<Order>(
+      detail::cpp20_atomic_native_bitwise<T>{}, acc, value);
+}
+
+template <std::memory_order Order, typename T>
+RAJA_INLINE T atomicXor(cpp20_atomic_explicit<Order>, T volatile *acc, T value)
+{
+  return detail::cpp20_atomic_fetch_xor<Order>(
+      detail::cpp20_atomic_native_bitwise<T>{}, acc, value);
+}
+
+template <std::memory_order Order, typename T>
+RAJA_INLINE T atomicExchange(cpp20_atomic_explicit<Order>,
+                             T volatile *acc,
+                             T value)
+{
+  return detail::cpp20_atomic_exchange<Order>(acc, value);
+}
+
+template <std::memory_order Order, typename T>
+RAJA_INLINE T atomicCAS(cpp20_atomic_explicit<Order>,
+                        T volatile *acc,
+                        T compare,
+                        T value)
+{
+  detail::cpp20_atomic_compare_exchange<Order>(acc, compare, value);
+  return compare;
+}
+
+}  // namespace RAJA
+
+// make sure these defines don't bleed out of this header
+#undef RAJA_CPP20_ATOMIC_REF
+#undef RAJA_CPP20_ATOMIC_GNU
+
+#endif
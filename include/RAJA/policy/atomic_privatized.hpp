@@ -0,0 +1,419 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining the privatized atomic policy for
+ *          atomic Views.
+ *
+ *          Updates through a privatized atomic View go to a private buffer
+ *          owned by each copy of the View, i.e. by each thread or task of a
+ *          parallel loop whose body captures the View by value. The buffers
+ *          are added into the target View when the copies are destroyed at
+ *          the end of the loop.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_atomic_privatized_HPP
+#define RAJA_policy_atomic_privatized_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "RAJA/util/View.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/pattern/detail/privatized_copy.hpp"
+
+#include "RAJA/policy/atomic_auto.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * Atomic policy for Views whose updates are accumulated in per-thread
+ * private buffers and added into the View at the end of the loop. Only
+ * additive updates (+=, -=, ++, --) are supported, and the View must not
+ * be read in the same loop.
+ */
+struct privatized_atomic {
+};
+
+namespace detail
+{
+
+//! targets of at most this many elements are privatized with dense copies,
+//! larger ones with hashed overlays of the touched elements
+constexpr Index_type privatized_dense_limit = Index_type(1) << 16;
+
+//! minimum number of target elements covered by one merge lock
+constexpr Index_type privatized_stripe_size = 4096;
+
+//! maximum number of merge locks for one target
+constexpr Index_type privatized_max_stripes = 1024;
+
+//! initial number of slots of a hashed overlay, a power of two
+constexpr Index_type privatized_overlay_slots = 1024;
+
+//
+// Total number of elements addressed by a layout.
+//
+template <typename Layout>
+RAJA_INLINE auto layout_extent(Layout const& layout)
+    -> decltype(static_cast<Index_type>(layout.size()))
+{
+  return static_cast<Index_type>(layout.size());
+}
+
+template <camp::idx_t... RangeInts, typename IdxLin>
+RAJA_INLINE Index_type layout_extent(
+    internal::OffsetLayout_impl<camp::idx_seq<RangeInts...>, IdxLin> const&
+        layout)
+{
+  return static_cast<Index_type>(layout.base_.size());
+}
+
+//
+// Data pointer and layout of a View or TypedView.
+//
+template <typename ValueType, typename LayoutType, typename PointerType>
+RAJA_INLINE ValueType* view_origin(
+    View<ValueType, LayoutType, PointerType> const& view)
+{
+  return &view.data[0];
+}
+
+template <typename ValueType, typename LayoutType, typename PointerType>
+RAJA_INLINE Index_type
+view_extent(View<ValueType, LayoutType, PointerType> const& view)
+{
+  return layout_extent(view.layout);
+}
+
+template <typename ValueType,
+          typename PointerType,
+          typename LayoutType,
+          typename... IndexTypes>
+RAJA_INLINE ValueType* view_origin(
+    TypedViewBase<ValueType, PointerType, LayoutType, IndexTypes...> const&
+        view)
+{
+  return view_origin(view.base_);
+}
+
+template <typename ValueType,
+          typename PointerType,
+          typename LayoutType,
+          typename... IndexTypes>
+RAJA_INLINE Index_type view_extent(
+    TypedViewBase<ValueType, PointerType, LayoutType, IndexTypes...> const&
+        view)
+{
+  return view_extent(view.base_);
+}
+
+/*!
+ * Target of a privatized atomic View, shared by all of its copies. The
+ * target is split into stripes guarded by their own lock so that several
+ * private buffers can be added into it at the same time.
+ */
+template <typename T>
+struct privatized_target {
+  T* data;
+  Index_type size;
+  Index_type stripe;
+  Index_type num_stripes;
+  std::unique_ptr<std::mutex[]> locks;
+  //! rotates the first stripe merged by each buffer
+  std::atomic<Index_type> next_start{0};
+
+  privatized_target(T* data_, Index_type size_)
+      : data(data_), size(size_),
+        stripe(std::max(privatized_stripe_size,
+                        (size_ + privatized_max_stripes - 1) /
+                            privatized_max_stripes)),
+        num_stripes(std::max(Index_type(1), (size_ + stripe - 1) / stripe)),
+        locks(new std::mutex[num_stripes])
+  {
+  }
+
+  /*!
+   * Call add(i0, i1) for each stripe s overlapping the elements [lo, hi)
+   * with the lock of s held, i0 and i1 being the bounds of the overlap.
+   * Each call starts at a different stripe, so concurrent merges of
+   * similar ranges mostly hold different locks.
+   */
+  template <typename Add>
+  void for_each_stripe(Index_type lo, Index_type hi, Add&& add)
+  {
+    const Index_type s0 = lo / stripe;
+    const Index_type count = (hi - 1) / stripe - s0 + 1;
+    const Index_type start = next_start.fetch_add(1) % count;
+    for (Index_type k = 0; k < count; ++k) {
+      const Index_type s = s0 + (start + k) % count;
+      std::lock_guard<std::mutex> guard(locks[s]);
+      add(std::max(lo, s * stripe), std::min(hi, (s + 1) * stripe));
+    }
+  }
+};
+
+/*!
+ * Private buffer of one copy of a privatized atomic View. Storage is
+ * allocated on the first update: a dense copy of the target when it has at
+ * most privatized_dense_limit elements, otherwise an open-addressing hash
+ * table from element offsets to values.
+ */
+template <typename T>
+class privatized_buffer
+{
+public:
+  RAJA_INLINE void add(privatized_target<T> const& target,
+                       Index_type i,
+                       T value)
+  {
+    if (dense_) {
+      dense_[i] += value;
+      lo_ = std::min(lo_, i);
+      hi_ = std::max(hi_, i + 1);
+    } else if (keys_.empty() && target.size <= privatized_dense_limit) {
+      dense_.reset(new T[target.size]());
+      dense_[i] = value;
+      lo_ = i;
+      hi_ = i + 1;
+    } else {
+      overlay_slot(i) += value;
+    }
+  }
+
+  //! add the buffer into the target and empty it
+  void merge_into(privatized_target<T>& target)
+  {
+    if (dense_) {
+      T* const dense = dense_.get();
+      T* const data = target.data;
+      target.for_each_stripe(
+          lo_, hi_, [=](Index_type i0, Index_type i1) {
+            for (Index_type i = i0; i < i1; ++i) {
+              data[i] += dense[i];
+            }
+          });
+      dense_.reset();
+    } else if (used_ > 0) {
+      std::vector<std::pair<Index_type, T>> entries;
+      entries.reserve(used_);
+      for (size_t k = 0; k < keys_.size(); ++k) {
+        if (keys_[k] != empty_key) {
+          entries.emplace_back(keys_[k], vals_[k]);
+        }
+      }
+      std::sort(entries.begin(),
+                entries.end(),
+                [](std::pair<Index_type, T> const& a,
+                   std::pair<Index_type, T> const& b) {
+                  return a.first < b.first;
+                });
+      T* const data = target.data;
+      auto first = entries.begin();
+      auto last = entries.end();
+      target.for_each_stripe(
+          first->first,
+          (last - 1)->first + 1,
+          [&](Index_type i0, Index_type i1) {
+            auto it = std::lower_bound(
+                first,
+                last,
+                i0,
+                [](std::pair<Index_type, T> const& e, Index_type i) {
+                  return e.first < i;
+                });
+            for (; it != last && it->first < i1; ++it) {
+              data[it->first] += it->second;
+            }
+          });
+      keys_.clear();
+      vals_.clear();
+      used_ = 0;
+    }
+  }
+
+private:
+  static constexpr Index_type empty_key = -1;
+
+  RAJA_INLINE size_t slot_of(Index_type i) const
+  {
+    // Fibonacci hashing, so consecutive offsets spread over the table
+    return static_cast<size_t>(
+        (static_cast<std::uint64_t>(i) * 0x9E3779B97F4A7C15ull) >> shift_);
+  }
+
+  T& overlay_slot(Index_type i)
+  {
+    if (keys_.empty()) {
+      rehash(privatized_overlay_slots);
+    }
+    size_t k = slot_of(i);
+    while (keys_[k] != i) {
+      if (keys_[k] == empty_key) {
+        // keep the load factor at most one half
+        if (2 * (used_ + 1) > static_cast<Index_type>(keys_.size())) {
+          rehash(2 * keys_.size());
+          return overlay_slot(i);
+        }
+        keys_[k] = i;
+        ++used_;
+        break;
+      }
+      k = (k + 1) & (keys_.size() - 1);
+    }
+    return vals_[k];
+  }
+
+  void rehash(size_t slots)
+  {
+    std::vector<Index_type> keys(slots, Index_type(empty_key));
+    std::vector<T> vals(slots, T(0));
+    shift_ = 64;
+    for (size_t s = slots; s > 1; s >>= 1) {
+      --shift_;
+    }
+    for (size_t k = 0; k < keys_.size(); ++k) {
+      if (keys_[k] != empty_key) {
+        size_t j = slot_of(keys_[k]);
+        while (keys[j] != empty_key) {
+          j = (j + 1) & (slots - 1);
+        }
+        keys[j] = keys_[k];
+        vals[j] = vals_[k];
+      }
+    }
+    keys_.swap(keys);
+    vals_.swap(vals);
+  }
+
+  std::unique_ptr<T[]> dense_;
+  Index_type lo_ = 0;
+  Index_type hi_ = 0;
+
+  std::vector<Index_type> keys_;
+  std::vector<T> vals_;
+  Index_type used_ = 0;
+  int shift_ = 64;
+};
+
+/*!
+ * Reference to one element of a privatized atomic View, supporting only
+ * the additive updates that can be accumulated privately.
+ */
+template <typename Wrapper>
+class privatized_ref
+{
+public:
+  using value_type = typename Wrapper::value_type;
+
+  RAJA_INLINE privatized_ref(Wrapper const* view, Index_type i)
+      : view_(view), i_(i)
+  {
+  }
+
+  RAJA_INLINE void operator+=(value_type value) const
+  {
+    view_->add(i_, value);
+  }
+
+  RAJA_INLINE void operator-=(value_type value) const
+  {
+    view_->add(i_, -value);
+  }
+
+  RAJA_INLINE void operator++() const { view_->add(i_, value_type(1)); }
+
+  RAJA_INLINE void operator++(int) const { view_->add(i_, value_type(1)); }
+
+  RAJA_INLINE void operator--() const { view_->add(i_, value_type(-1)); }
+
+  RAJA_INLINE void operator--(int) const { view_->add(i_, value_type(-1)); }
+
+private:
+  Wrapper const* view_;
+  Index_type i_;
+};
+
+}  // namespace detail
+
+/*!
+ * AtomicViewWrapper for privatized_atomic.
+ *
+ * The wrapper returned by make_atomic_view updates its target directly with
+ * auto_atomic, its copies add into private buffers as described for
+ * detail::privatized_copy.
+ */
+template <typename ViewType>
+struct AtomicViewWrapper<ViewType, RAJA::privatized_atomic> {
+  using base_type = ViewType;
+  using pointer_type = typename base_type::pointer_type;
+  using value_type = typename base_type::value_type;
+  using atomic_type = detail::privatized_ref<AtomicViewWrapper>;
+
+  static_assert(std::is_arithmetic<value_type>::value,
+                "privatized_atomic requires an arithmetic value type");
+
+  base_type base_;
+
+  RAJA_INLINE
+  explicit AtomicViewWrapper(ViewType const& view)
+      : base_{view},
+        state_{std::make_shared<detail::privatized_target<value_type>>(
+            detail::view_origin(view),
+            detail::view_extent(view))}
+  {
+  }
+
+  RAJA_INLINE void set_data(pointer_type data_ptr)
+  {
+    base_.set_data(data_ptr);
+    state_.shared().data = detail::view_origin(base_);
+  }
+
+  template <typename... ARGS>
+  RAJA_INLINE atomic_type operator()(ARGS&&... args) const
+  {
+    return atomic_type(this,
+                       &base_.operator()(std::forward<ARGS>(args)...) -
+                           state_.shared().data);
+  }
+
+  RAJA_INLINE void add(Index_type i, value_type value) const
+  {
+    if (detail::privatized_buffer<value_type>* buffer = state_.local()) {
+      buffer->add(state_.shared(), i, value);
+    } else {
+      RAJA::atomicAdd(RAJA::auto_atomic{}, state_.shared().data + i, value);
+    }
+  }
+
+private:
+  detail::privatized_copy<detail::privatized_target<value_type>,
+                          detail::privatized_buffer<value_type>>
+      state_;
+};
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,235 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining atomic min/max with location.
+ *
+ *          The (value, index) pairs used by ReduceMinLoc and ReduceMaxLoc
+ *          are updated with a single 8 or 16 byte compare-and-swap, so
+ *          argmin and argmax updates need no lock.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_atomic_valueloc_HPP
+#define RAJA_policy_atomic_valueloc_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstring>
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/pattern/detail/reduce.hpp"
+
+#include "RAJA/policy/atomic_builtin.hpp"
+#include "RAJA/policy/sequential/atomic.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+#include "RAJA/policy/openmp/atomic.hpp"
+#endif
+
+namespace RAJA
+{
+
+//! (value, index) pair for atomic argmin, initially (max value, -1)
+template <typename T, typename IndexType = Index_type>
+using MinLoc = reduce::detail::ValueLoc<T, IndexType, true>;
+
+//! (value, index) pair for atomic argmax, initially (min value, -1)
+template <typename T, typename IndexType = Index_type>
+using MaxLoc = reduce::detail::ValueLoc<T, IndexType, false>;
+
+namespace detail
+{
+
+/*!
+ * true if pair a should replace pair b. Pairs are ordered by value, with
+ * ties broken by the smaller index, so the pair that remains does not
+ * depend on the order in which threads update it.
+ */
+template <bool doing_min, typename T, typename IndexType, bool doing_min_vl>
+RAJA_INLINE bool valueloc_better(
+    reduce::detail::ValueLoc<T, IndexType, doing_min_vl> const &a,
+    reduce::detail::ValueLoc<T, IndexType, doing_min_vl> const &b)
+{
+  return (doing_min ? a.val < b.val : b.val < a.val) ||
+         (!(a.val < b.val) && !(b.val < a.val) && a.loc < b.loc);
+}
+
+template <bool doing_min, typename T, typename IndexType, bool doing_min_vl>
+RAJA_INLINE reduce::detail::ValueLoc<T, IndexType, doing_min_vl>
+builtin_atomic_valueloc(
+    reduce::detail::ValueLoc<T, IndexType, doing_min_vl> volatile *acc,
+    reduce::detail::ValueLoc<T, IndexType, doing_min_vl> value)
+{
+  using VL = reduce::detail::ValueLoc<T, IndexType, doing_min_vl>;
+  // a pair that is not replaced is written back unchanged, so the returned
+  // pair was always read by a compare-and-swap and can't be torn
+  return builtin_atomic_CAS_object_oper_sc(
+      acc,
+      [=](VL const &a) {
+        return valueloc_better<doing_min>(value, a) ? value : a;
+      },
+      [=](VL const &a) { return !valueloc_better<doing_min>(value, a); });
+}
+
+}  // namespace detail
+
+
+template <typename T, typename IndexType, bool doing_min>
+RAJA_INLINE reduce::detail::ValueLoc<T, IndexType, doing_min> atomicMin(
+    builtin_atomic,
+    reduce::detail::ValueLoc<T, IndexType, doing_min> volatile *acc,
+    reduce::detail::ValueLoc<T, IndexType, doing_min> value)
+{
+  return detail::builtin_atomic_valueloc<true>(acc, value);
+}
+
+template <typename T, typename IndexType, bool doing_min>
+RAJA_INLINE reduce::detail::ValueLoc<T, IndexType, doing_min> atomicMax(
+    builtin_atomic,
+    reduce::detail::ValueLoc<T, IndexType, doing_min> volatile *acc,
+    reduce::detail::ValueLoc<T, IndexType, doing_min> value)
+{
+  return detail::builtin_atomic_valueloc<false>(acc, value);
+}
+
+template <typename T, typename IndexType, bool doing_min>
+RAJA_INLINE reduce::detail::ValueLoc<T, IndexType, doing_min> atomicExchange(
+    builtin_atomic,
+    reduce::detail::ValueLoc<T, IndexType, doing_min> volatile *acc,
+    reduce::detail::ValueLoc<T, IndexType, doing_min> value)
+{
+  using VL = reduce::detail::ValueLoc<T, IndexType, doing_min>;
+  return detail::builtin_atomic_CAS_object_oper_sc(
+      acc, [=](VL const &) { return value; }, [](VL const &) {
+        return false;
+      });
+}
+
+template <typename T, typename IndexType, bool doing_min>
+RAJA_INLINE reduce::detail::ValueLoc<T, IndexType, doing_min> atomicCAS(
+    builtin_atomic,
+    reduce::detail::ValueLoc<T, IndexType, doing_min> volatile *acc,
+    reduce::detail::ValueLoc<T, IndexType, doing_min> compare,
+    reduce::detail::ValueLoc<T, IndexType, doing_min> value)
+{
+  using VL = reduce::detail::ValueLoc<T, IndexType, doing_min>;
+  using Bits = typename detail::builtin_atomic_bits<sizeof(VL)>::type;
+  // compare is matched by val and loc: the padding bytes of a pair such as
+  // (double, int) are indeterminate, so the bytes read from *acc are used as
+  // the expected value instead. A pair that does not match is written back
+  // unchanged, so every result is confirmed by a compare-and-swap.
+  Bits expected;
+  std::memcpy(&expected, const_cast<VL const *>(acc), sizeof(VL));
+  const Bits desired = detail::builtin_bit_copy<Bits>(value);
+  for (;;) {
+    const VL current = detail::builtin_bit_copy<VL>(expected);
+    const bool match = current.val == compare.val && current.loc == compare.loc;
+    const Bits readback = detail::builtin_atomic_CAS(
+        (Bits volatile *)acc, expected, match ? desired : expected);
+    if (readback == expected) {
+      return current;
+    }
+    expected = readback;
+  }
+}
+
+
+template <typename T, typename IndexType, bool doing_min>
+RAJA_INLINE reduce::detail::ValueLoc<T, IndexType, doing_min> atomicMin(
+    seq_atomic,
+    reduce::detail::ValueLoc<T, IndexType, doing_min> volatile *acc,
+    reduce::detail::ValueLoc<T, IndexType, doing_min> value)
+{
+  using VL = reduce::detail::ValueLoc<T, IndexType, doing_min>;
+  VL &current = *const_cast<VL *>(acc);
+  VL ret = current;
+  if (detail::valueloc_better<true>(value, ret)) {
+    current = value;
+  }
+  return ret;
+}
+
+template <typename T, typename IndexType, bool doing_min>
+RAJA_INLINE reduce::detail::ValueLoc<T, IndexType, doing_min> atomicMax(
+    seq_atomic,
+    reduce::detail::ValueLoc<T, IndexType, doing_min> volatile *acc,
+    reduce::detail::ValueLoc<T, IndexType, doing_min> value)
+{
+  using VL = reduce::detail::ValueLoc<T, IndexType, doing_min>;
+  VL &current = *const_cast<VL *>(acc);
+  VL ret = current;
+  if (detail::valueloc_better<false>(value, ret)) {
+    current = value;
+  }
+  return ret;
+}
+
+template <typename T, typename IndexType, bool doing_min>
+RAJA_INLINE reduce::detail::ValueLoc<T, IndexType, doing_min> atomicExchange(
+    seq_atomic,
+    reduce::detail::ValueLoc<T, IndexType, doing_min> volatile *acc,
+    reduce::detail::ValueLoc<T, IndexType, doing_min> value)
+{
+  using VL = reduce::detail::ValueLoc<T, IndexType, doing_min>;
+  VL &current = *const_cast<VL *>(acc);
+  VL ret = current;
+  current = value;
+  return ret;
+}
+
+template <typename T, typename IndexType, bool doing_min>
+RAJA_INLINE reduce::detail::ValueLoc<T, IndexType, doing_min> atomicCAS(
+    seq_atomic,
+    reduce::detail::ValueLoc<T, IndexType, doing_min> volatile *acc,
+    reduce::detail::ValueLoc<T, IndexType, doing_min> compare,
+    reduce::detail::ValueLoc<T, IndexType, doing_min> value)
+{
+  using VL = reduce::detail::ValueLoc<T, IndexType, doing_min>;
+  VL &current = *const_cast<VL *>(acc);
+  VL ret = current;
+  if (ret.val == compare.val && ret.loc == compare.loc) {
+    current = value;
+  }
+  return ret;
+}
+
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+// OpenMP has no atomic operations on structs, so use builtin atomics
+template <typename T, typename IndexType, bool doing_min>
+RAJA_INLINE reduce::detail::ValueLoc<T, IndexType, doing_min> atomicExchange(
+    omp_atomic,
+    reduce::detail::ValueLoc<T, IndexType, doing_min> volatile *acc,
+    reduce::detail::ValueLoc<T, IndexType, doing_min> value)
+{
+  return RAJA::atomicExchange(builtin_atomic{}, acc, value);
+}
+
+template <typename T, typename IndexType, bool doing_min>
+RAJA_INLINE reduce::detail::ValueLoc<T, IndexType, doing_min> atomicCAS(
+    omp_atomic,
+    reduce::detail::ValueLoc<T, IndexType, doing_min> volatile *acc,
+    reduce::detail::ValueLoc<T, IndexType, doing_min> compare,
+    reduce::detail::ValueLoc<T, IndexType, doing_min> value)
+{
+  return RAJA::atomicCAS(builtin_atomic{}, acc, compare, value);
+}
+
+#endif  // RAJA_ENABLE_OPENMP
+
+}  // namespace RAJA
+
+#endif  // guard
@@ -21,9 +21,14 @@
 #define RAJA_loop_HPP
 
 #include "RAJA/policy/loop/atomic.hpp"
+#include "RAJA/policy/loop/compact.hpp"
 #include "RAJA/policy/loop/forall.hpp"
 #include "RAJA/policy/loop/kernel.hpp"
+#include "RAJA/policy/loop/merge.hpp"
 #include "RAJA/policy/loop/policy.hpp"
 #include "RAJA/policy/loop/scan.hpp"
+#include "RAJA/policy/loop/scatter.hpp"
+#include "RAJA/policy/loop/search.hpp"
+#include "RAJA/policy/loop/sort.hpp"
 
 #endif  // closing endif for header file include guard
@@ -0,0 +1,95 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA loop stream compaction declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_compact_loop_HPP
+#define RAJA_compact_loop_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/util/concepts.hpp"
+
+#include "RAJA/pattern/detail/compact.hpp"
+
+#include "RAJA/policy/loop/policy.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace compact
+{
+
+/*!
+        \brief copy the elements of the given range that satisfy pred to out,
+   returning how many were copied
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename OutIter,
+          typename Predicate>
+::RAJA::detail::compact_enable_if<type_traits::is_loop_policy<ExecPolicy>,
+                                   Iter>
+copy_if(const ExecPolicy &, Iter begin, Iter end, OutIter out, Predicate pred)
+{
+  using Size = ::RAJA::detail::CompactSize<Iter>;
+  const Size n = end - begin;
+  Size count = 0;
+  for (Size i = 0; i < n; ++i) {
+    if (pred(*(begin + i))) {
+      *(out + count) = *(begin + i);
+      ++count;
+    }
+  }
+  return count;
+}
+
+/*!
+        \brief move the elements of the given range that do not satisfy pred
+   to its front in order, returning how many were kept
+*/
+template <typename ExecPolicy, typename Iter, typename Predicate>
+::RAJA::detail::compact_enable_if<type_traits::is_loop_policy<ExecPolicy>,
+                                   Iter>
+remove_if(const ExecPolicy &, Iter begin, Iter end, Predicate pred)
+{
+  return std::remove_if(begin, end, pred) - begin;
+}
+
+/*!
+        \brief stable partition of the given range, returning the number of
+   elements that satisfy pred
+*/
+template <typename ExecPolicy, typename Iter, typename Predicate>
+::RAJA::detail::compact_enable_if<type_traits::is_loop_policy<ExecPolicy>,
+                                   Iter>
+partition(const ExecPolicy &, Iter begin, Iter end, Predicate pred)
+{
+  return std::stable_partition(begin, end, pred) - begin;
+}
+
+}  // namespace compact
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
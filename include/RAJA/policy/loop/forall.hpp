@@ -32,6 +32,8 @@
 
 #include "RAJA/internal/fault_tolerance.hpp"
 
+#include "RAJA/pattern/params/reducer.hpp"
+
 using RAJA::concepts::enable_if;
 
 namespace RAJA
@@ -61,6 +63,19 @@ RAJA_INLINE void forall_impl(const loop_exec &, Iterable &&iter, Func &&body)
   }
 }
 
+template <typename Iterable, typename Func, typename... Params>
+RAJA_INLINE void forall_impl(const loop_exec &,
+                             Iterable &&iter,
+                             Func &&body,
+                             RAJA::detail::ParamPack<Params...> &params)
+{
+  RAJA_EXTRACT_BED_IT(iter);
+
+  for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+    params.invoke(body, *(begin_it + i));
+  }
+}
+
 }  // namespace loop
 
 }  // namespace policy
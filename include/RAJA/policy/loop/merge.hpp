@@ -0,0 +1,139 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA loop merge and set operation
+*          declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_merge_loop_HPP
+#define RAJA_merge_loop_HPP
+
+#include "RAJA/config.hpp"
+
+#include <iterator>
+
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/pattern/detail/merge.hpp"
+#include "RAJA/pattern/detail/sort.hpp"
+
+#include "RAJA/policy/loop/policy.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace merge
+{
+
+/*!
+        \brief stable merge of the given sorted ranges into out, returning
+   the number of elements written
+*/
+template <typename ExecPolicy,
+          typename IterA,
+          typename IterB,
+          typename OutIter,
+          typename Compare>
+::RAJA::detail::merge_enable_if<type_traits::is_loop_policy<ExecPolicy>,
+                                 IterA>
+merge(const ExecPolicy&,
+      IterA a_begin,
+      IterA a_end,
+      IterB b_begin,
+      IterB b_end,
+      OutIter out,
+      Compare comp)
+{
+  using Size = ::RAJA::detail::MergeSize<IterA>;
+  const ::RAJA::detail::serial_sort_runner run{};
+  return ::RAJA::detail::merge_with(run,
+                                    a_begin,
+                                    Size(a_end - a_begin),
+                                    b_begin,
+                                    Size(b_end - b_begin),
+                                    out,
+                                    comp);
+}
+
+/*!
+        \brief union of the given sorted ranges written to out, returning the
+   number of elements written
+*/
+template <typename ExecPolicy,
+          typename IterA,
+          typename IterB,
+          typename OutIter,
+          typename Compare>
+::RAJA::detail::merge_enable_if<type_traits::is_loop_policy<ExecPolicy>,
+                                 IterA>
+set_union(const ExecPolicy&,
+          IterA a_begin,
+          IterA a_end,
+          IterB b_begin,
+          IterB b_end,
+          OutIter out,
+          Compare comp)
+{
+  using Size = ::RAJA::detail::MergeSize<IterA>;
+  const ::RAJA::detail::serial_sort_runner run{};
+  return ::RAJA::detail::set_op_with<::RAJA::detail::set_op::set_union>(
+      run,
+      a_begin,
+      Size(a_end - a_begin),
+      b_begin,
+      Size(b_end - b_begin),
+      out,
+      comp);
+}
+
+/*!
+        \brief intersection of the given sorted ranges written to out,
+   returning the number of elements written
+*/
+template <typename ExecPolicy,
+          typename IterA,
+          typename IterB,
+          typename OutIter,
+          typename Compare>
+::RAJA::detail::merge_enable_if<type_traits::is_loop_policy<ExecPolicy>,
+                                 IterA>
+set_intersection(const ExecPolicy&,
+                 IterA a_begin,
+                 IterA a_end,
+                 IterB b_begin,
+                 IterB b_end,
+                 OutIter out,
+                 Compare comp)
+{
+  using Size = ::RAJA::detail::MergeSize<IterA>;
+  const ::RAJA::detail::serial_sort_runner run{};
+  return ::RAJA::detail::set_op_with<
+      ::RAJA::detail::set_op::set_intersection>(run,
+                                                a_begin,
+                                                Size(a_end - a_begin),
+                                                b_begin,
+                                                Size(b_end - b_begin),
+                                                out,
+                                                comp);
+}
+
+}  // namespace merge
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
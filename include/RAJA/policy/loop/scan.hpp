@@ -23,12 +23,16 @@
 #include <algorithm>
 #include <functional>
 #include <iterator>
+#include <type_traits>
 
 #include "RAJA/util/macros.hpp"
 
 #include "RAJA/util/concepts.hpp"
 
+#include "RAJA/pattern/detail/scan.hpp"
+
 #include "RAJA/policy/loop/policy.hpp"
+#include "RAJA/policy/simd/scan.hpp"
 
 namespace RAJA
 {
@@ -47,12 +51,9 @@ concepts::enable_if<type_traits::is_loop_policy<ExecPolicy>> inclusive_inplace(
     Iter end,
     BinFn f)
 {
-  auto agg = *begin;
-
-  for (Iter i = ++begin; i != end; ++i) {
-    agg = f(*i, agg);
-    *i = agg;
-  }
+  using Value = typename ::std::iterator_traits<Iter>::value_type;
+  const Value first = *begin;
+  simd::scan<true>(begin + 1, begin + 1, end - begin - 1, f, first);
 }
 
 /*!
@@ -67,14 +68,8 @@ concepts::enable_if<type_traits::is_loop_policy<ExecPolicy>> exclusive_inplace(
     BinFn f,
     T v)
 {
-  const int n = end - begin;
-  decltype(*begin) agg = v;
-
-  for (int i = 0; i < n; ++i) {
-    auto t = *(begin + i);
-    *(begin + i) = agg;
-    agg = f(agg, t);
-  }
+  using Value = typename ::std::iterator_traits<Iter>::value_type;
+  simd::scan<false>(begin, begin, end - begin, f, Value(v));
 }
 
 /*!
@@ -89,13 +84,10 @@ concepts::enable_if<type_traits::is_loop_policy<ExecPolicy>> inclusive(
     OutIter out,
     BinFn f)
 {
-  auto agg = *begin;
-  *out++ = agg;
-
-  for (Iter i = begin + 1; i != end; ++i) {
-    agg = f(agg, *i);
-    *out++ = agg;
-  }
+  using Value = typename ::std::iterator_traits<Iter>::value_type;
+  const Value first = *begin;
+  *out = first;
+  simd::scan<true>(begin + 1, out + 1, end - begin - 1, f, first);
 }
 
 /*!
@@ -115,14 +107,96 @@ concepts::enable_if<type_traits::is_loop_policy<ExecPolicy>> exclusive(
     BinFn f,
     T v)
 {
-  decltype(*begin) agg = v;
-  OutIter o = out;
-  *o++ = v;
-
-  for (Iter i = begin; i != end - 1; ++i, ++o) {
-    agg = f(*i, agg);
-    *o = agg;
-  }
+  using Value = typename ::std::iterator_traits<Iter>::value_type;
+  simd::scan<false>(begin, out, end - begin, f, Value(v));
+}
+
+/*!
+        \brief explicit transform scan of value(i) for i in [0, n) given
+   function and initial value, reporting the result at i as emit(i, v)
+*/
+template <bool Inclusive,
+          typename ExecPolicy,
+          typename Size,
+          typename Values,
+          typename Emit,
+          typename BinFn,
+          typename T>
+concepts::enable_if<type_traits::is_loop_policy<ExecPolicy>> transform(
+    const ExecPolicy &,
+    Size n,
+    Values value,
+    Emit emit,
+    BinFn f,
+    T v)
+{
+  using Value = typename std::decay<decltype(BinFn::identity())>::type;
+  Value agg = v;
+  ::RAJA::detail::transform_scan_block<Inclusive>(
+      Size(0), n, value, emit, f, agg);
+}
+
+/*!
+        \brief explicit segmented scan given input range, segment heads,
+   output, function, and initial value of every segment
+*/
+template <bool Inclusive,
+          typename ExecPolicy,
+          typename Iter,
+          typename Heads,
+          typename OutIter,
+          typename BinFn,
+          typename T>
+concepts::enable_if<type_traits::is_loop_policy<ExecPolicy>> segmented(
+    const ExecPolicy &,
+    const Iter begin,
+    const Iter end,
+    Heads heads,
+    OutIter out,
+    BinFn f,
+    T v)
+{
+  using Value = typename ::std::iterator_traits<Iter>::value_type;
+  using Size = typename ::std::iterator_traits<Iter>::difference_type;
+  const Value init = v;
+  ::RAJA::detail::segmented_scan_block<Inclusive>(
+      begin, out, Size(0), end - begin, heads.at(Size(0)), f, init, init);
+}
+
+/*!
+        \brief explicit segmented reduction of value(i) for i in [0, n) given
+   segment heads and function, reporting each segment's head and reduction;
+   returns the number of segments
+*/
+template <typename ExecPolicy,
+          typename Size,
+          typename Heads,
+          typename Values,
+          typename BinFn,
+          typename EmitHead,
+          typename EmitValue>
+typename std::enable_if<type_traits::is_loop_policy<ExecPolicy>::value,
+                        Size>::type
+segmented_reduce(const ExecPolicy &,
+                 Size n,
+                 Heads heads,
+                 Values value,
+                 BinFn f,
+                 EmitHead emit_head,
+                 EmitValue emit_value)
+{
+  using Value = typename std::decay<decltype(BinFn::identity())>::type;
+  Value agg = BinFn::identity();
+  return ::RAJA::detail::reduce_segments_block(Size(0),
+                                               n,
+                                               true,
+                                               heads.at(Size(0)),
+                                               value,
+                                               f,
+                                               agg,
+                                               Size(0),
+                                               emit_head,
+                                               emit_value);
 }
 
 }  // namespace scan
@@ -0,0 +1,66 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA loop scatter-add declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_scatter_loop_HPP
+#define RAJA_scatter_loop_HPP
+
+#include "RAJA/config.hpp"
+
+#include <iterator>
+
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/pattern/detail/scatter.hpp"
+#include "RAJA/pattern/detail/sort.hpp"
+
+#include "RAJA/policy/loop/policy.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace scatter
+{
+
+/*!
+        \brief add each of the given values to the target element at the
+   matching index
+*/
+template <typename ExecPolicy,
+          typename TargetIter,
+          typename IdxIter,
+          typename ValIter>
+concepts::enable_if<type_traits::is_loop_policy<ExecPolicy>> add(
+    const ExecPolicy&,
+    TargetIter target,
+    IdxIter idx_begin,
+    IdxIter idx_end,
+    ValIter values)
+{
+  const ::RAJA::detail::serial_sort_runner run{};
+  ::RAJA::detail::scatter_add_with(
+      run, target, idx_begin, idx_end - idx_begin, values);
+}
+
+}  // namespace scatter
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,211 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA OpenMP stream compaction declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_compact_openmp_HPP
+#define RAJA_compact_openmp_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#include <omp.h>
+
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/pattern/detail/compact.hpp"
+
+#include "RAJA/policy/loop/scan.hpp"
+#include "RAJA/policy/openmp/policy.hpp"
+#include "RAJA/policy/openmp/scan.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace compact
+{
+
+namespace openmp_detail
+{
+/*!
+        \brief blocked compaction of [begin, end)
+
+   Each thread counts the selected elements of its block, the counts are
+   scanned by a single thread, and each thread then scatters its block
+   starting from the count of the preceding blocks; pred is evaluated once
+   in each pass. Selected elements x go to sel(k, x), k being the number
+   of selected elements preceding x. When Complement is true the others go
+   to rest(k, x), k being their position after all selected elements.
+   Returns the number of selected elements.
+*/
+template <bool Complement,
+          typename Iter,
+          typename Predicate,
+          typename Selected,
+          typename Rest>
+RAJA_INLINE ::RAJA::detail::CompactSize<Iter> count_then_scatter(
+    Iter begin,
+    Iter end,
+    Predicate pred,
+    Selected&& sel,
+    Rest&& rest)
+{
+  using Size = ::RAJA::detail::CompactSize<Iter>;
+  const Size n = end - begin;
+  const int p0 =
+      static_cast<int>(std::min<Size>(n, Size(omp_get_max_threads())));
+  // one extra entry so the scan leaves the total in counts[p0]
+  ::std::vector<Size> counts(p0 + 1, Size(0));
+#pragma omp parallel num_threads(p0)
+  {
+    const int p = omp_get_num_threads();
+    const int pid = omp_get_thread_num();
+    const Size i0 = ::RAJA::impl::scan::firstIndex(n, p, pid);
+    const Size i1 = ::RAJA::impl::scan::firstIndex(n, p, pid + 1);
+
+    Size count = 0;
+    for (Size i = i0; i < i1; ++i) {
+      if (pred(*(begin + i))) {
+        ++count;
+      }
+    }
+    counts[pid] = count;
+
+#pragma omp barrier
+#pragma omp single
+    ::RAJA::impl::scan::exclusive_inplace(::RAJA::loop_exec{},
+                                          counts.data(),
+                                          counts.data() + p0 + 1,
+                                          operators::plus<Size>{},
+                                          Size(0));
+
+    Size k = counts[pid];
+    Size r = counts[p0] + i0 - counts[pid];
+    for (Size i = i0; i < i1; ++i) {
+      if (pred(*(begin + i))) {
+        sel(k++, *(begin + i));
+      } else if (Complement) {
+        rest(r++, *(begin + i));
+      }
+    }
+  }
+  return counts[p0];
+}
+
+//! scatter target that discards its element
+struct discard {
+  template <typename Size, typename T>
+  RAJA_INLINE void operator()(Size, T const&) const
+  {
+  }
+};
+
+//! copy [0, n) of src to dst, split across the OpenMP threads
+template <typename Src, typename Iter, typename Size>
+RAJA_INLINE void copy_back(Src const* src, Iter dst, Size n)
+{
+#pragma omp parallel
+  {
+    const int p = omp_get_num_threads();
+    const int pid = omp_get_thread_num();
+    const Size i0 = ::RAJA::impl::scan::firstIndex(n, p, pid);
+    const Size i1 = ::RAJA::impl::scan::firstIndex(n, p, pid + 1);
+    std::copy(src + i0, src + i1, dst + i0);
+  }
+}
+}  // namespace openmp_detail
+
+/*!
+        \brief copy the elements of the given range that satisfy pred to out,
+   returning how many were copied
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename OutIter,
+          typename Predicate>
+::RAJA::detail::compact_enable_if<type_traits::is_openmp_policy<ExecPolicy>,
+                                   Iter>
+copy_if(const ExecPolicy&, Iter begin, Iter end, OutIter out, Predicate pred)
+{
+  using Size = ::RAJA::detail::CompactSize<Iter>;
+  return openmp_detail::count_then_scatter<false>(
+      begin,
+      end,
+      pred,
+      [=](Size k, ::RAJA::detail::CompactVal<Iter> const& x) {
+        *(out + k) = x;
+      },
+      openmp_detail::discard{});
+}
+
+/*!
+        \brief move the elements of the given range that do not satisfy pred
+   to its front in order, returning how many were kept
+*/
+template <typename ExecPolicy, typename Iter, typename Predicate>
+::RAJA::detail::compact_enable_if<type_traits::is_openmp_policy<ExecPolicy>,
+                                   Iter>
+remove_if(const ExecPolicy&, Iter begin, Iter end, Predicate pred)
+{
+  using Size = ::RAJA::detail::CompactSize<Iter>;
+  using Value = ::RAJA::detail::CompactVal<Iter>;
+  ::std::vector<Value> kept(end - begin);
+  Value* const tmp = kept.data();
+  const Size count = openmp_detail::count_then_scatter<false>(
+      begin,
+      end,
+      [=](Value const& x) { return !pred(x); },
+      [=](Size k, Value const& x) { tmp[k] = x; },
+      openmp_detail::discard{});
+  openmp_detail::copy_back(tmp, begin, count);
+  return count;
+}
+
+/*!
+        \brief stable partition of the given range, returning the number of
+   elements that satisfy pred
+*/
+template <typename ExecPolicy, typename Iter, typename Predicate>
+::RAJA::detail::compact_enable_if<type_traits::is_openmp_policy<ExecPolicy>,
+                                   Iter>
+partition(const ExecPolicy&, Iter begin, Iter end, Predicate pred)
+{
+  using Size = ::RAJA::detail::CompactSize<Iter>;
+  using Value = ::RAJA::detail::CompactVal<Iter>;
+  const Size n = end - begin;
+  ::std::vector<Value> parts(n);
+  Value* const tmp = parts.data();
+  const Size count = openmp_detail::count_then_scatter<true>(
+      begin,
+      end,
+      pred,
+      [=](Size k, Value const& x) { tmp[k] = x; },
+      [=](Size r, Value const& x) { tmp[r] = x; });
+  openmp_detail::copy_back(tmp, begin, n);
+  return count;
+}
+
+}  // namespace compact
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -41,6 +41,7 @@
 #include "RAJA/policy/openmp/policy.hpp"
 
 #include "RAJA/pattern/forall.hpp"
+#include "RAJA/pattern/params/reducer.hpp"
 #include "RAJA/pattern/region.hpp"
 
 
@@ -116,6 +117,108 @@ RAJA_INLINE void forall_impl(const omp_for_static<ChunkSize>&,
   }
 }
 
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  OpenMP forall with kernel parameters (e.g., reduce_sum(&x)).
+ *
+ *         Each thread owns a private copy of the parameter pack and of the
+ *         loop body, and the private values are combined once per thread
+ *         when its share of the iteration space is done.
+ *
+ *         The omp_for variants below run the work-sharing loop over the
+ *         pack they are given. Inside an enclosing parallel region every
+ *         thread of the team calls forall() with a pack of its own, so
+ *         they write their values to the targets one thread at a time.
+ *
+ ******************************************************************************
+ */
+template <typename Iterable,
+          typename Func,
+          typename InnerPolicy,
+          typename... Params>
+RAJA_INLINE void forall_impl(const omp_parallel_exec<InnerPolicy>&,
+                             Iterable&& iter,
+                             Func&& loop_body,
+                             RAJA::detail::ParamPack<Params...>& params)
+{
+  RAJA::region<RAJA::omp_parallel_region>([&]() {
+    using RAJA::internal::thread_privatize;
+    auto body = thread_privatize(loop_body);
+    auto priv = params.make_private();
+    forall_impl(InnerPolicy{},
+                iter,
+                RAJA::detail::bind_param_pack(body.get_priv(), priv));
+#pragma omp critical(raja_forall_param_combine)
+    params.combine(priv);
+  });
+}
+
+//! resolve the pack of this thread when the team shares the targets; with
+//! wait, the targets are final for all threads once this returns
+template <typename... Params>
+RAJA_INLINE void resolve_team_params(
+    RAJA::detail::ParamPack<Params...>& params,
+    bool wait)
+{
+  if (omp_in_parallel()) {
+#pragma omp critical(raja_forall_param_combine)
+    params.resolve();
+    if (wait) {
+#pragma omp barrier
+    }
+  }
+}
+
+
+template <typename Iterable, typename Func, typename... Params>
+RAJA_INLINE void forall_impl(const omp_for_nowait_exec&,
+                             Iterable&& iter,
+                             Func&& loop_body,
+                             RAJA::detail::ParamPack<Params...>& params)
+{
+  RAJA_EXTRACT_BED_IT(iter);
+#pragma omp for nowait
+  for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+    params.invoke(loop_body, begin_it[i]);
+  }
+  resolve_team_params(params, false);
+}
+
+
+template <typename Iterable, typename Func, typename... Params>
+RAJA_INLINE void forall_impl(const omp_for_exec&,
+                             Iterable&& iter,
+                             Func&& loop_body,
+                             RAJA::detail::ParamPack<Params...>& params)
+{
+  RAJA_EXTRACT_BED_IT(iter);
+#pragma omp for
+  for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+    params.invoke(loop_body, begin_it[i]);
+  }
+  resolve_team_params(params, true);
+}
+
+
+template <typename Iterable,
+          typename Func,
+          size_t ChunkSize,
+          typename... Params>
+RAJA_INLINE void forall_impl(const omp_for_static<ChunkSize>&,
+                             Iterable&& iter,
+                             Func&& loop_body,
+                             RAJA::detail::ParamPack<Params...>& params)
+{
+  RAJA_EXTRACT_BED_IT(iter);
+#pragma omp for schedule(static, ChunkSize)
+  for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+    params.invoke(loop_body, begin_it[i]);
+  }
+  resolve_team_params(params, true);
+}
+
 //
 //////////////////////////////////////////////////////////////////////
 //
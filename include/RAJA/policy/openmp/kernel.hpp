@@ -3,7 +3,7 @@
  *
  * \file
  *
- * \brief   RAJA header file for OpenMP collapse constructs.
+ * \brief   RAJA header file for OpenMP collapse and reduce constructs.
  *
  ******************************************************************************
  */
@@ -21,5 +21,6 @@
 
 #include "RAJA/policy/openmp/kernel/Collapse.hpp"
 #include "RAJA/policy/openmp/kernel/OmpSyncThreads.hpp"
+#include "RAJA/policy/openmp/kernel/Reduce.hpp"
 
 #endif  // closing endif for header file include guard
@@ -25,6 +25,7 @@
 #include "RAJA/pattern/detail/privatizer.hpp"
 
 #include "RAJA/pattern/kernel/Collapse.hpp"
+#include "RAJA/pattern/kernel/Reduce.hpp"
 #include "RAJA/pattern/kernel/internal.hpp"
 
 #include "RAJA/util/macros.hpp"
@@ -64,6 +65,9 @@ struct StatementExecutor<statement::Collapse<omp_parallel_collapse_exec,
   template <typename Data>
   static RAJA_INLINE void exec(Data&& data)
   {
+    check_team_reduce_nesting<omp_parallel_collapse_exec,
+                              EnclosedStmts...>{};
+
     const auto l0 = segment_length<Arg0>(data);
     const auto l1 = segment_length<Arg1>(data);
     // NOTE: these are here to avoid a use-after-scope detected by address
@@ -105,6 +109,9 @@ struct StatementExecutor<statement::Collapse<omp_parallel_collapse_exec,
   template <typename Data>
   static RAJA_INLINE void exec(Data&& data)
   {
+    check_team_reduce_nesting<omp_parallel_collapse_exec,
+                              EnclosedStmts...>{};
+
     const auto l0 = segment_length<Arg0>(data);
     const auto l1 = segment_length<Arg1>(data);
     const auto l2 = segment_length<Arg2>(data);
@@ -0,0 +1,155 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for OpenMP kernel reduction executors.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_openmp_kernel_Reduce_HPP
+#define RAJA_policy_openmp_kernel_Reduce_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+#include <omp.h>
+
+#include "RAJA/pattern/kernel/Reduce.hpp"
+#include "RAJA/pattern/kernel/internal.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/policy/openmp/policy.hpp"
+
+namespace RAJA
+{
+
+namespace internal
+{
+
+/*!
+ * Team reduction of a kernel parameter across the threads of the
+ * enclosing OpenMP parallel region (e.g. statement::Region with
+ * omp_parallel_region).
+ *
+ * Every thread in the team must reach the Reduce statement, each holding
+ * its partial value in its own copy of the parameter. The partial values
+ * are published to a buffer shared by the team, thread 0 folds them in
+ * thread-id order, and only thread 0 executes the enclosed statements with
+ * the reduced value, mirroring the block-level reduction done by
+ * cuda_block_reduce. Since the fold order only depends on the thread id,
+ * the result is reproducible for a fixed team size.
+ *
+ * Outside of a parallel region the team has a single thread, and this
+ * reduces to a passthrough to the enclosed statements.
+ *
+ * The Reduce must not be nested in a loop with an OpenMP policy, such as
+ * omp_for_nowait_exec or omp_parallel_for_exec: each thread executes only
+ * its share of that loop, and the single and barrier constructs used here
+ * are not allowed in a worksharing region. Such nesting is rejected at
+ * compile time by check_team_reduce_nesting.
+ */
+template <>
+struct is_team_reduce_policy<omp_reduce> : std::true_type {
+};
+
+template <>
+struct is_team_reduce_policy<omp_reduce_ordered> : std::true_type {
+};
+
+template <template <typename...> class ReduceOperator,
+          typename ParamId,
+          typename... EnclosedStmts>
+struct OmpTeamReduceExecutor {
+
+  template <typename Types, typename Data>
+  static RAJA_INLINE void exec(Data &&data)
+  {
+    using value_t = camp::decay<decltype(data.template get_param<ParamId>())>;
+
+    value_t *team_values = nullptr;
+
+    // single carries an implicit barrier, so no thread can publish its value
+    // before the buffer has been handed out to the whole team
+#pragma omp single copyprivate(team_values)
+    team_values = new value_t[omp_get_num_threads()];
+
+    int const tid = omp_get_thread_num();
+    team_values[tid] = data.template get_param<ParamId>();
+
+#pragma omp barrier
+
+    if (tid == 0) {
+      int const nthreads = omp_get_num_threads();
+      value_t value = team_values[0];
+      for (int t = 1; t < nthreads; ++t) {
+        value = ReduceOperator<value_t>{}(value, team_values[t]);
+      }
+      delete[] team_values;
+
+      data.template assign_param<ParamId>(value);
+
+      execute_statement_list<camp::list<EnclosedStmts...>, Types>(data);
+    }
+  }
+};
+
+//
+// Executor that reduces a parameter across an OpenMP thread team
+//
+template <template <typename...> class ReduceOperator,
+          typename ParamId,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<
+    statement::Reduce<omp_reduce, ReduceOperator, ParamId, EnclosedStmts...>,
+    Types> {
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &&data)
+  {
+    OmpTeamReduceExecutor<ReduceOperator, ParamId, EnclosedStmts...>::
+        template exec<Types>(data);
+  }
+};
+
+//
+// Executor that reduces a parameter across an OpenMP thread team in
+// thread-id order
+//
+template <template <typename...> class ReduceOperator,
+          typename ParamId,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<statement::Reduce<omp_reduce_ordered,
+                                           ReduceOperator,
+                                           ParamId,
+                                           EnclosedStmts...>,
+                         Types> {
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &&data)
+  {
+    OmpTeamReduceExecutor<ReduceOperator, ParamId, EnclosedStmts...>::
+        template exec<Types>(data);
+  }
+};
+
+}  // namespace internal
+
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_OPENMP guard
+
+#endif  // closing endif for header file include guard
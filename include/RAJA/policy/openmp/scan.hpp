@@ -28,8 +28,11 @@
 
 #include <omp.h>
 
+#include "RAJA/pattern/detail/scan.hpp"
+
 #include "RAJA/policy/openmp/policy.hpp"
 #include "RAJA/policy/loop/scan.hpp"
+#include "RAJA/policy/simd/scan.hpp"
 
 namespace RAJA
 {
@@ -38,45 +41,81 @@ namespace impl
 namespace scan
 {
 
-RAJA_INLINE
-int firstIndex(int n, int p, int pid)
+/*!
+        \brief first index of the pid-th of p nearly equal blocks of [0, n)
+*/
+template <typename Size>
+RAJA_INLINE Size firstIndex(Size n, int p, int pid)
 {
-  return (static_cast<size_t>(n) * pid) / p;
+  return (n / p) * pid + std::min<Size>(n % p, pid);
 }
 
 /*!
-        \brief explicit inclusive inplace scan given range, function, and
-   initial value
+        \brief reduce-then-scan of [begin, end) into out
+
+   Each thread first reduces its block of the input without writing
+   anything, the block totals are scanned by a single thread, and each
+   thread then scans its block directly into the output starting from the
+   total of the preceding blocks, in vector registers where possible. Every
+   output element is written once and the out-of-place variants need no
+   separate copy. out may equal begin.
 */
-template <typename Policy, typename Iter, typename BinFn>
-concepts::enable_if<type_traits::is_openmp_policy<Policy>> inclusive_inplace(
-    const Policy&,
-    Iter begin,
-    Iter end,
-    BinFn f)
+template <bool Inclusive,
+          typename Iter,
+          typename OutIter,
+          typename BinFn,
+          typename ValueT>
+RAJA_INLINE void reduce_then_scan(Iter begin,
+                                  Iter end,
+                                  OutIter out,
+                                  BinFn f,
+                                  ValueT v)
 {
   using Value = typename ::std::iterator_traits<Iter>::value_type;
-  const int n = end - begin;
-  const int p0 = std::min(n, omp_get_max_threads());
-  ::std::vector<Value> sums(p0, Value());
+  using Size = typename ::std::iterator_traits<Iter>::difference_type;
+  const Size n = end - begin;
+  if (n <= 0) {
+    return;
+  }
+  const int p0 =
+      static_cast<int>(std::min<Size>(n, Size(omp_get_max_threads())));
+  ::std::vector<Value> sums(p0, BinFn::identity());
 #pragma omp parallel num_threads(p0)
   {
     const int p = omp_get_num_threads();
     const int pid = omp_get_thread_num();
-    const int i0 = firstIndex(n, p, pid);
-    const int i1 = firstIndex(n, p, pid + 1);
-    inclusive_inplace(::RAJA::loop_exec{}, begin + i0, begin + i1, f);
-    sums[pid] = *(begin + i1 - 1);
+    const Size i0 = firstIndex(n, p, pid);
+    const Size i1 = firstIndex(n, p, pid + 1);
+
+    Value agg = BinFn::identity();
+    for (Size i = i0; i < i1; ++i) {
+      agg = f(agg, *(begin + i));
+    }
+    sums[pid] = agg;
+
 #pragma omp barrier
 #pragma omp single
     exclusive_inplace(
-        ::RAJA::loop_exec{}, sums.data(), sums.data() + p, f, BinFn::identity());
-    for (int i = i0; i < i1; ++i) {
-      *(begin + i) = f(*(begin + i), sums[pid]);
-    }
+        ::RAJA::loop_exec{}, sums.data(), sums.data() + p, f, Value(v));
+
+    simd::scan<Inclusive>(begin + i0, out + i0, i1 - i0, f, sums[pid]);
   }
 }
 
+/*!
+        \brief explicit inclusive inplace scan given range, function, and
+   initial value
+*/
+template <typename Policy, typename Iter, typename BinFn>
+concepts::enable_if<type_traits::is_openmp_policy<Policy>> inclusive_inplace(
+    const Policy&,
+    Iter begin,
+    Iter end,
+    BinFn f)
+{
+  reduce_then_scan<true>(begin, end, begin, f, BinFn::identity());
+}
+
 /*!
         \brief explicit exclusive inplace scan given range, function, and
    initial value
@@ -89,28 +128,7 @@ concepts::enable_if<type_traits::is_openmp_policy<Policy>> exclusive_inplace(
     BinFn f,
     ValueT v)
 {
-  using Value = typename ::std::iterator_traits<Iter>::value_type;
-  const int n = end - begin;
-  const int p0 = std::min(n, omp_get_max_threads());
-  ::std::vector<Value> sums(p0, v);
-#pragma omp parallel num_threads(p0)
-  {
-    const int p = omp_get_num_threads();
-    const int pid = omp_get_thread_num();
-    const int i0 = firstIndex(n, p, pid);
-    const int i1 = firstIndex(n, p, pid + 1);
-    const Value init = ((pid == 0) ? v : *(begin + i0 - 1));
-#pragma omp barrier
-    exclusive_inplace(loop_exec{}, begin + i0, begin + i1, f, init);
-    sums[pid] = *(begin + i1 - 1);
-#pragma omp barrier
-#pragma omp single
-    exclusive_inplace(
-        loop_exec{}, sums.data(), sums.data() + p, f, BinFn::identity());
-    for (int i = i0; i < i1; ++i) {
-      *(begin + i) = f(*(begin + i), sums[pid]);
-    }
-  }
+  reduce_then_scan<false>(begin, end, begin, f, v);
 }
 
 /*!
@@ -119,14 +137,13 @@ concepts::enable_if<type_traits::is_openmp_policy<Policy>> exclusive_inplace(
 */
 template <typename Policy, typename Iter, typename OutIter, typename BinFn>
 concepts::enable_if<type_traits::is_openmp_policy<Policy>> inclusive(
-    const Policy& exec,
+    const Policy&,
     Iter begin,
     Iter end,
     OutIter out,
     BinFn f)
 {
-  ::std::copy(begin, end, out);
-  inclusive_inplace(exec, out, out + (end - begin), f);
+  reduce_then_scan<true>(begin, end, out, f, BinFn::identity());
 }
 
 /*!
@@ -139,15 +156,207 @@ template <typename Policy,
           typename BinFn,
           typename ValueT>
 concepts::enable_if<type_traits::is_openmp_policy<Policy>> exclusive(
-    const Policy& exec,
+    const Policy&,
     Iter begin,
     Iter end,
     OutIter out,
     BinFn f,
     ValueT v)
 {
-  ::std::copy(begin, end, out);
-  exclusive_inplace(exec, out, out + (end - begin), f, v);
+  reduce_then_scan<false>(begin, end, out, f, v);
+}
+
+/*!
+        \brief reduce-then-scan of value(i) for i in [0, n), reporting the
+   result at i as emit(i, v)
+
+   The same as reduce_then_scan, except that value(i) is computed in both
+   the reduction and the scan pass instead of being read from memory, so
+   no temporary holds the scanned values.
+*/
+template <bool Inclusive,
+          typename Policy,
+          typename Size,
+          typename Values,
+          typename Emit,
+          typename BinFn,
+          typename ValueT>
+concepts::enable_if<type_traits::is_openmp_policy<Policy>> transform(
+    const Policy&,
+    Size n,
+    Values value,
+    Emit emit,
+    BinFn f,
+    ValueT v)
+{
+  using Value = typename std::decay<decltype(BinFn::identity())>::type;
+  if (n <= 0) {
+    return;
+  }
+  const int p0 =
+      static_cast<int>(std::min<Size>(n, Size(omp_get_max_threads())));
+  ::std::vector<Value> sums(p0, BinFn::identity());
+#pragma omp parallel num_threads(p0)
+  {
+    const int p = omp_get_num_threads();
+    const int pid = omp_get_thread_num();
+    const Size i0 = firstIndex(n, p, pid);
+    const Size i1 = firstIndex(n, p, pid + 1);
+
+    Value agg = BinFn::identity();
+    for (Size i = i0; i < i1; ++i) {
+      agg = f(agg, value(i));
+    }
+    sums[pid] = agg;
+
+#pragma omp barrier
+#pragma omp single
+    exclusive_inplace(
+        ::RAJA::loop_exec{}, sums.data(), sums.data() + p, f, Value(v));
+
+    ::RAJA::detail::transform_scan_block<Inclusive>(
+        i0, i1, value, emit, f, sums[pid]);
+  }
+}
+
+/*!
+        \brief segmented reduce-then-scan of [begin, end) into out
+
+   Like reduce_then_scan, except that each thread's block reduction also
+   records whether the block starts a segment. The single-threaded pass
+   turns these into the value carried into each block: the carry of the
+   previous block combined with its total, or just its total if a segment
+   starts inside it. Segments may therefore span any number of blocks.
+   out may equal begin.
+*/
+template <bool Inclusive,
+          typename Policy,
+          typename Iter,
+          typename Heads,
+          typename OutIter,
+          typename BinFn,
+          typename ValueT>
+concepts::enable_if<type_traits::is_openmp_policy<Policy>> segmented(
+    const Policy&,
+    Iter begin,
+    Iter end,
+    Heads heads,
+    OutIter out,
+    BinFn f,
+    ValueT v)
+{
+  using Value = typename ::std::iterator_traits<Iter>::value_type;
+  using Size = typename ::std::iterator_traits<Iter>::difference_type;
+  const Size n = end - begin;
+  if (n <= 0) {
+    return;
+  }
+  const Value init = v;
+  const int p0 =
+      static_cast<int>(std::min<Size>(n, Size(omp_get_max_threads())));
+  ::std::vector<Value> carries(p0, BinFn::identity());
+  ::std::vector<int> has_head(p0, 0);
+#pragma omp parallel num_threads(p0)
+  {
+    const int p = omp_get_num_threads();
+    const int pid = omp_get_thread_num();
+    const Size i0 = firstIndex(n, p, pid);
+    const Size i1 = firstIndex(n, p, pid + 1);
+
+    has_head[pid] = ::RAJA::detail::segmented_reduce_block(
+        begin, i0, i1, heads.at(i0), f, init, carries[pid]);
+
+#pragma omp barrier
+#pragma omp single
+    {
+      Value carry = init;
+      for (int t = 0; t < p; ++t) {
+        const Value next = has_head[t] ? carries[t] : f(carry, carries[t]);
+        carries[t] = carry;
+        carry = next;
+      }
+    }
+
+    ::RAJA::detail::segmented_scan_block<Inclusive>(
+        begin, out, i0, i1, heads.at(i0), f, init, carries[pid]);
+  }
+}
+
+/*!
+        \brief segmented reduction of value(i) for i in [0, n)
+
+   Each thread first counts the segment heads in its block and reduces the
+   values after its last head. A single thread then scans the head counts
+   and computes the value carried into each block as in segmented. Finally
+   each thread reports the heads in its block and the reductions of the
+   segments that end in it, so a segment spanning several blocks is
+   reported once, by the block it ends in. Returns the number of segments.
+*/
+template <typename Policy,
+          typename Size,
+          typename Heads,
+          typename Values,
+          typename BinFn,
+          typename EmitHead,
+          typename EmitValue>
+typename std::enable_if<type_traits::is_openmp_policy<Policy>::value,
+                        Size>::type
+segmented_reduce(const Policy&,
+                 Size n,
+                 Heads heads,
+                 Values value,
+                 BinFn f,
+                 EmitHead emit_head,
+                 EmitValue emit_value)
+{
+  using Value = typename std::decay<decltype(BinFn::identity())>::type;
+  if (n <= 0) {
+    return 0;
+  }
+  const int p0 =
+      static_cast<int>(std::min<Size>(n, Size(omp_get_max_threads())));
+  ::std::vector<Value> carries(p0, BinFn::identity());
+  // one extra entry so the scan leaves the total in counts[p0]
+  ::std::vector<Size> counts(p0 + 1, Size(0));
+#pragma omp parallel num_threads(p0)
+  {
+    const int p = omp_get_num_threads();
+    const int pid = omp_get_thread_num();
+    const Size i0 = firstIndex(n, p, pid);
+    const Size i1 = firstIndex(n, p, pid + 1);
+
+    counts[pid] = ::RAJA::detail::segmented_count_block(
+        i0, i1, heads.at(i0), value, f, carries[pid]);
+
+#pragma omp barrier
+#pragma omp single
+    {
+      Value carry = BinFn::identity();
+      for (int t = 0; t < p; ++t) {
+        const Value next =
+            counts[t] > 0 ? carries[t] : f(carry, carries[t]);
+        carries[t] = carry;
+        carry = next;
+      }
+      exclusive_inplace(::RAJA::loop_exec{},
+                        counts.data(),
+                        counts.data() + p0 + 1,
+                        operators::plus<Size>{},
+                        Size(0));
+    }
+
+    ::RAJA::detail::reduce_segments_block(i0,
+                                          i1,
+                                          pid == p - 1,
+                                          heads.at(i0),
+                                          value,
+                                          f,
+                                          carries[pid],
+                                          counts[pid],
+                                          emit_head,
+                                          emit_value);
+  }
+  return counts[p0];
 }
 
 }  // namespace scan
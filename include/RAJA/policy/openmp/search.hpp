@@ -0,0 +1,83 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA OpenMP search declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_search_openmp_HPP
+#define RAJA_search_openmp_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+
+#include <omp.h>
+
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/pattern/detail/search.hpp"
+
+#include "RAJA/policy/openmp/policy.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace search
+{
+
+/*!
+        \brief position of an element of the given range that satisfies pred,
+   the first one when First is true, or the length of the range if there is
+   none
+
+   Chunks are handed out in order, and a chunk is skipped once it cannot
+   change the answer.
+*/
+template <bool First, typename ExecPolicy, typename Iter, typename Predicate>
+::RAJA::detail::search_enable_if<type_traits::is_openmp_policy<ExecPolicy>,
+                                  Iter>
+find(const ExecPolicy&, Iter begin, Iter end, Predicate pred)
+{
+  using Size = ::RAJA::detail::SearchSize<Iter>;
+  const Size n = end - begin;
+  const Size chunk = ::RAJA::detail::search_chunk_size;
+  const Size nchunks = (n + chunk - 1) / chunk;
+  std::atomic<Size> found{n};
+  if (nchunks == 1) {
+    ::RAJA::detail::search_chunk<First>(begin, Size(0), n, n, pred, found);
+    return found.load();
+  }
+#pragma omp parallel for schedule(dynamic, 1)
+  for (Size c = 0; c < nchunks; ++c) {
+    ::RAJA::detail::search_chunk<First>(begin,
+                                        c * chunk,
+                                        std::min(n, (c + 1) * chunk),
+                                        n,
+                                        pred,
+                                        found);
+  }
+  return found.load();
+}
+
+}  // namespace search
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
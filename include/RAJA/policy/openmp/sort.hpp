@@ -0,0 +1,167 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA OpenMP sort declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_sort_openmp_HPP
+#define RAJA_sort_openmp_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+#include <omp.h>
+
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/pattern/detail/sort.hpp"
+
+#include "RAJA/policy/openmp/policy.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace sort
+{
+
+namespace openmp_detail
+{
+/*!
+        \brief block runner that hands each block to its own OpenMP thread
+
+   Ranges shorter than min_block elements per block are split into fewer
+   blocks, and short ranges are not split at all.
+*/
+struct runner {
+  static constexpr int min_block = 1 << 12;
+
+  template <typename Size>
+  int num_blocks(Size n) const
+  {
+    const Size max_blocks = n / min_block;
+    const int workers = omp_get_max_threads();
+    return static_cast<int>(
+        std::max<Size>(1, std::min<Size>(max_blocks, Size(workers))));
+  }
+
+  template <typename Body>
+  void operator()(int nb, Body&& body) const
+  {
+    if (nb == 1) {
+      body(0);
+      return;
+    }
+#pragma omp parallel for schedule(static) num_threads(nb)
+    for (int b = 0; b < nb; ++b) {
+      body(b);
+    }
+  }
+};
+}  // namespace openmp_detail
+
+/*!
+        \brief sort given range, radix sort for arithmetic keys ordered by
+   operators::less or operators::greater, merge sort otherwise
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if<type_traits::is_openmp_policy<ExecPolicy>>
+unstable(const ExecPolicy&, Iter begin, Iter end, Compare comp)
+{
+  ::RAJA::detail::sort_with<false>(openmp_detail::runner{}, begin, end, comp);
+}
+
+/*!
+        \brief stable sort given range, radix sort for arithmetic keys ordered
+   by operators::less or operators::greater, merge sort otherwise
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if<type_traits::is_openmp_policy<ExecPolicy>>
+stable(const ExecPolicy&, Iter begin, Iter end, Compare comp)
+{
+  ::RAJA::detail::sort_with<true>(openmp_detail::runner{}, begin, end, comp);
+}
+
+/*!
+        \brief sort given range of keys and range of values, values are
+   permuted along with the keys
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename ValIter,
+          typename Compare>
+concepts::enable_if<type_traits::is_openmp_policy<ExecPolicy>> unstable_pairs(
+    const ExecPolicy&,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  ::RAJA::detail::sort_pairs_with<false>(
+      openmp_detail::runner{}, keys_begin, keys_end, vals_begin, comp);
+}
+
+/*!
+        \brief stable sort given range of keys and range of values, values
+   are permuted along with the keys
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename ValIter,
+          typename Compare>
+concepts::enable_if<type_traits::is_openmp_policy<ExecPolicy>> stable_pairs(
+    const ExecPolicy&,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  ::RAJA::detail::sort_pairs_with<true>(
+      openmp_detail::runner{}, keys_begin, keys_end, vals_begin, comp);
+}
+
+/*!
+        \brief counting sort of the indices of the given keys into nbuckets
+   buckets, writing the bucket offsets and the permutation of the indices
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename OffsetIter,
+          typename PermIter>
+concepts::enable_if<type_traits::is_openmp_policy<ExecPolicy>> bucket(
+    const ExecPolicy&,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ::RAJA::detail::bucket_size<KeyIter> nbuckets,
+    OffsetIter offsets,
+    PermIter perm)
+{
+  ::RAJA::detail::bucket_with(openmp_detail::runner{},
+                              keys_begin,
+                              keys_end - keys_begin,
+                              nbuckets,
+                              offsets,
+                              perm);
+}
+
+}  // namespace sort
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
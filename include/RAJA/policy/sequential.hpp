@@ -21,11 +21,16 @@
 #define RAJA_sequential_HPP
 
 #include "RAJA/policy/sequential/atomic.hpp"
+#include "RAJA/policy/sequential/compact.hpp"
 #include "RAJA/policy/sequential/forall.hpp"
 #include "RAJA/policy/sequential/kernel.hpp"
+#include "RAJA/policy/sequential/merge.hpp"
 #include "RAJA/policy/sequential/policy.hpp"
 #include "RAJA/policy/sequential/reduce.hpp"
 #include "RAJA/policy/sequential/scan.hpp"
+#include "RAJA/policy/sequential/scatter.hpp"
+#include "RAJA/policy/sequential/search.hpp"
+#include "RAJA/policy/sequential/sort.hpp"
 
 
 #endif  // closing endif for header file include guard
@@ -32,6 +32,7 @@
 #include "RAJA/internal/fault_tolerance.hpp"
 
 #include "RAJA/pattern/detail/forall.hpp"
+#include "RAJA/pattern/params/reducer.hpp"
 
 namespace RAJA
 {
@@ -62,6 +63,20 @@ RAJA_INLINE void forall_impl(const seq_exec &, Iterable &&iter, Func &&body)
   }
 }
 
+template <typename Iterable, typename Func, typename... Params>
+RAJA_INLINE void forall_impl(const seq_exec &,
+                             Iterable &&iter,
+                             Func &&body,
+                             RAJA::detail::ParamPack<Params...> &params)
+{
+  RAJA_EXTRACT_BED_IT(iter);
+
+  RAJA_NO_SIMD
+  for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+    params.invoke(body, *(begin_it + i));
+  }
+}
+
 }  // namespace sequential
 
 }  // namespace policy
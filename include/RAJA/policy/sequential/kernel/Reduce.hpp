@@ -3,7 +3,7 @@
  *
  * \file
  *
- * \brief   Header file for sequential kernel loop collapse executors.
+ * \brief   Header file for sequential kernel reduction executors.
  *
  ******************************************************************************
  */
@@ -26,8 +26,17 @@ namespace RAJA
 namespace internal
 {
 
+template <>
+struct is_loop_reduce_policy<seq_reduce> : std::true_type {
+};
+
+//
+// Executor that handles sequential reductions outside of a loop.
 //
-// Executor that handles reductions for
+// As the last statement of the body of a statement::For, a seq_reduce Reduce
+// combines the values of the Param left by the iterations of that loop, see
+// LoopReduceForExecutor. Anywhere else there is a single value to combine,
+// so the enclosed statements are executed directly.
 //
 template <template <typename...> class ReduceOperator,
           typename ParamId,
@@ -39,9 +48,6 @@ struct StatementExecutor<
   template <typename Data>
   static RAJA_INLINE void exec(Data &&data)
   {
-    // since a sequential reduction is a NOP, and the single thread always
-    // has the reduced value, this is just a passthrough to the enclosed
-    // statements
     execute_statement_list<camp::list<EnclosedStmts...>, Types>(data);
   }
 };
@@ -23,11 +23,14 @@
 #include <algorithm>
 #include <functional>
 #include <iterator>
+#include <type_traits>
 
 #include "RAJA/util/macros.hpp"
 
 #include "RAJA/util/concepts.hpp"
 
+#include "RAJA/pattern/detail/scan.hpp"
+
 #include "RAJA/policy/sequential/policy.hpp"
 
 namespace RAJA
@@ -122,6 +125,94 @@ concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>> exclusive(
   }
 }
 
+/*!
+        \brief explicit transform scan of value(i) for i in [0, n) given
+   function and initial value, reporting the result at i as emit(i, v)
+*/
+template <bool Inclusive,
+          typename ExecPolicy,
+          typename Size,
+          typename Values,
+          typename Emit,
+          typename BinFn,
+          typename T>
+concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>> transform(
+    const ExecPolicy &,
+    Size n,
+    Values value,
+    Emit emit,
+    BinFn f,
+    T v)
+{
+  using Value = typename std::decay<decltype(BinFn::identity())>::type;
+  Value agg = v;
+  ::RAJA::detail::transform_scan_block<Inclusive>(
+      Size(0), n, value, emit, f, agg);
+}
+
+/*!
+        \brief explicit segmented scan given input range, segment heads,
+   output, function, and initial value of every segment
+*/
+template <bool Inclusive,
+          typename ExecPolicy,
+          typename Iter,
+          typename Heads,
+          typename OutIter,
+          typename BinFn,
+          typename T>
+concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>> segmented(
+    const ExecPolicy &,
+    const Iter begin,
+    const Iter end,
+    Heads heads,
+    OutIter out,
+    BinFn f,
+    T v)
+{
+  using Value = typename ::std::iterator_traits<Iter>::value_type;
+  using Size = typename ::std::iterator_traits<Iter>::difference_type;
+  const Value init = v;
+  ::RAJA::detail::segmented_scan_block<Inclusive>(
+      begin, out, Size(0), end - begin, heads.at(Size(0)), f, init, init);
+}
+
+/*!
+        \brief explicit segmented reduction of value(i) for i in [0, n) given
+   segment heads and function, reporting each segment's head and reduction;
+   returns the number of segments
+*/
+template <typename ExecPolicy,
+          typename Size,
+          typename Heads,
+          typename Values,
+          typename BinFn,
+          typename EmitHead,
+          typename EmitValue>
+typename std::enable_if<type_traits::is_sequential_policy<ExecPolicy>::value,
+                        Size>::type
+segmented_reduce(const ExecPolicy &,
+                 Size n,
+                 Heads heads,
+                 Values value,
+                 BinFn f,
+                 EmitHead emit_head,
+                 EmitValue emit_value)
+{
+  using Value = typename std::decay<decltype(BinFn::identity())>::type;
+  Value agg = BinFn::identity();
+  return ::RAJA::detail::reduce_segments_block(Size(0),
+                                               n,
+                                               true,
+                                               heads.at(Size(0)),
+                                               value,
+                                               f,
+                                               agg,
+                                               Size(0),
+                                               emit_head,
+                                               emit_value);
+}
+
 }  // namespace scan
 
 }  // namespace impl
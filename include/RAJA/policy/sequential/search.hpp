@@ -0,0 +1,64 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA sequential search declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_search_sequential_HPP
+#define RAJA_search_sequential_HPP
+
+#include "RAJA/config.hpp"
+
+#include <iterator>
+
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/pattern/detail/search.hpp"
+
+#include "RAJA/policy/sequential/policy.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace search
+{
+
+/*!
+        \brief position of the first element of the given range that
+   satisfies pred, or the length of the range if there is none
+*/
+template <bool First, typename ExecPolicy, typename Iter, typename Predicate>
+::RAJA::detail::search_enable_if<type_traits::is_sequential_policy<ExecPolicy>,
+                                  Iter>
+find(const ExecPolicy&, Iter begin, Iter end, Predicate pred)
+{
+  using Size = ::RAJA::detail::SearchSize<Iter>;
+  const Size n = end - begin;
+  for (Size i = 0; i < n; ++i) {
+    if (pred(*(begin + i))) {
+      return i;
+    }
+  }
+  return n;
+}
+
+}  // namespace search
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,168 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA sequential sort declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_sort_sequential_HPP
+#define RAJA_sort_sequential_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/pattern/detail/sort.hpp"
+
+#include "RAJA/policy/sequential/policy.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace sort
+{
+
+/*!
+        \brief sort given range, radix sort for arithmetic keys ordered by
+   operators::less or operators::greater, std::sort otherwise
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>,
+                    ::RAJA::detail::is_radix_sortable<
+                        ::RAJA::detail::sort_key<Iter>,
+                        Compare>>
+unstable(const ExecPolicy&, Iter begin, Iter end, Compare comp)
+{
+  ::RAJA::detail::sort_with<false>(
+      ::RAJA::detail::serial_sort_runner{}, begin, end, comp);
+}
+
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>,
+                    concepts::negate<::RAJA::detail::is_radix_sortable<
+                        ::RAJA::detail::sort_key<Iter>,
+                        Compare>>>
+unstable(const ExecPolicy&, Iter begin, Iter end, Compare comp)
+{
+  std::sort(begin, end, comp);
+}
+
+/*!
+        \brief stable sort given range, radix sort for arithmetic keys ordered
+   by operators::less or operators::greater, std::stable_sort otherwise
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>,
+                    ::RAJA::detail::is_radix_sortable<
+                        ::RAJA::detail::sort_key<Iter>,
+                        Compare>>
+stable(const ExecPolicy&, Iter begin, Iter end, Compare comp)
+{
+  ::RAJA::detail::sort_with<true>(
+      ::RAJA::detail::serial_sort_runner{}, begin, end, comp);
+}
+
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>,
+                    concepts::negate<::RAJA::detail::is_radix_sortable<
+                        ::RAJA::detail::sort_key<Iter>,
+                        Compare>>>
+stable(const ExecPolicy&, Iter begin, Iter end, Compare comp)
+{
+  std::stable_sort(begin, end, comp);
+}
+
+/*!
+        \brief sort given range of keys and range of values, values are
+   permuted along with the keys
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename ValIter,
+          typename Compare>
+concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>>
+unstable_pairs(
+    const ExecPolicy&,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  ::RAJA::detail::sort_pairs_with<false>(
+      ::RAJA::detail::serial_sort_runner{},
+      keys_begin,
+      keys_end,
+      vals_begin,
+      comp);
+}
+
+/*!
+        \brief stable sort given range of keys and range of values, values
+   are permuted along with the keys
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename ValIter,
+          typename Compare>
+concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>>
+stable_pairs(
+    const ExecPolicy&,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  ::RAJA::detail::sort_pairs_with<true>(
+      ::RAJA::detail::serial_sort_runner{},
+      keys_begin,
+      keys_end,
+      vals_begin,
+      comp);
+}
+
+/*!
+        \brief counting sort of the indices of the given keys into nbuckets
+   buckets, writing the bucket offsets and the permutation of the indices
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename OffsetIter,
+          typename PermIter>
+concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>> bucket(
+    const ExecPolicy&,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ::RAJA::detail::bucket_size<KeyIter> nbuckets,
+    OffsetIter offsets,
+    PermIter perm)
+{
+  ::RAJA::detail::bucket_with(::RAJA::detail::serial_sort_runner{},
+                              keys_begin,
+                              keys_end - keys_begin,
+                              nbuckets,
+                              offsets,
+                              perm);
+}
+
+}  // namespace sort
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -24,5 +24,6 @@
 #include "RAJA/policy/simd/policy.hpp"
 #include "RAJA/policy/simd/kernel/For.hpp"
 #include "RAJA/policy/simd/kernel/ForICount.hpp"
+#include "RAJA/policy/simd/scan.hpp"
 
 #endif  // closing endif for header file include guard
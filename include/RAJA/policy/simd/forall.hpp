@@ -37,6 +37,8 @@
 
 #include "RAJA/policy/simd/policy.hpp"
 
+#include "RAJA/pattern/params/reducer.hpp"
+
 namespace RAJA
 {
 namespace policy
@@ -59,6 +61,28 @@ RAJA_INLINE void forall_impl(const simd_exec &,
   }
 }
 
+/*!
+ * Parameter values are copied to the stack and combined after the loop.
+ * Every iteration updates the same private values, a dependence that the
+ * omp simd of RAJA_SIMD would need a reduction clause for, so this loop is
+ * left to the auto-vectorizer, which can privatize the values per lane.
+ */
+template <typename Iterable, typename Func, typename... Params>
+RAJA_INLINE void forall_impl(const simd_exec &,
+                             Iterable &&iter,
+                             Func &&loop_body,
+                             RAJA::detail::ParamPack<Params...> &params)
+{
+  auto begin = std::begin(iter);
+  auto end = std::end(iter);
+  auto distance = std::distance(begin, end);
+  auto priv = params.make_private();
+  for (decltype(distance) i = 0; i < distance; ++i) {
+    priv.invoke(loop_body, *(begin + i));
+  }
+  params.combine(priv);
+}
+
 }  // namespace simd
 
 }  // namespace policy
@@ -0,0 +1,542 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing the in-register prefix scan used for the
+ *          RAJA simd scans and for the serial portions of the RAJA loop,
+ *          OpenMP and TBB scans.
+ *
+ *          A block of contiguous values is loaded into a vector register,
+ *          scanned with log2(W) shift-and-combine steps, combined with the
+ *          value carried in from the previous block, and stored; the last
+ *          lane becomes the next carry. Kernels exist for AVX-512 and AVX2
+ *          and are selected at compile time from the target flags, which
+ *          the RAJA_VECTOR_SCAN_ISA CMake option sets.
+ *
+ *          Only combinations that give the same result as the scalar loop
+ *          and that are faster than it are vectorized: operators::plus on
+ *          32-bit integers, and operators::minimum and operators::maximum
+ *          on 32-bit signed integers, float and double. Floating point sums
+ *          are not vectorized since reassociation changes their rounding,
+ *          and 64-bit integer scans are already limited by the one
+ *          dependent instruction per element of the scalar loop. For
+ *          floating point minimum and maximum the result only differs from
+ *          the scalar loop when the input contains NaNs.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_scan_simd_HPP
+#define RAJA_scan_simd_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/policy/simd/policy.hpp"
+
+#if defined(__AVX512F__)
+#define RAJA_SIMD_SCAN_AVX512
+#elif defined(__AVX2__)
+#define RAJA_SIMD_SCAN_AVX2
+#endif
+
+namespace RAJA
+{
+namespace impl
+{
+namespace scan
+{
+namespace simd
+{
+
+/*!
+        \brief vector operations on lanes of Bytes bytes: load and store,
+   broadcast, shift up by S lanes and broadcast of the last lane
+
+   Lanes that are shifted in hold unspecified values.
+*/
+template <size_t Bytes>
+struct lanes {
+  static constexpr int width = 0;
+};
+
+/*!
+        \brief vectorized combine of two registers of T with BinFn, applied
+   lane by lane as f(a, b)
+*/
+template <typename T, typename BinFn>
+struct vec_op {
+  static constexpr bool value = false;
+};
+
+#if defined(RAJA_SIMD_SCAN_AVX512)
+
+template <>
+struct lanes<4> {
+  using reg = __m512i;
+  using mask = __mmask16;
+  static constexpr int width = 16;
+
+  static RAJA_INLINE reg load(void const* p) { return _mm512_loadu_si512(p); }
+  static RAJA_INLINE void store(void* p, reg x) { _mm512_storeu_si512(p, x); }
+  template <typename T>
+  static RAJA_INLINE reg set1(T v)
+  {
+    std::int32_t b;
+    std::memcpy(&b, &v, sizeof(b));
+    return _mm512_set1_epi32(b);
+  }
+  template <int S>
+  static RAJA_INLINE reg shift(reg x)
+  {
+    const reg idx = _mm512_set_epi32(15 - S, 14 - S, 13 - S, 12 - S,
+                                     11 - S, 10 - S, 9 - S, 8 - S,
+                                     7 - S, 6 - S, 5 - S, 4 - S,
+                                     3 - S, 2 - S, 1 - S, 0 - S);
+    return _mm512_permutexvar_epi32(
+        _mm512_max_epi32(idx, _mm512_setzero_si512()), x);
+  }
+  //! lanes below S keep a, the others take b
+  template <int S>
+  static RAJA_INLINE reg keep_low(reg a, reg b)
+  {
+    return _mm512_mask_blend_epi32(static_cast<mask>((1u << S) - 1u), b, a);
+  }
+  static RAJA_INLINE reg broadcast_last(reg x)
+  {
+    return _mm512_permutexvar_epi32(_mm512_set1_epi32(15), x);
+  }
+};
+
+template <>
+struct lanes<8> {
+  using reg = __m512i;
+  using mask = __mmask8;
+  static constexpr int width = 8;
+
+  static RAJA_INLINE reg load(void const* p) { return _mm512_loadu_si512(p); }
+  static RAJA_INLINE void store(void* p, reg x) { _mm512_storeu_si512(p, x); }
+  template <typename T>
+  static RAJA_INLINE reg set1(T v)
+  {
+    std::int64_t b;
+    std::memcpy(&b, &v, sizeof(b));
+    return _mm512_set1_epi64(b);
+  }
+  template <int S>
+  static RAJA_INLINE reg shift(reg x)
+  {
+    const reg idx = _mm512_set_epi64(7 - S, 6 - S, 5 - S, 4 - S,
+                                     3 - S, 2 - S, 1 - S, 0 - S);
+    return _mm512_permutexvar_epi64(
+        _mm512_max_epi64(idx, _mm512_setzero_si512()), x);
+  }
+  template <int S>
+  static RAJA_INLINE reg keep_low(reg a, reg b)
+  {
+    return _mm512_mask_blend_epi64(static_cast<mask>((1u << S) - 1u), b, a);
+  }
+  static RAJA_INLINE reg broadcast_last(reg x)
+  {
+    return _mm512_permutexvar_epi64(_mm512_set1_epi64(7), x);
+  }
+};
+
+template <typename T>
+struct vec_op<T, operators::plus<T>> {
+  static constexpr bool value = std::is_integral<T>::value && sizeof(T) == 4;
+  static RAJA_INLINE __m512i apply(__m512i a, __m512i b)
+  {
+    return _mm512_add_epi32(a, b);
+  }
+};
+
+template <typename T>
+struct vec_op<T, operators::minimum<T>> {
+  static constexpr bool value =
+      std::is_same<T, float>::value || std::is_same<T, double>::value
+      || (std::is_integral<T>::value && std::is_signed<T>::value
+          && sizeof(T) == 4);
+  // minimum(a, b) is (b < a) ? b : a
+  static RAJA_INLINE __m512i apply(__m512i a, __m512i b)
+  {
+    if (std::is_same<T, float>::value) {
+      const __m512 x = _mm512_castsi512_ps(a), y = _mm512_castsi512_ps(b);
+      return _mm512_castps_si512(
+          _mm512_mask_blend_ps(_mm512_cmp_ps_mask(y, x, _CMP_LT_OQ), x, y));
+    } else if (std::is_same<T, double>::value) {
+      const __m512d x = _mm512_castsi512_pd(a), y = _mm512_castsi512_pd(b);
+      return _mm512_castpd_si512(
+          _mm512_mask_blend_pd(_mm512_cmp_pd_mask(y, x, _CMP_LT_OQ), x, y));
+    }
+    return _mm512_min_epi32(a, b);
+  }
+};
+
+template <typename T>
+struct vec_op<T, operators::maximum<T>> {
+  static constexpr bool value = vec_op<T, operators::minimum<T>>::value;
+  // maximum(a, b) is (a >= b) ? a : b
+  static RAJA_INLINE __m512i apply(__m512i a, __m512i b)
+  {
+    if (std::is_same<T, float>::value) {
+      const __m512 x = _mm512_castsi512_ps(a), y = _mm512_castsi512_ps(b);
+      return _mm512_castps_si512(
+          _mm512_mask_blend_ps(_mm512_cmp_ps_mask(x, y, _CMP_GE_OQ), y, x));
+    } else if (std::is_same<T, double>::value) {
+      const __m512d x = _mm512_castsi512_pd(a), y = _mm512_castsi512_pd(b);
+      return _mm512_castpd_si512(
+          _mm512_mask_blend_pd(_mm512_cmp_pd_mask(x, y, _CMP_GE_OQ), y, x));
+    }
+    return _mm512_max_epi32(a, b);
+  }
+};
+
+#elif defined(RAJA_SIMD_SCAN_AVX2)
+
+template <>
+struct lanes<4> {
+  using reg = __m256i;
+  static constexpr int width = 8;
+
+  static RAJA_INLINE reg load(void const* p)
+  {
+    return _mm256_loadu_si256(static_cast<reg const*>(p));
+  }
+  static RAJA_INLINE void store(void* p, reg x)
+  {
+    _mm256_storeu_si256(static_cast<reg*>(p), x);
+  }
+  template <typename T>
+  static RAJA_INLINE reg set1(T v)
+  {
+    std::int32_t b;
+    std::memcpy(&b, &v, sizeof(b));
+    return _mm256_set1_epi32(b);
+  }
+  template <int S>
+  static RAJA_INLINE reg shift(reg x)
+  {
+    const reg idx = _mm256_set_epi32(
+        7 - S, 6 - S, 5 - S, 4 - S, 3 - S, 2 - S, 1 - S, 0 - S);
+    return _mm256_permutevar8x32_epi32(
+        x, _mm256_max_epi32(idx, _mm256_setzero_si256()));
+  }
+  //! lanes below S keep a, the others take b
+  template <int S>
+  static RAJA_INLINE reg keep_low(reg a, reg b)
+  {
+    return _mm256_blend_epi32(b, a, (1 << S) - 1);
+  }
+  static RAJA_INLINE reg broadcast_last(reg x)
+  {
+    return _mm256_permutevar8x32_epi32(x, _mm256_set1_epi32(7));
+  }
+};
+
+template <>
+struct lanes<8> {
+  using reg = __m256i;
+  static constexpr int width = 4;
+
+  static RAJA_INLINE reg load(void const* p)
+  {
+    return _mm256_loadu_si256(static_cast<reg const*>(p));
+  }
+  static RAJA_INLINE void store(void* p, reg x)
+  {
+    _mm256_storeu_si256(static_cast<reg*>(p), x);
+  }
+  template <typename T>
+  static RAJA_INLINE reg set1(T v)
+  {
+    std::int64_t b;
+    std::memcpy(&b, &v, sizeof(b));
+    return _mm256_set1_epi64x(b);
+  }
+  template <int S>
+  static RAJA_INLINE reg shift(reg x)
+  {
+    return S == 1 ? _mm256_permute4x64_epi64(x, _MM_SHUFFLE(2, 1, 0, 0))
+                  : _mm256_permute4x64_epi64(x, _MM_SHUFFLE(1, 0, 0, 0));
+  }
+  template <int S>
+  static RAJA_INLINE reg keep_low(reg a, reg b)
+  {
+    return _mm256_blend_epi32(b, a, (1 << (2 * S)) - 1);
+  }
+  static RAJA_INLINE reg broadcast_last(reg x)
+  {
+    return _mm256_permute4x64_epi64(x, _MM_SHUFFLE(3, 3, 3, 3));
+  }
+};
+
+template <typename T>
+struct vec_op<T, operators::plus<T>> {
+  static constexpr bool value = std::is_integral<T>::value && sizeof(T) == 4;
+  static RAJA_INLINE __m256i apply(__m256i a, __m256i b)
+  {
+    return _mm256_add_epi32(a, b);
+  }
+};
+
+template <typename T>
+struct vec_op<T, operators::minimum<T>> {
+  static constexpr bool value =
+      std::is_same<T, float>::value || std::is_same<T, double>::value
+      || (std::is_integral<T>::value && std::is_signed<T>::value
+          && sizeof(T) == 4);
+  // minimum(a, b) is (b < a) ? b : a
+  static RAJA_INLINE __m256i apply(__m256i a, __m256i b)
+  {
+    if (std::is_same<T, float>::value) {
+      const __m256 x = _mm256_castsi256_ps(a), y = _mm256_castsi256_ps(b);
+      return _mm256_castps_si256(
+          _mm256_blendv_ps(x, y, _mm256_cmp_ps(y, x, _CMP_LT_OQ)));
+    } else if (std::is_same<T, double>::value) {
+      const __m256d x = _mm256_castsi256_pd(a), y = _mm256_castsi256_pd(b);
+      return _mm256_castpd_si256(
+          _mm256_blendv_pd(x, y, _mm256_cmp_pd(y, x, _CMP_LT_OQ)));
+    }
+    return _mm256_min_epi32(a, b);
+  }
+};
+
+template <typename T>
+struct vec_op<T, operators::maximum<T>> {
+  static constexpr bool value = vec_op<T, operators::minimum<T>>::value;
+  // maximum(a, b) is (a >= b) ? a : b
+  static RAJA_INLINE __m256i apply(__m256i a, __m256i b)
+  {
+    if (std::is_same<T, float>::value) {
+      const __m256 x = _mm256_castsi256_ps(a), y = _mm256_castsi256_ps(b);
+      return _mm256_castps_si256(
+          _mm256_blendv_ps(y, x, _mm256_cmp_ps(x, y, _CMP_GE_OQ)));
+    } else if (std::is_same<T, double>::value) {
+      const __m256d x = _mm256_castsi256_pd(a), y = _mm256_castsi256_pd(b);
+      return _mm256_castpd_si256(
+          _mm256_blendv_pd(y, x, _mm256_cmp_pd(x, y, _CMP_GE_OQ)));
+    }
+    return _mm256_max_epi32(a, b);
+  }
+};
+
+#endif
+
+/*!
+        \brief true if scanning contiguous T with BinFn has a vector kernel
+*/
+template <typename T, typename BinFn>
+struct is_vectorizable
+    : std::integral_constant<bool,
+                             vec_op<T, BinFn>::value
+                                 && lanes<sizeof(T)>::width != 0> {
+};
+
+//! in-register inclusive scan, steps S, 2S, ... below the lane width
+template <typename L, typename Op, int S>
+struct prefix {
+  template <typename Reg>
+  static RAJA_INLINE Reg apply(Reg x)
+  {
+    x = L::template keep_low<S>(x, Op::apply(L::template shift<S>(x), x));
+    return prefix<L, Op, (2 * S < L::width ? 2 * S : 0)>::apply(x);
+  }
+};
+
+template <typename L, typename Op>
+struct prefix<L, Op, 0> {
+  template <typename Reg>
+  static RAJA_INLINE Reg apply(Reg x)
+  {
+    return x;
+  }
+};
+
+//! no vector kernel, leave all values to the scalar loop
+template <bool Inclusive, typename T, typename Size, typename BinFn>
+RAJA_INLINE Size scan_registers(std::false_type, T const*, T*, Size, T&)
+{
+  return 0;
+}
+
+//! scan the leading multiple of the lane width, updating carry
+template <bool Inclusive, typename T, typename Size, typename BinFn>
+RAJA_INLINE Size
+scan_registers(std::true_type, T const* in, T* out, Size n, T& carry)
+{
+  using L = lanes<sizeof(T)>;
+  using Op = vec_op<T, BinFn>;
+  constexpr int W = L::width;
+  Size i = 0;
+  auto vcarry = L::set1(carry);
+  for (; i + W <= n; i += W) {
+    auto x = Op::apply(vcarry, prefix<L, Op, 1>::apply(L::load(in + i)));
+    if (Inclusive) {
+      L::store(out + i, x);
+    } else {
+      L::store(out + i,
+               L::template keep_low<1>(vcarry, L::template shift<1>(x)));
+    }
+    vcarry = L::broadcast_last(x);
+  }
+  std::memcpy(&carry, &vcarry, sizeof(T));
+  return i;
+}
+
+/*!
+        \brief scan of [in, in + n) into out starting from carry, returning
+   the combination of carry with all n values; out may equal in
+
+   The scalar loop is used when no vector kernel exists and for the
+   remainder that does not fill a register.
+*/
+template <bool Inclusive, typename T, typename Size, typename BinFn>
+RAJA_INLINE T scan_block(T const* in, T* out, Size n, BinFn f, T carry)
+{
+  Size i = scan_registers<Inclusive, T, Size, BinFn>(
+      is_vectorizable<T, BinFn>{}, in, out, n, carry);
+  for (; i < n; ++i) {
+    const T x = in[i];
+    if (Inclusive) {
+      carry = f(carry, x);
+      out[i] = carry;
+    } else {
+      out[i] = carry;
+      carry = f(carry, x);
+    }
+  }
+  return carry;
+}
+
+/*!
+        \brief scan of n values from in into out starting from carry for any
+   iterators, using the vector kernel when both are pointers to T
+*/
+template <bool Inclusive,
+          typename Iter,
+          typename OutIter,
+          typename Size,
+          typename BinFn,
+          typename T>
+RAJA_INLINE T scan(Iter in, OutIter out, Size n, BinFn f, T carry)
+{
+  for (Size i = 0; i < n; ++i) {
+    const T x = *(in + i);
+    if (Inclusive) {
+      carry = f(carry, x);
+      *(out + i) = carry;
+    } else {
+      *(out + i) = carry;
+      carry = f(carry, x);
+    }
+  }
+  return carry;
+}
+
+template <bool Inclusive, typename T, typename Size, typename BinFn>
+RAJA_INLINE T scan(T const* in, T* out, Size n, BinFn f, T carry)
+{
+  return scan_block<Inclusive>(in, out, n, f, carry);
+}
+
+template <bool Inclusive, typename T, typename Size, typename BinFn>
+RAJA_INLINE T scan(T* in, T* out, Size n, BinFn f, T carry)
+{
+  return scan_block<Inclusive>(static_cast<T const*>(in), out, n, f, carry);
+}
+
+}  // namespace simd
+
+/*!
+        \brief explicit inclusive inplace scan given range, function, and
+   initial value
+*/
+template <typename Iter, typename BinFn>
+void inclusive_inplace(const ::RAJA::simd_exec &,
+                       Iter begin,
+                       Iter end,
+                       BinFn f)
+{
+  using Value = typename ::std::iterator_traits<Iter>::value_type;
+  const Value first = *begin;
+  simd::scan<true>(begin + 1, begin + 1, end - begin - 1, f, first);
+}
+
+/*!
+        \brief explicit exclusive inplace scan given range, function, and
+   initial value
+*/
+template <typename Iter, typename BinFn, typename T>
+void exclusive_inplace(const ::RAJA::simd_exec &,
+                       Iter begin,
+                       Iter end,
+                       BinFn f,
+                       T v)
+{
+  using Value = typename ::std::iterator_traits<Iter>::value_type;
+  simd::scan<false>(begin, begin, end - begin, f, Value(v));
+}
+
+/*!
+        \brief explicit inclusive scan given input range, output, function, and
+   initial value
+*/
+template <typename Iter, typename OutIter, typename BinFn>
+void inclusive(const ::RAJA::simd_exec &,
+               const Iter begin,
+               const Iter end,
+               OutIter out,
+               BinFn f)
+{
+  using Value = typename ::std::iterator_traits<Iter>::value_type;
+  const Value first = *begin;
+  *out = first;
+  simd::scan<true>(begin + 1, out + 1, end - begin - 1, f, first);
+}
+
+/*!
+        \brief explicit exclusive scan given input range, output, function, and
+   initial value
+*/
+template <typename Iter, typename OutIter, typename BinFn, typename T>
+void exclusive(const ::RAJA::simd_exec &,
+               const Iter begin,
+               const Iter end,
+               OutIter out,
+               BinFn f,
+               T v)
+{
+  using Value = typename ::std::iterator_traits<Iter>::value_type;
+  simd::scan<false>(begin, out, end - begin, f, Value(v));
+}
+
+}  // namespace scan
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#undef RAJA_SIMD_SCAN_AVX512
+#undef RAJA_SIMD_SCAN_AVX2
+
+#endif  // closing endif for header file include guard
@@ -22,10 +22,16 @@
 
 #if defined(RAJA_ENABLE_TBB)
 
+#include "RAJA/policy/tbb/compact.hpp"
 #include "RAJA/policy/tbb/forall.hpp"
+#include "RAJA/policy/tbb/kernel.hpp"
+#include "RAJA/policy/tbb/merge.hpp"
 #include "RAJA/policy/tbb/policy.hpp"
 #include "RAJA/policy/tbb/reduce.hpp"
 #include "RAJA/policy/tbb/scan.hpp"
+#include "RAJA/policy/tbb/scatter.hpp"
+#include "RAJA/policy/tbb/search.hpp"
+#include "RAJA/policy/tbb/sort.hpp"
 
 #endif
 
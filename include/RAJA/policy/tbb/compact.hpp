@@ -0,0 +1,214 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA TBB stream compaction declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_compact_tbb_HPP
+#define RAJA_compact_tbb_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#include <tbb/tbb.h>
+
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/pattern/detail/compact.hpp"
+
+#include "RAJA/policy/tbb/policy.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace compact
+{
+
+namespace tbb_detail
+{
+/*!
+        \brief parallel_scan body counting the selected (and unselected)
+   elements; in the final scan selected elements x go to sel(k, x) and
+   unselected ones to rest(r, x), k and r being the number of selected and
+   unselected elements preceding x
+*/
+template <typename Iter, typename Predicate, typename Selected, typename Rest>
+struct compact_adapter {
+  using Size = ::RAJA::detail::CompactSize<Iter>;
+
+  Size sel_count;
+  Size rest_count;
+  Iter const& in;
+  Predicate pred;
+  Selected sel;
+  Rest rest;
+
+  compact_adapter(Iter const& in_, Predicate pred_, Selected sel_, Rest rest_)
+      : sel_count(0), rest_count(0), in(in_), pred(pred_), sel(sel_),
+        rest(rest_)
+  {
+  }
+
+  compact_adapter(compact_adapter& b, tbb::split)
+      : sel_count(0), rest_count(0), in(b.in), pred(b.pred), sel(b.sel),
+        rest(b.rest)
+  {
+  }
+
+  template <typename Tag>
+  void operator()(const tbb::blocked_range<Size>& r, Tag)
+  {
+    for (Size i = r.begin(); i < r.end(); ++i) {
+      if (pred(*(in + i))) {
+        if (Tag::is_final_scan()) sel(sel_count, *(in + i));
+        ++sel_count;
+      } else {
+        if (Tag::is_final_scan()) rest(rest_count, *(in + i));
+        ++rest_count;
+      }
+    }
+  }
+
+  void reverse_join(const compact_adapter& a)
+  {
+    sel_count += a.sel_count;
+    rest_count += a.rest_count;
+  }
+
+  void assign(const compact_adapter& b)
+  {
+    sel_count = b.sel_count;
+    rest_count = b.rest_count;
+  }
+};
+
+template <typename Iter, typename Predicate, typename Selected, typename Rest>
+RAJA_INLINE ::RAJA::detail::CompactSize<Iter> compact_scan(Iter begin,
+                                                           Iter end,
+                                                           Predicate pred,
+                                                           Selected sel,
+                                                           Rest rest)
+{
+  using Size = ::RAJA::detail::CompactSize<Iter>;
+  auto adapter = compact_adapter<Iter, Predicate, Selected, Rest>{
+      begin, pred, sel, rest};
+  tbb::parallel_scan(tbb::blocked_range<Size>{0, end - begin}, adapter);
+  return adapter.sel_count;
+}
+
+//! scatter target that discards its element
+struct discard {
+  template <typename Size, typename T>
+  void operator()(Size, T const&) const
+  {
+  }
+};
+}  // namespace tbb_detail
+
+/*!
+        \brief copy the elements of the given range that satisfy pred to out,
+   returning how many were copied
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename OutIter,
+          typename Predicate>
+::RAJA::detail::compact_enable_if<type_traits::is_tbb_policy<ExecPolicy>,
+                                   Iter>
+copy_if(const ExecPolicy&, Iter begin, Iter end, OutIter out, Predicate pred)
+{
+  using Size = ::RAJA::detail::CompactSize<Iter>;
+  return tbb_detail::compact_scan(
+      begin,
+      end,
+      pred,
+      [=](Size k, ::RAJA::detail::CompactVal<Iter> const& x) {
+        *(out + k) = x;
+      },
+      tbb_detail::discard{});
+}
+
+/*!
+        \brief move the elements of the given range that do not satisfy pred
+   to its front in order, returning how many were kept
+*/
+template <typename ExecPolicy, typename Iter, typename Predicate>
+::RAJA::detail::compact_enable_if<type_traits::is_tbb_policy<ExecPolicy>,
+                                   Iter>
+remove_if(const ExecPolicy&, Iter begin, Iter end, Predicate pred)
+{
+  using Size = ::RAJA::detail::CompactSize<Iter>;
+  using Value = ::RAJA::detail::CompactVal<Iter>;
+  ::std::vector<Value> kept(end - begin);
+  Value* const tmp = kept.data();
+  const Size removed = tbb_detail::compact_scan(
+      begin,
+      end,
+      pred,
+      tbb_detail::discard{},
+      [=](Size r, Value const& x) { tmp[r] = x; });
+  const Size count = (end - begin) - removed;
+  tbb::parallel_for(tbb::blocked_range<Size>{0, count},
+                    [=](const tbb::blocked_range<Size>& r) {
+                      std::copy(tmp + r.begin(),
+                                tmp + r.end(),
+                                begin + r.begin());
+                    });
+  return count;
+}
+
+/*!
+        \brief stable partition of the given range, returning the number of
+   elements that satisfy pred
+*/
+template <typename ExecPolicy, typename Iter, typename Predicate>
+::RAJA::detail::compact_enable_if<type_traits::is_tbb_policy<ExecPolicy>,
+                                   Iter>
+partition(const ExecPolicy&, Iter begin, Iter end, Predicate pred)
+{
+  using Size = ::RAJA::detail::CompactSize<Iter>;
+  using Value = ::RAJA::detail::CompactVal<Iter>;
+  const Size n = end - begin;
+  // the unselected elements are stored from the back in reverse, since
+  // the number of selected elements is only known after the scan
+  ::std::vector<Value> parts(n);
+  Value* const tmp = parts.data();
+  const Size count = tbb_detail::compact_scan(
+      begin,
+      end,
+      pred,
+      [=](Size k, Value const& x) { tmp[k] = x; },
+      [=](Size r, Value const& x) { tmp[n - 1 - r] = x; });
+  tbb::parallel_for(tbb::blocked_range<Size>{0, n},
+                    [=](const tbb::blocked_range<Size>& r) {
+                      for (Size i = r.begin(); i < r.end(); ++i) {
+                        *(begin + i) = i < count ? tmp[i]
+                                                 : tmp[n - 1 - (i - count)];
+                      }
+                    });
+  return count;
+}
+
+}  // namespace compact
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -32,6 +32,7 @@
 #include "RAJA/index/RangeSegment.hpp"
 #include "RAJA/internal/fault_tolerance.hpp"
 #include "RAJA/pattern/forall.hpp"
+#include "RAJA/pattern/params/reducer.hpp"
 #include "RAJA/policy/tbb/policy.hpp"
 #include "RAJA/util/types.hpp"
 
@@ -130,6 +131,99 @@ RAJA_INLINE void forall_impl(const tbb_for_static<ChunkSize>&,
       tbb_static_partitioner{});
 }
 
+/**
+ * @brief TBB dynamic for implementation with kernel parameters
+ *
+ * @param p tbb tag
+ * @param iter any iterable
+ * @param loop_body loop body
+ * @param params kernel parameter pack (e.g., reduce_sum(&x))
+ *
+ * @return None
+ *
+ * Each range handed out by parallel_reduce accumulates into its own copy
+ * of the parameter pack and privatizes the loop body, and the pack copies
+ * are combined pairwise by TBB.
+ */
+template <typename Iterable, typename Func, typename... Params>
+RAJA_INLINE void forall_impl(const tbb_for_dynamic& p,
+                             Iterable&& iter,
+                             Func&& loop_body,
+                             RAJA::detail::ParamPack<Params...>& params)
+{
+  using std::begin;
+  using std::distance;
+  using std::end;
+  using brange = ::tbb::blocked_range<size_t>;
+  using pack = RAJA::detail::ParamPack<Params...>;
+  auto b = begin(iter);
+  size_t dist = std::abs(distance(begin(iter), end(iter)));
+  pack result = ::tbb::parallel_reduce(
+      brange(0, dist, p.grain_size),
+      params.make_private(),
+      [=](const brange& r, pack priv) {
+        using RAJA::internal::thread_privatize;
+        auto privatizer = thread_privatize(loop_body);
+        auto body = privatizer.get_priv();
+        for (auto i = r.begin(); i != r.end(); ++i)
+          priv.invoke(body, b[i]);
+        return priv;
+      },
+      [](pack lhs, pack const& rhs) {
+        lhs.combine(rhs);
+        return lhs;
+      });
+  params.combine(result);
+}
+
+/**
+ * @brief TBB static for implementation with kernel parameters
+ *
+ * @param tbb_for_static tbb tag
+ * @param iter any iterable
+ * @param loop_body loop body
+ * @param params kernel parameter pack (e.g., reduce_sum(&x))
+ *
+ * @return None
+ *
+ * Same as the dynamic variant above, but uses the static partitioner and
+ * the compile-time grain size from the policy.
+ */
+template <typename Iterable,
+          typename Func,
+          size_t ChunkSize,
+          typename... Params>
+RAJA_INLINE void forall_impl(const tbb_for_static<ChunkSize>&,
+                             Iterable&& iter,
+                             Func&& loop_body,
+                             RAJA::detail::ParamPack<Params...>& params)
+{
+  using std::begin;
+  using std::distance;
+  using std::end;
+  using brange = ::tbb::blocked_range<size_t>;
+  using pack = RAJA::detail::ParamPack<Params...>;
+  auto b = begin(iter);
+  size_t dist = std::abs(distance(begin(iter), end(iter)));
+  pack result = ::tbb::parallel_reduce(
+      brange(0, dist, ChunkSize),
+      params.make_private(),
+      [=](const brange& r, pack priv) {
+        using RAJA::internal::thread_privatize;
+        auto privatizer = thread_privatize(loop_body);
+        auto body = privatizer.get_priv();
+        for (auto i = r.begin(); i != r.end(); ++i)
+          priv.invoke(body, b[i]);
+        return priv;
+      },
+      [](pack lhs, pack const& rhs) {
+        lhs.combine(rhs);
+        return lhs;
+      },
+      tbb_static_partitioner{});
+  params.combine(result);
+}
+
 }  // namespace tbb
 }  // namespace policy
 
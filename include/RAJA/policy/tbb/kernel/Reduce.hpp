@@ -0,0 +1,72 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for TBB kernel reduction executors.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_tbb_kernel_Reduce_HPP
+#define RAJA_policy_tbb_kernel_Reduce_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_TBB)
+
+#include "RAJA/pattern/kernel/Reduce.hpp"
+#include "RAJA/pattern/kernel/internal.hpp"
+
+#include "RAJA/policy/tbb/policy.hpp"
+
+namespace RAJA
+{
+
+namespace internal
+{
+
+template <>
+struct is_loop_reduce_policy<tbb_reduce> : std::true_type {
+};
+
+//
+// Executor that handles TBB reductions outside of a loop.
+//
+// As the last statement of the body of a statement::For, e.g. one with a
+// tbb_for_exec policy, a tbb_reduce Reduce combines the values of the Param
+// left by the iterations of that loop: the iterations of each task are folded
+// into a partial value of the task, and the partial values of the tasks are
+// combined when the tasks finish, see LoopReduceForExecutor. Anywhere else
+// there is a single value to combine, so the enclosed statements are executed
+// directly.
+//
+template <template <typename...> class ReduceOperator,
+          typename ParamId,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<
+    statement::Reduce<tbb_reduce, ReduceOperator, ParamId, EnclosedStmts...>,
+    Types> {
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &&data)
+  {
+    execute_statement_list<camp::list<EnclosedStmts...>, Types>(data);
+  }
+};
+
+}  // namespace internal
+
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_TBB guard
+
+#endif  // closing endif for header file include guard
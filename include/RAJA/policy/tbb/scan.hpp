@@ -23,13 +23,17 @@
 #include <algorithm>
 #include <functional>
 #include <iterator>
+#include <type_traits>
 
 #include <tbb/tbb.h>
 
 #include "RAJA/util/concepts.hpp"
 #include "RAJA/util/macros.hpp"
 
+#include "RAJA/pattern/detail/scan.hpp"
+
 #include "RAJA/policy/sequential/policy.hpp"
+#include "RAJA/policy/simd/scan.hpp"
 
 namespace RAJA
 {
@@ -73,10 +77,17 @@ struct scan_adapter_inclusive : scan_adapter<T, InIter, OutIter, Fn> {
   template <typename Tag>
   void operator()(const tbb::blocked_range<Index_type>& r, Tag)
   {
+    if (Tag::is_final_scan()) {
+      this->agg = simd::scan<true>(this->in + r.begin(),
+                                   this->out + r.begin(),
+                                   r.end() - r.begin(),
+                                   this->fn,
+                                   this->agg);
+      return;
+    }
     T temp = this->agg;
     for (Index_type i = r.begin(); i < r.end(); ++i) {
       temp = this->fn(temp, this->in[i]);
-      if (Tag::is_final_scan()) this->out[i] = temp;
     }
     this->agg = temp;
   }
@@ -91,13 +102,209 @@ struct scan_adapter_exclusive : scan_adapter<T, InIter, OutIter, Fn> {
   void operator()(const tbb::blocked_range<Index_type>& r, Tag)
   {
     if (r.begin() == 0) this->agg = this->init;
+    if (Tag::is_final_scan()) {
+      this->agg = simd::scan<false>(this->in + r.begin(),
+                                    this->out + r.begin(),
+                                    r.end() - r.begin(),
+                                    this->fn,
+                                    this->agg);
+      return;
+    }
     for (Index_type i = r.begin(); i < r.end(); ++i) {
-      auto t = this->in[i];
-      if (Tag::is_final_scan()) this->out[i] = this->agg;
-      this->agg = this->fn(this->agg, t);
+      this->agg = this->fn(this->agg, this->in[i]);
     }
   }
 };
+
+/*!
+        \brief parallel_scan body scanning value(i); the final scan reports
+   the result at i as emit(i, v)
+*/
+template <bool Inclusive,
+          typename T,
+          typename Size,
+          typename Values,
+          typename Emit,
+          typename Fn>
+struct transform_scan_adapter {
+  T agg;
+  Values value;
+  Emit emit;
+  Fn fn;
+
+  transform_scan_adapter(Values value_, Emit emit_, Fn fn_, T const& init_)
+      : agg(init_), value(value_), emit(emit_), fn(fn_)
+  {
+  }
+
+  transform_scan_adapter(transform_scan_adapter& b, tbb::split)
+      : agg(Fn::identity()), value(b.value), emit(b.emit), fn(b.fn)
+  {
+  }
+
+  template <typename Tag>
+  void operator()(const tbb::blocked_range<Size>& r, Tag)
+  {
+    if (Tag::is_final_scan()) {
+      ::RAJA::detail::transform_scan_block<Inclusive>(
+          r.begin(), r.end(), value, emit, fn, agg);
+    } else {
+      T temp = agg;
+      for (Size i = r.begin(); i < r.end(); ++i) {
+        temp = fn(temp, value(i));
+      }
+      agg = temp;
+    }
+  }
+
+  void reverse_join(const transform_scan_adapter& a) { agg = fn(a.agg, agg); }
+
+  void assign(const transform_scan_adapter& b) { agg = b.agg; }
+};
+
+template <bool Inclusive,
+          typename T,
+          typename InIter,
+          typename OutIter,
+          typename Heads,
+          typename Fn>
+struct segmented_scan_adapter {
+  T agg;
+  bool has_head;
+  InIter const& in;
+  OutIter out;
+  Heads heads;
+  Fn fn;
+  T const init;
+
+  segmented_scan_adapter(InIter const& in_,
+                         OutIter out_,
+                         Heads heads_,
+                         Fn fn_,
+                         T const& init_)
+      : agg(Fn::identity()), has_head(false), in(in_), out(out_),
+        heads(heads_), fn(fn_), init(init_)
+  {
+  }
+
+  segmented_scan_adapter(segmented_scan_adapter& b, tbb::split)
+      : agg(Fn::identity()), has_head(false), in(b.in), out(b.out),
+        heads(b.heads), fn(b.fn), init(b.init)
+  {
+  }
+
+  template <typename Tag>
+  void operator()(const tbb::blocked_range<Index_type>& r, Tag)
+  {
+    Heads head = heads.at(r.begin());
+    T temp = agg;
+    for (Index_type i = r.begin(); i < r.end(); ++i) {
+      const T x = in[i];
+      if (head(i)) {
+        temp = init;
+        has_head = true;
+      }
+      if (Inclusive) {
+        temp = fn(temp, x);
+        if (Tag::is_final_scan()) out[i] = temp;
+      } else {
+        if (Tag::is_final_scan()) out[i] = temp;
+        temp = fn(temp, x);
+      }
+    }
+    agg = temp;
+  }
+
+  // a left neighbor only contributes if this part starts no segment
+  void reverse_join(const segmented_scan_adapter& a)
+  {
+    if (!has_head) agg = fn(a.agg, agg);
+    has_head = has_head || a.has_head;
+  }
+
+  void assign(const segmented_scan_adapter& b)
+  {
+    agg = b.agg;
+    has_head = b.has_head;
+  }
+};
+
+/*!
+        \brief parallel_scan body counting the segment heads and reducing the
+   values after the last one; the final scan reports every head and every
+   completed segment reduction
+*/
+template <typename T,
+          typename Size,
+          typename Heads,
+          typename Values,
+          typename Fn,
+          typename EmitHead,
+          typename EmitValue>
+struct segmented_reduce_adapter {
+  T agg;
+  Size nheads;
+  Size const n;
+  Heads heads;
+  Values value;
+  Fn fn;
+  EmitHead emit_head;
+  EmitValue emit_value;
+
+  segmented_reduce_adapter(Size n_,
+                           Heads heads_,
+                           Values value_,
+                           Fn fn_,
+                           EmitHead emit_head_,
+                           EmitValue emit_value_)
+      : agg(Fn::identity()), nheads(0), n(n_), heads(heads_), value(value_),
+        fn(fn_), emit_head(emit_head_), emit_value(emit_value_)
+  {
+  }
+
+  segmented_reduce_adapter(segmented_reduce_adapter& b, tbb::split)
+      : agg(Fn::identity()), nheads(0), n(b.n), heads(b.heads),
+        value(b.value), fn(b.fn), emit_head(b.emit_head),
+        emit_value(b.emit_value)
+  {
+  }
+
+  template <typename Tag>
+  void operator()(const tbb::blocked_range<Size>& r, Tag)
+  {
+    if (Tag::is_final_scan()) {
+      nheads = ::RAJA::detail::reduce_segments_block(r.begin(),
+                                                     r.end(),
+                                                     r.end() == n,
+                                                     heads.at(r.begin()),
+                                                     value,
+                                                     fn,
+                                                     agg,
+                                                     nheads,
+                                                     emit_head,
+                                                     emit_value);
+    } else {
+      T temp;
+      const Size count = ::RAJA::detail::segmented_count_block(
+          r.begin(), r.end(), heads.at(r.begin()), value, fn, temp);
+      agg = count > 0 ? temp : fn(agg, temp);
+      nheads += count;
+    }
+  }
+
+  // a left neighbor only contributes if this part starts no segment
+  void reverse_join(const segmented_reduce_adapter& a)
+  {
+    if (nheads == 0) agg = fn(a.agg, agg);
+    nheads += a.nheads;
+  }
+
+  void assign(const segmented_reduce_adapter& b)
+  {
+    agg = b.agg;
+    nheads = b.nheads;
+  }
+};
 }  // namespace detail
 
 /*!
@@ -192,6 +399,105 @@ concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>> exclusive(
                      adapter);
 }
 
+/*!
+        \brief explicit transform scan of value(i) for i in [0, n) given
+   function and initial value, reporting the result at i as emit(i, v)
+*/
+template <bool Inclusive,
+          typename ExecPolicy,
+          typename Size,
+          typename Values,
+          typename Emit,
+          typename BinFn,
+          typename T>
+concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>> transform(
+    const ExecPolicy&,
+    Size n,
+    Values value,
+    Emit emit,
+    BinFn f,
+    T v)
+{
+  using Value = typename std::decay<decltype(BinFn::identity())>::type;
+  auto adapter = detail::transform_scan_adapter<Inclusive,
+                                                Value,
+                                                Size,
+                                                Values,
+                                                Emit,
+                                                BinFn>{
+      value, emit, f, Value(v)};
+  tbb::parallel_scan(tbb::blocked_range<Size>{0, n}, adapter);
+}
+
+/*!
+        \brief explicit segmented scan given input range, segment heads,
+   output, function, and initial value of every segment
+*/
+template <bool Inclusive,
+          typename ExecPolicy,
+          typename Iter,
+          typename Heads,
+          typename OutIter,
+          typename BinFn,
+          typename T>
+concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>> segmented(
+    const ExecPolicy&,
+    const Iter begin,
+    const Iter end,
+    Heads heads,
+    OutIter out,
+    BinFn f,
+    T v)
+{
+  auto adapter = detail::segmented_scan_adapter<
+      Inclusive,
+      typename std::iterator_traits<Iter>::value_type,
+      Iter,
+      OutIter,
+      Heads,
+      BinFn>{begin, out, heads, f, v};
+  tbb::parallel_scan(tbb::blocked_range<Index_type>{0,
+                                                    std::distance(begin, end)},
+                     adapter);
+}
+
+/*!
+        \brief segmented reduction of value(i) for i in [0, n) given segment
+   heads and function, reporting each segment's head and reduction; returns
+   the number of segments
+*/
+template <typename ExecPolicy,
+          typename Size,
+          typename Heads,
+          typename Values,
+          typename BinFn,
+          typename EmitHead,
+          typename EmitValue>
+typename std::enable_if<type_traits::is_tbb_policy<ExecPolicy>::value,
+                        Size>::type
+segmented_reduce(const ExecPolicy&,
+                 Size n,
+                 Heads heads,
+                 Values value,
+                 BinFn f,
+                 EmitHead emit_head,
+                 EmitValue emit_value)
+{
+  if (n <= 0) {
+    return 0;
+  }
+  auto adapter = detail::segmented_reduce_adapter<
+      typename std::decay<decltype(BinFn::identity())>::type,
+      Size,
+      Heads,
+      Values,
+      BinFn,
+      EmitHead,
+      EmitValue>{n, heads, value, f, emit_head, emit_value};
+  tbb::parallel_scan(tbb::blocked_range<Size>{0, n}, adapter);
+  return adapter.nheads;
+}
+
 }  // namespace scan
 
 }  // namespace impl
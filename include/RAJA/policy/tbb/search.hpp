@@ -0,0 +1,72 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA TBB search declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_search_tbb_HPP
+#define RAJA_search_tbb_HPP
+
+#include "RAJA/config.hpp"
+
+#include <atomic>
+#include <iterator>
+
+#include <tbb/tbb.h>
+
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/pattern/detail/search.hpp"
+
+#include "RAJA/policy/tbb/policy.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace search
+{
+
+/*!
+        \brief position of an element of the given range that satisfies pred,
+   the first one when First is true, or the length of the range if there is
+   none
+
+   A chunk is skipped once it cannot change the answer.
+*/
+template <bool First, typename ExecPolicy, typename Iter, typename Predicate>
+::RAJA::detail::search_enable_if<type_traits::is_tbb_policy<ExecPolicy>,
+                                  Iter>
+find(const ExecPolicy&, Iter begin, Iter end, Predicate pred)
+{
+  using Size = ::RAJA::detail::SearchSize<Iter>;
+  const Size n = end - begin;
+  std::atomic<Size> found{n};
+  tbb::parallel_for(
+      tbb::blocked_range<Size>{0, n, ::RAJA::detail::search_chunk_size},
+      [&](const tbb::blocked_range<Size>& r) {
+        ::RAJA::detail::search_chunk<First>(
+            begin, r.begin(), r.end(), n, pred, found);
+      });
+  return found.load();
+}
+
+}  // namespace search
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -18,12 +18,17 @@
 #ifndef RAJA_BASIC_MEMPOOL_HPP
 #define RAJA_BASIC_MEMPOOL_HPP
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
 #include <list>
 #include <map>
+#include <memory>
+#include <vector>
 
 #include "RAJA/util/align.hpp"
 #include "RAJA/util/mutex.hpp"
@@ -239,6 +244,231 @@ private:
   used_type m_used_space;
 };
 
+
+/*! \class SizeClassCache
+ ******************************************************************************
+ *
+ * \brief  SizeClassCache serves small allocations of class MemPool in O(1)
+ * from power of two size classes.
+ *
+ * Each class carves blocks from slabs of slab_size bytes taken from a
+ * MemoryArena, and freed blocks go to a free list of their class. Slabs are
+ * aligned to slab_size, so the slab of a block is found by masking its
+ * address. All book-keeping is kept on the host, so the pool memory itself
+ * is never touched and may be device memory.
+ *
+ * Slabs are only added with the lock of the pool held, but class_of_block
+ * may be called without it: slabs are recorded in an insert-only hash table
+ * that is read with atomic loads and replaced by a larger copy when it fills
+ * up. Replaced tables are kept until clear() so concurrent readers stay
+ * valid.
+ *
+ ******************************************************************************
+ */
+class SizeClassCache
+{
+public:
+  //! smallest class, 2^min_class_shift bytes
+  static constexpr size_t min_class_shift = 4;
+  //! largest class, larger requests go to the arenas directly
+  static constexpr size_t max_class_shift = 16;
+  static constexpr size_t num_classes = max_class_shift - min_class_shift + 1;
+
+  static constexpr size_t slab_shift = 18;
+  static constexpr size_t slab_size = size_t(1) << slab_shift;
+
+  //! class serving nbytes at alignment, num_classes if there is none
+  static size_t class_of(size_t nbytes, size_t alignment)
+  {
+    const size_t size = std::max(nbytes, alignment);
+    size_t cls = 0;
+    while (cls < num_classes && (size_t(1) << (cls + min_class_shift)) < size) {
+      ++cls;
+    }
+    return cls;
+  }
+
+  static size_t class_size(size_t cls)
+  {
+    return size_t(1) << (cls + min_class_shift);
+  }
+
+  //! a block of class cls, nullptr if the class needs a new slab
+  void* get(size_t cls)
+  {
+    size_class& c = m_classes[cls];
+    if (!c.free.empty()) {
+      void* ptr = c.free.back();
+      c.free.pop_back();
+      return ptr;
+    }
+    if (c.carve != c.carve_end) {
+      void* ptr = c.carve;
+      c.carve = static_cast<char*>(c.carve) + class_size(cls);
+      return ptr;
+    }
+    return nullptr;
+  }
+
+  //! add a slab of slab_size bytes, aligned to slab_size, to class cls
+  void add_slab(void* slab, size_t cls)
+  {
+    slab_table* table = m_slabs.load(std::memory_order_relaxed);
+    if (table == nullptr || 2 * (m_num_slabs + 1) > table->capacity) {
+      table = grow(table);
+    }
+    table->insert(reinterpret_cast<std::uintptr_t>(slab) | (cls + 1));
+    ++m_num_slabs;
+    size_class& c = m_classes[cls];
+    c.carve = slab;
+    c.carve_end = static_cast<char*>(slab) + slab_size;
+  }
+
+  //! class of the slab holding ptr, num_classes if ptr is not in a slab;
+  //! safe to call concurrently with add_slab
+  size_t class_of_block(void* ptr) const
+  {
+    const std::uintptr_t slab =
+        reinterpret_cast<std::uintptr_t>(ptr) & ~std::uintptr_t(slab_size - 1);
+    const slab_table* table = m_slabs.load(std::memory_order_acquire);
+    if (table == nullptr) {
+      return num_classes;
+    }
+    for (size_t k = table->first_slot(slab);; k = table->next_slot(k)) {
+      const std::uintptr_t entry =
+          table->slots[k].load(std::memory_order_acquire);
+      if (entry == 0) {
+        return num_classes;
+      }
+      if ((entry & ~std::uintptr_t(slab_size - 1)) == slab) {
+        return (entry & (slab_size - 1)) - 1;
+      }
+    }
+  }
+
+  //! return block ptr of class cls
+  void put(size_t cls, void* ptr) { m_classes[cls].free.push_back(ptr); }
+
+  //! return ptr to its class, false if ptr is not in a slab
+  bool give(void* ptr)
+  {
+    const size_t cls = class_of_block(ptr);
+    if (cls == num_classes) {
+      return false;
+    }
+    put(cls, ptr);
+    return true;
+  }
+
+  //! forget all slabs, whose memory is released with the arenas
+  void clear()
+  {
+    m_slabs.store(nullptr, std::memory_order_relaxed);
+    m_tables.clear();
+    m_num_slabs = 0;
+    for (size_class& c : m_classes) {
+      c.free.clear();
+      c.carve = c.carve_end = nullptr;
+    }
+  }
+
+private:
+  struct size_class {
+    std::vector<void*> free;
+    //! [carve, carve_end) of the newest slab is not handed out yet
+    void* carve = nullptr;
+    void* carve_end = nullptr;
+  };
+
+  //! open addressing table of slab address | (class + 1), 0 marks free slots
+  struct slab_table {
+    explicit slab_table(size_t cap)
+        : capacity(cap), slots(new std::atomic<std::uintptr_t>[cap])
+    {
+      for (size_t k = 0; k < capacity; ++k) {
+        slots[k].store(0, std::memory_order_relaxed);
+      }
+    }
+
+    size_t first_slot(std::uintptr_t slab) const
+    {
+      return (slab >> slab_shift) & (capacity - 1);
+    }
+
+    size_t next_slot(size_t k) const { return (k + 1) & (capacity - 1); }
+
+    void insert(std::uintptr_t entry)
+    {
+      size_t k = first_slot(entry & ~std::uintptr_t(slab_size - 1));
+      while (slots[k].load(std::memory_order_relaxed) != 0) {
+        k = next_slot(k);
+      }
+      slots[k].store(entry, std::memory_order_release);
+    }
+
+    const size_t capacity;
+    std::unique_ptr<std::atomic<std::uintptr_t>[]> slots;
+  };
+
+  //! publish a copy of table with twice its capacity
+  slab_table* grow(slab_table* table)
+  {
+    const size_t capacity = table == nullptr ? 64 : 2 * table->capacity;
+    std::unique_ptr<slab_table> bigger(new slab_table(capacity));
+    for (size_t k = 0; table != nullptr && k < table->capacity; ++k) {
+      const std::uintptr_t entry =
+          table->slots[k].load(std::memory_order_relaxed);
+      if (entry != 0) {
+        bigger->insert(entry);
+      }
+    }
+    m_tables.push_back(std::move(bigger));
+    m_slabs.store(m_tables.back().get(), std::memory_order_release);
+    return m_tables.back().get();
+  }
+
+  size_class m_classes[num_classes];
+  std::atomic<slab_table*> m_slabs{nullptr};
+  //! the current table and the tables it replaced
+  std::vector<std::unique_ptr<slab_table>> m_tables;
+  size_t m_num_slabs = 0;
+};
+
+
+/*! \class ThreadCache
+ ******************************************************************************
+ *
+ * \brief  ThreadCache holds the small blocks cached by one thread when
+ * thread caching is enabled in class MemPool.
+ *
+ * Each size class has a magazine of up to capacity blocks to allocate from,
+ * and freed small blocks are collected in pending until capacity of them are
+ * returned to the pool together. Large blocks are returned to the pool
+ * right away so that other threads can reuse them. The lock is only contended when more
+ * threads than caches use the pool.
+ *
+ ******************************************************************************
+ */
+struct ThreadCache {
+  static constexpr size_t capacity = 32;
+
+  spin_mutex lock;
+  size_t count[SizeClassCache::num_classes] = {};
+  void* blocks[SizeClassCache::num_classes][capacity];
+  size_t num_pending = 0;
+  void* pending[capacity];
+  //! keeps the lock and counts off the cache line of the next cache
+  char pad[64];
+};
+
+//! small number identifying the calling thread, assigned on first use
+inline unsigned mempool_thread_index()
+{
+  static std::atomic<unsigned> next_index{0};
+  static thread_local unsigned index = next_index.fetch_add(1);
+  return index;
+}
+
 } /* end namespace detail */
 
 
@@ -249,7 +479,14 @@ private:
  * malloc/free for the user to allocate aligned data within the pool
  *
  * MemPool uses MemoryArena to do the heavy lifting of maintaining access to
- * the used/free space.
+ * the used/free space. Requests of up to 64KiB are served in O(1) from the
+ * power of two size classes of a SizeClassCache, whose slabs come from the
+ * arenas; larger requests are placed in the arenas directly, which coalesce
+ * adjacent free chunks.
+ *
+ * With thread_caching(true), threads additionally keep magazines of small
+ * blocks and free small blocks in batches, so most of their malloc and free
+ * calls do not take the lock of the pool.
  *
  * MemPool provides an example generic_allocator which can guide more
  *specialized
@@ -297,7 +534,13 @@ public:
   static const size_t default_default_arena_size = 32ull * 1024ull * 1024ull;
 
   MemPool()
-      : m_arenas(), m_default_arena_size(default_default_arena_size), m_alloc()
+      : m_arenas(),
+        m_arena_index(),
+        m_small(),
+        m_caches(),
+        m_num_caches(0),
+        m_default_arena_size(default_default_arena_size),
+        m_alloc()
   {
   }
 
@@ -315,6 +558,12 @@ public:
     lock_guard<omp::mutex> lock(m_mutex);
 #endif
 
+    for (size_t c = 0; c < m_num_caches; ++c) {
+      std::fill_n(m_caches[c].count, detail::SizeClassCache::num_classes, 0);
+      m_caches[c].num_pending = 0;
+    }
+    m_small.clear();
+    m_arena_index.clear();
     while (!m_arenas.empty()) {
       void* allocation_ptr = m_arenas.front().get_allocation();
       m_alloc.free(allocation_ptr);
@@ -342,19 +591,120 @@ public:
     return prev_size;
   }
 
+  bool thread_caching() { return m_thread_caching.load(); }
+
+  /*!
+   * Enable or disable per-thread caches of small blocks, returning the
+   * previous setting. Blocks cached by threads are not available to other
+   * threads until caching is disabled again. Must not be called while
+   * other threads use the pool.
+   */
+  bool thread_caching(bool enable)
+  {
+#if defined(RAJA_ENABLE_OPENMP)
+    lock_guard<omp::mutex> lock(m_mutex);
+#endif
+
+    const bool prev = m_thread_caching.load();
+    if (enable && !m_caches) {
+#if defined(RAJA_ENABLE_OPENMP)
+      m_num_caches = static_cast<size_t>(omp_get_max_threads());
+#else
+      m_num_caches = 1;
+#endif
+      m_caches.reset(new detail::ThreadCache[m_num_caches]);
+    } else if (!enable && m_caches) {
+      for (size_t c = 0; c < m_num_caches; ++c) {
+        drain(m_caches[c]);
+      }
+      m_caches.reset();
+      m_num_caches = 0;
+    }
+    m_thread_caching.store(enable);
+    return prev;
+  }
+
   template <typename T>
   T* malloc(size_t nTs, size_t alignment = alignof(T))
   {
+    const size_t size = nTs * sizeof(T);
+    const size_t cls = detail::SizeClassCache::class_of(size, alignment);
+
+    if (m_thread_caching.load(std::memory_order_relaxed)) {
+      detail::ThreadCache& cache = this_thread_cache();
+      if (cache.lock.try_lock()) {
+        void* ptr = nullptr;
+        if (cls == detail::SizeClassCache::num_classes) {
+#if defined(RAJA_ENABLE_OPENMP)
+          lock_guard<omp::mutex> lock(m_mutex);
+#endif
+          ptr = arena_get(size, alignment);
+        } else {
+          if (cache.count[cls] == 0) {
+#if defined(RAJA_ENABLE_OPENMP)
+            lock_guard<omp::mutex> lock(m_mutex);
+#endif
+            refill(cache, cls);
+          }
+          if (cache.count[cls] > 0) {
+            ptr = cache.blocks[cls][--cache.count[cls]];
+          }
+        }
+        cache.lock.unlock();
+        return static_cast<T*>(ptr);
+      }
+    }
+
+#if defined(RAJA_ENABLE_OPENMP)
+    lock_guard<omp::mutex> lock(m_mutex);
+#endif
+
+    if (cls == detail::SizeClassCache::num_classes) {
+      return static_cast<T*>(arena_get(size, alignment));
+    }
+    return static_cast<T*>(small_get(cls));
+  }
+
+  void free(const void* cptr)
+  {
+    void* ptr = const_cast<void*>(cptr);
+
+    if (m_thread_caching.load(std::memory_order_relaxed)
+        && m_small.class_of_block(ptr) != detail::SizeClassCache::num_classes) {
+      detail::ThreadCache& cache = this_thread_cache();
+      if (cache.lock.try_lock()) {
+        cache.pending[cache.num_pending++] = ptr;
+        if (cache.num_pending == detail::ThreadCache::capacity) {
+#if defined(RAJA_ENABLE_OPENMP)
+          lock_guard<omp::mutex> lock(m_mutex);
+#endif
+          flush(cache);
+        }
+        cache.lock.unlock();
+        return;
+      }
+    }
+
 #if defined(RAJA_ENABLE_OPENMP)
     lock_guard<omp::mutex> lock(m_mutex);
 #endif
 
-    const size_t size = nTs * sizeof(T);
+    give(ptr);
+  }
+
+private:
+  using arena_container_type = std::list<detail::MemoryArena>;
+  using arena_index_type = std::map<void*, detail::MemoryArena*>;
+
+  //! first fit of nbytes at alignment in the arenas, adding an arena if
+  //! none has room
+  void* arena_get(size_t nbytes, size_t alignment)
+  {
     void* ptr = nullptr;
     arena_container_type::iterator end = m_arenas.end();
     for (arena_container_type::iterator iter = m_arenas.begin(); iter != end;
          ++iter) {
-      ptr = iter->get(size, alignment);
+      ptr = iter->get(nbytes, alignment);
       if (ptr != nullptr) {
         break;
       }
@@ -362,45 +712,101 @@ public:
 
     if (ptr == nullptr) {
       const size_t alloc_size =
-          std::max(size + alignment, m_default_arena_size);
+          std::max(nbytes + alignment, m_default_arena_size);
       void* arena_ptr = m_alloc.malloc(alloc_size);
       if (arena_ptr != nullptr) {
         m_arenas.emplace_front(arena_ptr, alloc_size);
-        ptr = m_arenas.front().get(size, alignment);
+        m_arena_index[arena_ptr] = &m_arenas.front();
+        ptr = m_arenas.front().get(nbytes, alignment);
       }
     }
 
-    return static_cast<T*>(ptr);
+    return ptr;
   }
 
-  void free(const void* cptr)
+  //! a block of class cls, taking a new slab if the class has none left
+  void* small_get(size_t cls)
   {
-#if defined(RAJA_ENABLE_OPENMP)
-    lock_guard<omp::mutex> lock(m_mutex);
-#endif
+    void* ptr = m_small.get(cls);
+    if (ptr == nullptr) {
+      void* slab = arena_get(detail::SizeClassCache::slab_size,
+                             detail::SizeClassCache::slab_size);
+      if (slab != nullptr) {
+        m_small.add_slab(slab, cls);
+        ptr = m_small.get(cls);
+      }
+    }
+    return ptr;
+  }
 
-    void* ptr = const_cast<void*>(cptr);
-    arena_container_type::iterator end = m_arenas.end();
-    for (arena_container_type::iterator iter = m_arenas.begin(); iter != end;
-         ++iter) {
-      if (iter->give(ptr)) {
-        ptr = nullptr;
+  void give(void* ptr)
+  {
+    if (m_small.give(ptr)) {
+      return;
+    }
+
+    // the arena starting at or before ptr is the only one that can hold it
+    arena_index_type::iterator arena = m_arena_index.upper_bound(ptr);
+    if (arena == m_arena_index.begin() || !(--arena)->second->give(ptr)) {
+      fprintf(stderr, "Unknown pointer %p", ptr);
+    }
+  }
+
+  detail::ThreadCache& this_thread_cache()
+  {
+    return m_caches[detail::mempool_thread_index() % m_num_caches];
+  }
+
+  // the functions below are called with the lock of the pool held
+
+  //! fill half of the magazine of class cls
+  void refill(detail::ThreadCache& cache, size_t cls)
+  {
+    while (cache.count[cls] < detail::ThreadCache::capacity / 2) {
+      void* ptr = small_get(cls);
+      if (ptr == nullptr) {
         break;
       }
+      cache.blocks[cls][cache.count[cls]++] = ptr;
     }
-    if (ptr != nullptr) {
-      fprintf(stderr, "Unknown pointer %p", ptr);
+  }
+
+  //! move the pending frees of cache to its magazines or back to the pool
+  void flush(detail::ThreadCache& cache)
+  {
+    for (size_t k = 0; k < cache.num_pending; ++k) {
+      void* ptr = cache.pending[k];
+      const size_t cls = m_small.class_of_block(ptr);
+      if (cache.count[cls] < detail::ThreadCache::capacity) {
+        cache.blocks[cls][cache.count[cls]++] = ptr;
+      } else {
+        m_small.put(cls, ptr);
+      }
     }
+    cache.num_pending = 0;
   }
 
-private:
-  using arena_container_type = std::list<detail::MemoryArena>;
+  //! return all blocks of cache to the pool
+  void drain(detail::ThreadCache& cache)
+  {
+    flush(cache);
+    for (size_t cls = 0; cls < detail::SizeClassCache::num_classes; ++cls) {
+      while (cache.count[cls] > 0) {
+        m_small.put(cls, cache.blocks[cls][--cache.count[cls]]);
+      }
+    }
+  }
 
 #if defined(RAJA_ENABLE_OPENMP)
   omp::mutex m_mutex;
 #endif
 
   arena_container_type m_arenas;
+  arena_index_type m_arena_index;
+  detail::SizeClassCache m_small;
+  std::unique_ptr<detail::ThreadCache[]> m_caches;
+  size_t m_num_caches;
+  std::atomic<bool> m_thread_caching{false};
   size_t m_default_arena_size;
   allocator_t m_alloc;
 };
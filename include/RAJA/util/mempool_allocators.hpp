@@ -0,0 +1,385 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing host allocators for basic_mempool
+ *          that back arenas with huge pages and place them on NUMA nodes.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_MEMPOOL_ALLOCATORS_HPP
+#define RAJA_MEMPOOL_ALLOCATORS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <unordered_map>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/mutex.hpp"
+
+namespace RAJA
+{
+
+namespace basic_mempool
+{
+
+namespace detail
+{
+
+#if defined(__linux__)
+
+//! size of a transparent huge page, to which mappings are aligned
+constexpr size_t huge_page_size = size_t(1) << 21;
+
+//! nbytes rounded up to whole huge pages
+constexpr size_t huge_page_round(size_t nbytes)
+{
+  return (nbytes + huge_page_size - 1) & ~(huge_page_size - 1);
+}
+
+#if defined(MAP_HUGETLB)
+//! mmap flags for hugetlbfs pages of huge_page_size rather than of the
+//! system default huge page size
+#if defined(MAP_HUGE_2MB)
+constexpr int map_hugetlb_flags = MAP_HUGETLB | MAP_HUGE_2MB;
+#elif defined(MAP_HUGE_SHIFT)
+constexpr int map_hugetlb_flags = MAP_HUGETLB | (21 << MAP_HUGE_SHIFT);
+#else
+constexpr int map_hugetlb_flags = MAP_HUGETLB;
+#endif
+#endif
+
+//! memory policies of mbind and get_mempolicy, as in <numaif.h>
+constexpr int mpol_bind = 2;
+constexpr int mpol_interleave = 3;
+constexpr unsigned long mpol_f_mems_allowed = 1ul << 2;
+
+//! NUMA node mask with room for max_numa_nodes nodes
+constexpr size_t max_numa_nodes = 1024;
+struct numa_node_mask {
+  static constexpr size_t bits_per_word = 8 * sizeof(unsigned long);
+  unsigned long words[max_numa_nodes / bits_per_word] = {};
+
+  void set(unsigned node)
+  {
+    words[node / bits_per_word] |= 1ul << (node % bits_per_word);
+  }
+
+  bool empty() const
+  {
+    for (unsigned long word : words) {
+      if (word != 0ul) return false;
+    }
+    return true;
+  }
+};
+
+/*!
+ * Lengths of the mappings made by the allocators below, which munmap needs
+ * but the allocator interface of MemPool does not pass to free.
+ */
+class mapping_registry
+{
+public:
+  static mapping_registry& get()
+  {
+    static mapping_registry registry;
+    return registry;
+  }
+
+  void insert(void* ptr, size_t nbytes)
+  {
+    lock_guard<spin_mutex> lock(m_mutex);
+    m_lengths[ptr] = nbytes;
+  }
+
+  //! removes ptr and returns its length, or 0 if ptr is not a mapping
+  size_t remove(void* ptr)
+  {
+    lock_guard<spin_mutex> lock(m_mutex);
+    auto it = m_lengths.find(ptr);
+    if (it == m_lengths.end()) {
+      return 0;
+    }
+    const size_t nbytes = it->second;
+    m_lengths.erase(it);
+    return nbytes;
+  }
+
+private:
+  spin_mutex m_mutex;
+  std::unordered_map<void*, size_t> m_lengths;
+};
+
+/*!
+ * Maps nbytes, rounded up to whole huge pages, of anonymous memory aligned to
+ * huge_page_size. Pages reserved for hugetlbfs are used if there are enough
+ * of them, otherwise the mapping is advised to use transparent huge pages.
+ * Returns nullptr on failure.
+ */
+inline void* map_huge(size_t nbytes)
+{
+  const size_t len = huge_page_round(nbytes);
+  if (len == 0) {
+    return nullptr;
+  }
+
+#if defined(MAP_HUGETLB)
+  void* ptr = mmap(nullptr,
+                   len,
+                   PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS | map_hugetlb_flags,
+                   -1,
+                   0);
+  if (ptr != MAP_FAILED) {
+    mapping_registry::get().insert(ptr, len);
+    return ptr;
+  }
+#endif
+
+  // over-map by one huge page and trim both ends to align the mapping
+  const size_t padded = len + huge_page_size;
+  void* raw = mmap(nullptr,
+                   padded,
+                   PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS,
+                   -1,
+                   0);
+  if (raw == MAP_FAILED) {
+    return nullptr;
+  }
+  char* begin = static_cast<char*>(raw);
+  char* aligned = reinterpret_cast<char*>(
+      (reinterpret_cast<std::uintptr_t>(begin) + huge_page_size - 1) &
+      ~std::uintptr_t(huge_page_size - 1));
+  if (aligned != begin) {
+    munmap(begin, aligned - begin);
+  }
+  const size_t tail = (begin + padded) - (aligned + len);
+  if (tail != 0) {
+    munmap(aligned + len, tail);
+  }
+
+#if defined(MADV_HUGEPAGE)
+  madvise(aligned, len, MADV_HUGEPAGE);
+#endif
+
+  mapping_registry::get().insert(aligned, len);
+  return aligned;
+}
+
+//! unmaps a mapping made by map_huge, returns false for other pointers
+inline bool unmap_huge(void* ptr)
+{
+  const size_t len = mapping_registry::get().remove(ptr);
+  return len != 0 && munmap(ptr, len) == 0;
+}
+
+//! NUMA node of the cpu the calling thread runs on, 0 if unknown
+inline unsigned current_numa_node()
+{
+#if defined(SYS_getcpu)
+  unsigned cpu = 0;
+  unsigned node = 0;
+  if (syscall(SYS_getcpu, &cpu, &node, nullptr) == 0) {
+    return node;
+  }
+#endif
+  return 0;
+}
+
+//! nodes the calling thread may allocate memory on, empty if unknown
+inline numa_node_mask allowed_numa_nodes()
+{
+  numa_node_mask mask;
+#if defined(SYS_get_mempolicy)
+  int mode = 0;
+  if (syscall(SYS_get_mempolicy,
+              &mode,
+              mask.words,
+              max_numa_nodes,
+              nullptr,
+              mpol_f_mems_allowed) != 0) {
+    return numa_node_mask{};
+  }
+#endif
+  return mask;
+}
+
+/*!
+ * Sets the memory policy of the len bytes at ptr. Pages are placed when they
+ * are first touched, so this must happen before the memory is used. Placement
+ * is best effort: without NUMA support in the kernel the policy is left as it
+ * is and the memory is still usable.
+ */
+inline void bind_numa(void* ptr,
+                      size_t len,
+                      int mode,
+                      numa_node_mask const& mask)
+{
+#if defined(SYS_mbind)
+  if (!mask.empty()) {
+    syscall(SYS_mbind, ptr, len, mode, mask.words, max_numa_nodes + 1, 0u);
+  }
+#else
+  RAJA_UNUSED_VAR(ptr, len, mode, mask);
+#endif
+}
+
+#endif
+
+}  // namespace detail
+
+/*!
+ * \brief Host allocator for basic_mempool that backs arenas with huge pages.
+ *
+ * Arenas are rounded up to whole 2MiB pages and aligned to them. They use
+ * pages reserved for hugetlbfs when the system has enough of them, otherwise
+ * they are advised with madvise(MADV_HUGEPAGE) to use transparent huge
+ * pages, which the kernel provides as far as its configuration allows. Large
+ * arenas then need far fewer TLB entries than with 4KiB pages, which helps
+ * irregular accesses such as gathers over big meshes.
+ *
+ * On systems other than Linux this falls back to std::malloc.
+ *
+ * \code
+ *
+ * using mesh_pool = RAJA::basic_mempool::MemPool<
+ *     RAJA::basic_mempool::hugepage_allocator>;
+ *
+ * \endcode
+ */
+struct hugepage_allocator {
+
+  // returns a valid pointer on success, nullptr on failure
+  void* malloc(size_t nbytes)
+  {
+#if defined(__linux__)
+    return detail::map_huge(nbytes);
+#else
+    return std::malloc(nbytes);
+#endif
+  }
+
+  // returns true on success, false on failure
+  bool free(void* ptr)
+  {
+#if defined(__linux__)
+    return detail::unmap_huge(ptr);
+#else
+    std::free(ptr);
+    return true;
+#endif
+  }
+};
+
+/*!
+ * \brief Host allocator for basic_mempool that places arenas on one NUMA
+ * node, using huge pages like hugepage_allocator.
+ *
+ * With the default node of -1 each arena is bound to the node of the thread
+ * that allocates it, so that a pool used by the threads of one socket keeps
+ * its memory local even if the arena is first touched elsewhere. A node
+ * number >= 0 binds all arenas to that node.
+ */
+template <int node = -1>
+struct numa_local_allocator {
+#if defined(__linux__)
+  static_assert(node < int(detail::max_numa_nodes),
+                "numa_local_allocator node must be less than max_numa_nodes");
+#endif
+
+  // returns a valid pointer on success, nullptr on failure
+  void* malloc(size_t nbytes)
+  {
+#if defined(__linux__)
+    void* ptr = detail::map_huge(nbytes);
+    if (ptr != nullptr) {
+      detail::numa_node_mask mask;
+      mask.set(node < 0 ? detail::current_numa_node()
+                        : static_cast<unsigned>(node));
+      detail::bind_numa(ptr,
+                        detail::huge_page_round(nbytes),
+                        detail::mpol_bind,
+                        mask);
+    }
+    return ptr;
+#else
+    return std::malloc(nbytes);
+#endif
+  }
+
+  // returns true on success, false on failure
+  bool free(void* ptr)
+  {
+#if defined(__linux__)
+    return detail::unmap_huge(ptr);
+#else
+    std::free(ptr);
+    return true;
+#endif
+  }
+};
+
+/*!
+ * \brief Host allocator for basic_mempool that interleaves the pages of
+ * arenas over all NUMA nodes the process may use, using huge pages like
+ * hugepage_allocator.
+ *
+ * This spreads data shared by the threads of all sockets, such as a mesh
+ * read by every thread, evenly over the memory bandwidth of the nodes
+ * instead of placing it on the node of the thread that touches it first.
+ * Pages are interleaved at the granularity of the huge pages backing them.
+ */
+struct interleaved_allocator {
+
+  // returns a valid pointer on success, nullptr on failure
+  void* malloc(size_t nbytes)
+  {
+#if defined(__linux__)
+    void* ptr = detail::map_huge(nbytes);
+    if (ptr != nullptr) {
+      detail::bind_numa(ptr,
+                        detail::huge_page_round(nbytes),
+                        detail::mpol_interleave,
+                        detail::allowed_numa_nodes());
+    }
+    return ptr;
+#else
+    return std::malloc(nbytes);
+#endif
+  }
+
+  // returns true on success, false on failure
+  bool free(void* ptr)
+  {
+#if defined(__linux__)
+    return detail::unmap_huge(ptr);
+#else
+    std::free(ptr);
+    return true;
+#endif
+  }
+};
+
+} /* end namespace basic_mempool */
+
+} /* end namespace RAJA */
+
+#endif /* RAJA_MEMPOOL_ALLOCATORS_HPP */
@@ -20,13 +20,43 @@
 
 #include "RAJA/config.hpp"
 
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || \
+    defined(_M_IX86)
+#include <immintrin.h>
+#endif
+
 #if defined(RAJA_ENABLE_OPENMP)
 #include <omp.h>
 #endif
 
+#include "RAJA/util/macros.hpp"
+
 namespace RAJA
 {
 
+namespace detail
+{
+
+//! hint to the processor that the calling thread is spinning
+RAJA_INLINE void cpu_relax()
+{
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || \
+    defined(_M_IX86)
+  _mm_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+  __asm__ __volatile__("yield");
+#endif
+}
+
+}  // namespace detail
+
 #if defined(RAJA_ENABLE_OPENMP)
 namespace omp
 {
@@ -61,6 +91,203 @@ private:
 }  // namespace omp
 #endif  // closing endif for if defined(RAJA_ENABLE_OPENMP)
 
+/*!
+ * Test-and-test-and-set spin lock with std::mutex interface. Waiting threads
+ * spin on a plain load, so the cache line is only written when the lock
+ * looks free. Meant for short critical sections inside loop bodies; it can
+ * be constructed as a constant and needs no cleanup.
+ */
+class spin_mutex
+{
+public:
+  constexpr spin_mutex() noexcept : m_locked(false) {}
+
+  spin_mutex(const spin_mutex&) = delete;
+  spin_mutex(spin_mutex&&) = delete;
+  spin_mutex& operator=(const spin_mutex&) = delete;
+  spin_mutex& operator=(spin_mutex&&) = delete;
+
+  void lock()
+  {
+    while (m_locked.exchange(true, std::memory_order_acquire)) {
+      while (m_locked.load(std::memory_order_relaxed)) {
+        detail::cpu_relax();
+      }
+    }
+  }
+
+  bool try_lock()
+  {
+    return !m_locked.load(std::memory_order_relaxed) &&
+           !m_locked.exchange(true, std::memory_order_acquire);
+  }
+
+  void unlock() { m_locked.store(false, std::memory_order_release); }
+
+private:
+  std::atomic<bool> m_locked;
+};
+
+/*!
+ * Ticket lock with std::mutex interface. Threads are granted the lock in the
+ * order they asked for it, so no thread starves when the lock is heavily
+ * contended, at the price of a handoff to a thread that may not be running.
+ */
+class ticket_mutex
+{
+public:
+  constexpr ticket_mutex() noexcept : m_next(0), m_serving(0) {}
+
+  ticket_mutex(const ticket_mutex&) = delete;
+  ticket_mutex(ticket_mutex&&) = delete;
+  ticket_mutex& operator=(const ticket_mutex&) = delete;
+  ticket_mutex& operator=(ticket_mutex&&) = delete;
+
+  void lock()
+  {
+    const unsigned ticket = m_next.fetch_add(1, std::memory_order_relaxed);
+    while (m_serving.load(std::memory_order_acquire) != ticket) {
+      detail::cpu_relax();
+    }
+  }
+
+  bool try_lock()
+  {
+    unsigned ticket = m_serving.load(std::memory_order_relaxed);
+    return m_next.compare_exchange_strong(ticket,
+                                          ticket + 1,
+                                          std::memory_order_acquire,
+                                          std::memory_order_relaxed);
+  }
+
+  void unlock()
+  {
+    m_serving.store(m_serving.load(std::memory_order_relaxed) + 1,
+                    std::memory_order_release);
+  }
+
+private:
+  std::atomic<unsigned> m_next;
+  std::atomic<unsigned> m_serving;
+};
+
+/*!
+ * Table of locks, each on its own cache line, protecting a set of elements
+ * that is too large for one lock per element. An element index is hashed to
+ * one of the locks, so updates to different elements only wait for each
+ * other when their indices share a lock.
+ *
+ * Copies share the same locks, so a lock_array can be captured by value in
+ * a loop body. Elements whose indices share a lock must not be locked one
+ * after the other by the same thread; use the two index overloads to hold
+ * the locks of two elements at once.
+ */
+template <typename mutex_type = spin_mutex>
+class lock_array
+{
+  //! assumed size of a cache line
+  static constexpr std::size_t line_size = 64;
+
+  struct padded {
+    mutex_type mutex;
+    char pad[line_size - sizeof(mutex_type) % line_size];
+  };
+
+public:
+  //! a table of at least num_locks locks, rounded up to a power of two
+  explicit lock_array(std::size_t num_locks = 1024) : m_shift(64)
+  {
+    std::size_t n = 1;
+    while (n < num_locks) {
+      n *= 2;
+      --m_shift;
+    }
+    m_locks = std::make_shared<std::vector<padded>>(n);
+    m_data = m_locks->data();
+    m_size = n;
+  }
+
+  //! number of locks in the table
+  std::size_t size() const { return m_size; }
+
+  //! the lock with the given position in the table
+  mutex_type& operator[](std::size_t i) const { return m_data[i].mutex; }
+
+  //! position in the table of the lock protecting element index
+  template <typename IndexType>
+  std::size_t lock_id(IndexType index) const
+  {
+    // Fibonacci hashing spreads both neighbouring and strided indices
+    return m_size == 1
+               ? 0
+               : static_cast<std::size_t>(
+                     (static_cast<std::uint64_t>(index) *
+                      0x9E3779B97F4A7C15ull) >>
+                     m_shift);
+  }
+
+  //! the lock protecting element index
+  template <typename IndexType>
+  mutex_type& for_index(IndexType index) const
+  {
+    return m_data[lock_id(index)].mutex;
+  }
+
+  template <typename IndexType>
+  void lock(IndexType index) const
+  {
+    for_index(index).lock();
+  }
+
+  template <typename IndexType>
+  bool try_lock(IndexType index) const
+  {
+    return for_index(index).try_lock();
+  }
+
+  template <typename IndexType>
+  void unlock(IndexType index) const
+  {
+    for_index(index).unlock();
+  }
+
+  /*!
+   * Lock the elements a and b together. The locks are taken in table
+   * order, so threads locking overlapping pairs can't deadlock, and only
+   * once if a and b share a lock.
+   */
+  template <typename IndexType>
+  void lock(IndexType a, IndexType b) const
+  {
+    std::size_t la = lock_id(a);
+    std::size_t lb = lock_id(b);
+    if (lb < la) {
+      std::swap(la, lb);
+    }
+    m_data[la].mutex.lock();
+    if (lb != la) {
+      m_data[lb].mutex.lock();
+    }
+  }
+
+  template <typename IndexType>
+  void unlock(IndexType a, IndexType b) const
+  {
+    const std::size_t la = lock_id(a);
+    const std::size_t lb = lock_id(b);
+    m_data[la].mutex.unlock();
+    if (lb != la) {
+      m_data[lb].mutex.unlock();
+    }
+  }
+
+private:
+  std::shared_ptr<std::vector<padded>> m_locks;
+  padded* m_data;
+  std::size_t m_size;
+  unsigned m_shift;
+};
+
 //! class providing functionality of std::lock_guard
 template <typename mutex_type>
 class lock_guard
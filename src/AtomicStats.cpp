@@ -0,0 +1,130 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Implementation file for the contention statistics of the
+ *          backoff atomic policy.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <ostream>
+
+#include "RAJA/policy/atomic_backoff.hpp"
+
+namespace RAJA
+{
+namespace atomic_stats
+{
+
+namespace
+{
+
+/*
+ * Fixed-size open-addressing table of the contended addresses. Slots are
+ * claimed with a compare-and-swap on the address and never released, so
+ * recording never blocks; operations on addresses that find the table full
+ * are only counted in the overflow slot.
+ */
+constexpr std::size_t table_size = 1 << 12;
+
+struct slot {
+  std::atomic<std::uintptr_t> address{0};
+  std::atomic<unsigned long long> contended{0};
+  std::atomic<unsigned long long> retries{0};
+};
+
+slot table[table_size];
+slot overflow;
+
+std::size_t hash(std::uintptr_t address)
+{
+  return static_cast<std::size_t>(
+      (static_cast<std::uint64_t>(address) * 0x9E3779B97F4A7C15ull) >> 52);
+}
+
+}  // namespace
+
+void record(void const* address, unsigned retries)
+{
+  const std::uintptr_t key = reinterpret_cast<std::uintptr_t>(address);
+  slot* found = &overflow;
+  for (std::size_t probe = 0, k = hash(key); probe < table_size;
+       ++probe, k = (k + 1) % table_size) {
+    std::uintptr_t current = table[k].address.load(std::memory_order_relaxed);
+    if (current == 0 &&
+        table[k].address.compare_exchange_strong(current, key)) {
+      current = key;
+    }
+    if (current == key) {
+      found = &table[k];
+      break;
+    }
+  }
+  found->contended.fetch_add(1, std::memory_order_relaxed);
+  found->retries.fetch_add(retries, std::memory_order_relaxed);
+}
+
+std::vector<entry> hottest(std::size_t n)
+{
+  std::vector<entry> entries;
+  for (slot const& s : table) {
+    const std::uintptr_t key = s.address.load();
+    if (key != 0) {
+      entries.push_back(entry{reinterpret_cast<void const*>(key),
+                              s.contended.load(),
+                              s.retries.load()});
+    }
+  }
+  std::sort(entries.begin(), entries.end(), [](entry const& a, entry const& b) {
+    return a.retries > b.retries;
+  });
+  if (entries.size() > n) {
+    entries.resize(n);
+  }
+  return entries;
+}
+
+void report(std::ostream& os, std::size_t n)
+{
+  os << "RAJA backoff_atomic contention";
+#if !defined(RAJA_ENABLE_ATOMIC_STATS)
+  os << " (not collected, configure RAJA with RAJA_ENABLE_ATOMIC_STATS)";
+#endif
+  os << "\n";
+  for (entry const& e : hottest(n)) {
+    os << "  " << e.address << ": " << e.contended
+       << " contended operations, " << e.retries << " retries\n";
+  }
+  if (overflow.contended.load() > 0) {
+    os << "  other addresses: " << overflow.contended.load()
+       << " contended operations, " << overflow.retries.load()
+       << " retries\n";
+  }
+}
+
+void reset()
+{
+  for (slot& s : table) {
+    s.contended.store(0);
+    s.retries.store(0);
+    s.address.store(0);
+  }
+  overflow.contended.store(0);
+  overflow.retries.store(0);
+}
+
+}  // namespace atomic_stats
+
+}  // namespace RAJA
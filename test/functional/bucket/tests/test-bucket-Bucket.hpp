@@ -0,0 +1,87 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_BUCKET_BUCKET_HPP__
+#define __TEST_BUCKET_BUCKET_HPP__
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+template <typename EXEC_POLICY, typename WORKING_RES, typename T>
+void BucketBucketTestImpl(int N, int nbuckets)
+{
+  camp::resources::Resource working_res{WORKING_RES()};
+
+  T* work_keys;
+  T* host_keys;
+  int* work_offsets;
+  int* host_offsets;
+  int* work_perm;
+  int* host_perm;
+
+  allocBucketTestData(N, working_res, &work_keys, &host_keys);
+  allocBucketTestData(nbuckets + 1, working_res, &work_offsets, &host_offsets);
+  allocBucketTestData(N, working_res, &work_perm, &host_perm);
+
+  initBucketTestKeys(host_keys, N, nbuckets);
+
+  working_res.memcpy(work_keys, host_keys, sizeof(T) * N);
+
+  RAJA::bucket<EXEC_POLICY>(
+      work_keys, work_keys + N, nbuckets, work_offsets, work_perm);
+
+  working_res.memcpy(host_offsets, work_offsets, sizeof(int) * (nbuckets + 1));
+  working_res.memcpy(host_perm, work_perm, sizeof(int) * N);
+
+  std::vector<int> expected(N);
+  std::iota(expected.begin(), expected.end(), 0);
+  std::stable_sort(expected.begin(), expected.end(), [&](int a, int b) {
+    return host_keys[a] < host_keys[b];
+  });
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(host_perm[i], expected[i]) << "(at index " << i << ")";
+  }
+  for (int k = 0; k <= nbuckets; ++k) {
+    const int first = static_cast<int>(
+        std::lower_bound(expected.begin(), expected.end(), k,
+                         [&](int a, int key) {
+                           return host_keys[a] < static_cast<T>(key);
+                         }) -
+        expected.begin());
+    ASSERT_EQ(host_offsets[k], first) << "(at bucket " << k << ")";
+  }
+
+  deallocBucketTestData(working_res, work_keys, host_keys);
+  deallocBucketTestData(working_res, work_offsets, host_offsets);
+  deallocBucketTestData(working_res, work_perm, host_perm);
+}
+
+TYPED_TEST_SUITE_P(BucketBucketTest);
+template <typename T>
+class BucketBucketTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(BucketBucketTest, BucketBucket)
+{
+  using EXEC_POLICY      = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RESOURCE = typename camp::at<TypeParam, camp::num<1>>::type;
+  using KEY_TYPE         = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  for (int N : BucketTestSizes) {
+    for (int nbuckets : BucketTestCounts) {
+      BucketBucketTestImpl<EXEC_POLICY, WORKING_RESOURCE, KEY_TYPE>(
+          N, nbuckets);
+    }
+  }
+}
+
+REGISTER_TYPED_TEST_SUITE_P(BucketBucketTest,
+                            BucketBucket);
+
+#endif // __TEST_BUCKET_BUCKET_HPP__
@@ -0,0 +1,93 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_BUCKET_INDEX_SET_HPP__
+#define __TEST_BUCKET_INDEX_SET_HPP__
+
+#include <algorithm>
+
+#include "RAJA/index/IndexSetBuilders.hpp"
+
+//
+// Bucket the indices of a key array, build an index set with one list
+// segment per bucket, and check that iterating over segment k visits
+// exactly the indices whose key is k.
+//
+template <typename EXEC_POLICY, typename WORKING_RES, typename T>
+void BucketIndexSetTestImpl(int N, int nbuckets)
+{
+  camp::resources::Resource working_res{WORKING_RES()};
+  camp::resources::Resource host_res{camp::resources::Host()};
+
+  T* work_keys;
+  T* host_keys;
+  RAJA::Index_type* offsets = host_res.allocate<RAJA::Index_type>(nbuckets + 1);
+  RAJA::Index_type* perm = host_res.allocate<RAJA::Index_type>(N);
+  int* work_bucket;
+  int* host_bucket;
+
+  allocBucketTestData(N, working_res, &work_keys, &host_keys);
+  allocBucketTestData(N, working_res, &work_bucket, &host_bucket);
+
+  initBucketTestKeys(host_keys, N, nbuckets);
+  std::fill(host_bucket, host_bucket + N, -1);
+
+  working_res.memcpy(work_keys, host_keys, sizeof(T) * N);
+  working_res.memcpy(work_bucket, host_bucket, sizeof(int) * N);
+
+  RAJA::bucket<EXEC_POLICY>(host_keys, host_keys + N, nbuckets, offsets, perm);
+
+  RAJA::TypedIndexSet<RAJA::ListSegment> iset;
+  RAJA::buildBucketIndexSet(iset, perm, offsets, nbuckets, working_res);
+
+  ASSERT_EQ(iset.getNumSegments(), static_cast<size_t>(nbuckets));
+  ASSERT_EQ(iset.getLength(), static_cast<size_t>(N));
+
+  for (int k = 0; k < nbuckets; ++k) {
+    RAJA::forall<EXEC_POLICY>(iset.getSegment<RAJA::ListSegment>(k),
+                              [=](RAJA::Index_type i) {
+                                work_bucket[i] = k;
+                              });
+  }
+
+  working_res.memcpy(host_bucket, work_bucket, sizeof(int) * N);
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(host_bucket[i], static_cast<int>(host_keys[i]))
+        << "(at index " << i << ")";
+  }
+
+  deallocBucketTestData(working_res, work_keys, host_keys);
+  deallocBucketTestData(working_res, work_bucket, host_bucket);
+  host_res.deallocate(offsets);
+  host_res.deallocate(perm);
+}
+
+TYPED_TEST_SUITE_P(BucketIndexSetTest);
+template <typename T>
+class BucketIndexSetTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(BucketIndexSetTest, BucketIndexSet)
+{
+  using EXEC_POLICY      = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RESOURCE = typename camp::at<TypeParam, camp::num<1>>::type;
+  using KEY_TYPE         = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  for (int N : BucketTestSizes) {
+    for (int nbuckets : BucketTestCounts) {
+      BucketIndexSetTestImpl<EXEC_POLICY, WORKING_RESOURCE, KEY_TYPE>(
+          N, nbuckets);
+    }
+  }
+}
+
+REGISTER_TYPED_TEST_SUITE_P(BucketIndexSetTest,
+                            BucketIndexSet);
+
+#endif // __TEST_BUCKET_INDEX_SET_HPP__
@@ -0,0 +1,65 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_BUCKET_DATA_HPP__
+#define __TEST_BUCKET_DATA_HPP__
+
+#include <random>
+
+//
+// Sizes used by the bucket tests; the largest is split into several blocks
+// by the parallel back-ends.
+//
+const int BucketTestSizes[] = {0, 1, 2, 17, 1000, 70001};
+
+//
+// Numbers of buckets used by the bucket tests; with the most buckets some
+// of them stay empty for the smaller sizes.
+//
+const int BucketTestCounts[] = {1, 7, 1000};
+
+//
+// Methods to allocate/deallocate/initialize bucket test data.
+//
+
+template <typename T>
+void allocBucketTestData(int N,
+                         camp::resources::Resource& work_res,
+                         T** work_data,
+                         T** host_data)
+{
+  camp::resources::Resource host_res{camp::resources::Host()};
+
+  *work_data = work_res.allocate<T>(N);
+  *host_data = host_res.allocate<T>(N);
+}
+
+template <typename T>
+void deallocBucketTestData(camp::resources::Resource& work_res,
+                           T* work_data,
+                           T* host_data)
+{
+  camp::resources::Resource host_res{camp::resources::Host()};
+
+  work_res.deallocate(work_data);
+  host_res.deallocate(host_data);
+}
+
+//
+// Fill keys with values in [0, nbuckets).
+//
+template <typename T>
+void initBucketTestKeys(T* keys, int N, int nbuckets)
+{
+  std::mt19937 gen(N);
+  std::uniform_int_distribution<int> dist(0, nbuckets - 1);
+  for (int i = 0; i < N; ++i) {
+    keys[i] = static_cast<T>(dist(gen));
+  }
+}
+
+#endif // __TEST_BUCKET_DATA_HPP__
@@ -0,0 +1,121 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_COMPACT_COPY_IF_HPP__
+#define __TEST_COMPACT_COPY_IF_HPP__
+
+#include <algorithm>
+#include <vector>
+
+template <typename EXEC_POLICY, typename WORKING_RES, typename T>
+void CompactCopyIfTestImpl(int N)
+{
+  camp::resources::Resource working_res{WORKING_RES()};
+
+  T* work_in;
+  T* host_in;
+  T* work_out;
+  T* host_out;
+
+  allocCompactTestData(N, working_res, &work_in, &host_in);
+  allocCompactTestData(N, working_res, &work_out, &host_out);
+
+  initCompactTestData(host_in, N);
+  std::vector<T> expected;
+  std::copy_if(host_in,
+               host_in + N,
+               std::back_inserter(expected),
+               CompactTestPred<T>{});
+
+  working_res.memcpy(work_in, host_in, sizeof(T) * N);
+
+  const auto count = RAJA::copy_if<EXEC_POLICY>(
+      work_in, work_in + N, work_out, CompactTestPred<T>{});
+
+  working_res.memcpy(host_out, work_out, sizeof(T) * N);
+
+  ASSERT_EQ(count, static_cast<decltype(count)>(expected.size()));
+  for (size_t i = 0; i < expected.size(); ++i) {
+    ASSERT_EQ(host_out[i], expected[i]) << "(at index " << i << ")";
+  }
+
+  deallocCompactTestData(working_res, work_in, host_in);
+  deallocCompactTestData(working_res, work_out, host_out);
+}
+
+//
+// Build the list of selected indices of a range segment and iterate over
+// it as a ListSegment.
+//
+template <typename EXEC_POLICY, typename WORKING_RES, typename T>
+void CompactCopyIfIndexTestImpl(int N)
+{
+  camp::resources::Resource working_res{WORKING_RES()};
+
+  T* work_in;
+  T* host_in;
+  RAJA::Index_type* work_list;
+  RAJA::Index_type* host_list;
+  int* work_mark;
+  int* host_mark;
+
+  allocCompactTestData(N, working_res, &work_in, &host_in);
+  allocCompactTestData(N, working_res, &work_list, &host_list);
+  allocCompactTestData(N, working_res, &work_mark, &host_mark);
+
+  initCompactTestData(host_in, N);
+  std::fill(host_mark, host_mark + N, 0);
+
+  working_res.memcpy(work_in, host_in, sizeof(T) * N);
+  working_res.memcpy(work_mark, host_mark, sizeof(int) * N);
+
+  RAJA::TypedRangeSegment<RAJA::Index_type> range(0, N);
+  const auto count = RAJA::copy_if<EXEC_POLICY>(
+      range, work_list, [=](RAJA::Index_type i) {
+        return CompactTestPred<T>{}(work_in[i]);
+      });
+
+  RAJA::TypedListSegment<RAJA::Index_type> list(
+      work_list, count, working_res, RAJA::Unowned);
+  RAJA::forall<EXEC_POLICY>(list, [=](RAJA::Index_type i) {
+    work_mark[i] += 1;
+  });
+
+  working_res.memcpy(host_mark, work_mark, sizeof(int) * N);
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(host_mark[i], CompactTestPred<T>{}(host_in[i]) ? 1 : 0)
+        << "(at index " << i << ")";
+  }
+
+  deallocCompactTestData(working_res, work_in, host_in);
+  deallocCompactTestData(working_res, work_list, host_list);
+  deallocCompactTestData(working_res, work_mark, host_mark);
+}
+
+TYPED_TEST_SUITE_P(CompactCopyIfTest);
+template <typename T>
+class CompactCopyIfTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(CompactCopyIfTest, CompactCopyIf)
+{
+  using EXEC_POLICY      = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RESOURCE = typename camp::at<TypeParam, camp::num<1>>::type;
+  using DATA_TYPE        = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  for (int N : CompactTestSizes) {
+    CompactCopyIfTestImpl<EXEC_POLICY, WORKING_RESOURCE, DATA_TYPE>(N);
+    CompactCopyIfIndexTestImpl<EXEC_POLICY, WORKING_RESOURCE, DATA_TYPE>(N);
+  }
+}
+
+REGISTER_TYPED_TEST_SUITE_P(CompactCopyIfTest,
+                            CompactCopyIf);
+
+#endif // __TEST_COMPACT_COPY_IF_HPP__
@@ -0,0 +1,66 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_COMPACT_REMOVE_IF_HPP__
+#define __TEST_COMPACT_REMOVE_IF_HPP__
+
+#include <algorithm>
+#include <vector>
+
+template <typename EXEC_POLICY, typename WORKING_RES, typename T>
+void CompactRemoveIfTestImpl(int N)
+{
+  camp::resources::Resource working_res{WORKING_RES()};
+
+  T* work_data;
+  T* host_data;
+
+  allocCompactTestData(N, working_res, &work_data, &host_data);
+
+  initCompactTestData(host_data, N);
+  std::vector<T> expected(host_data, host_data + N);
+  expected.erase(std::remove_if(expected.begin(),
+                                expected.end(),
+                                CompactTestPred<T>{}),
+                 expected.end());
+
+  working_res.memcpy(work_data, host_data, sizeof(T) * N);
+
+  const auto count = RAJA::remove_if<EXEC_POLICY>(
+      RAJA::make_span(work_data, N), CompactTestPred<T>{});
+
+  working_res.memcpy(host_data, work_data, sizeof(T) * N);
+
+  ASSERT_EQ(count, static_cast<decltype(count)>(expected.size()));
+  for (size_t i = 0; i < expected.size(); ++i) {
+    ASSERT_EQ(host_data[i], expected[i]) << "(at index " << i << ")";
+  }
+
+  deallocCompactTestData(working_res, work_data, host_data);
+}
+
+TYPED_TEST_SUITE_P(CompactRemoveIfTest);
+template <typename T>
+class CompactRemoveIfTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(CompactRemoveIfTest, CompactRemoveIf)
+{
+  using EXEC_POLICY      = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RESOURCE = typename camp::at<TypeParam, camp::num<1>>::type;
+  using DATA_TYPE        = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  for (int N : CompactTestSizes) {
+    CompactRemoveIfTestImpl<EXEC_POLICY, WORKING_RESOURCE, DATA_TYPE>(N);
+  }
+}
+
+REGISTER_TYPED_TEST_SUITE_P(CompactRemoveIfTest,
+                            CompactRemoveIf);
+
+#endif // __TEST_COMPACT_REMOVE_IF_HPP__
@@ -0,0 +1,68 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_COMPACT_DATA_HPP__
+#define __TEST_COMPACT_DATA_HPP__
+
+#include <random>
+
+//
+// Sizes used by the compaction tests; the largest is split into several
+// blocks by the parallel back-ends.
+//
+const int CompactTestSizes[] = {0, 1, 2, 17, 1000, 70001};
+
+//
+// Predicate used by the compaction tests; selects roughly a third of the
+// values produced by initCompactTestData.
+//
+template <typename T>
+struct CompactTestPred {
+  bool operator()(const T& x) const
+  {
+    return static_cast<long long>(x) % 3 == 0;
+  }
+};
+
+//
+// Methods to allocate/deallocate/initialize compaction test data.
+//
+
+template <typename T>
+void allocCompactTestData(int N,
+                          camp::resources::Resource& work_res,
+                          T** work_data,
+                          T** host_data)
+{
+  camp::resources::Resource host_res{camp::resources::Host()};
+
+  *work_data = work_res.allocate<T>(N);
+  *host_data = host_res.allocate<T>(N);
+}
+
+template <typename T>
+void deallocCompactTestData(camp::resources::Resource& work_res,
+                            T* work_data,
+                            T* host_data)
+{
+  camp::resources::Resource host_res{camp::resources::Host()};
+
+  work_res.deallocate(work_data);
+  host_res.deallocate(host_data);
+}
+
+template <typename T>
+void initCompactTestData(T* data, int N)
+{
+  std::mt19937 gen(N);
+  std::uniform_int_distribution<int> dist(0, 1000);
+  for (int i = 0; i < N; ++i) {
+    data[i] = static_cast<T>(dist(gen));
+  }
+}
+
+#endif // __TEST_COMPACT_DATA_HPP__
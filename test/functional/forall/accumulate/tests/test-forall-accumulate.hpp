@@ -0,0 +1,238 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Header file containing tests for RAJA::Accumulator with forall.
+///
+
+#ifndef __TEST_FORALL_ACCUMULATE_HPP__
+#define __TEST_FORALL_ACCUMULATE_HPP__
+
+//
+// Run one loop of the call site site, in which index i adds i % 3 + 1 to
+// element i % M of a target of M zeros. Checks the target and that all
+// copies used the same strategy, and returns that strategy.
+//
+template <typename ExecPolicy, typename WORKINGRES, typename T>
+RAJA::accumulate_strategy ForallAccumulateLoopImpl( RAJA::accumulate_site& site,
+                                                    RAJA::Index_type N,
+                                                    RAJA::Index_type M )
+{
+  RAJA::TypedRangeSegment<RAJA::Index_type> seg(0, N);
+
+  camp::resources::Resource work_res{WORKINGRES()};
+  camp::resources::Resource host_res{camp::resources::Host()};
+
+  T * target = work_res.allocate<T>(M);
+  int * used = work_res.allocate<int>(N);
+  T * check_target = host_res.allocate<T>(M);
+  int * check_used = host_res.allocate<int>(N);
+
+  for (RAJA::Index_type j = 0; j < M; ++j) {
+    check_target[j] = (T)0;
+  }
+  work_res.memcpy( target, check_target, sizeof(T) * M );
+
+  {
+    RAJA::Accumulator<T> acc(site, target, M);
+
+    RAJA::forall<ExecPolicy>(seg, [=](RAJA::Index_type i) {
+      acc(i % M) += (T)(i % 3 + 1);
+      used[i] = static_cast<int>(acc.strategy());
+    });
+  }
+
+  work_res.memcpy( check_target, target, sizeof(T) * M );
+  work_res.memcpy( check_used, used, sizeof(int) * N );
+
+  for (RAJA::Index_type j = 0; j < M; ++j) {
+    T expected = (T)0;
+    for (RAJA::Index_type i = j; i < N; i += M) {
+      expected += (T)(i % 3 + 1);
+    }
+    EXPECT_EQ(check_target[j], expected);
+  }
+
+  const int strategy = N > 0 ? check_used[0] : -1;
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    EXPECT_EQ(check_used[i], strategy);
+  }
+
+  work_res.deallocate( target );
+  work_res.deallocate( used );
+  host_res.deallocate( check_target );
+  host_res.deallocate( check_used );
+
+  return static_cast<RAJA::accumulate_strategy>(strategy);
+}
+
+TYPED_TEST_SUITE_P(ForallAccumulateTest);
+template <typename T>
+class ForallAccumulateTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(ForallAccumulateTest, AccumulateScalar)
+{
+  using ExecPolicy = typename camp::at<TypeParam, camp::num<0>>::type;
+  using ResType    = typename camp::at<TypeParam, camp::num<1>>::type;
+  using DType      = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  RAJA::accumulate_site site;
+  const RAJA::Index_type N = 10000;
+
+  for (int run = 0; run < 4; ++run) {
+    DType sum = (DType)5;
+    {
+      RAJA::Accumulator<DType> acc(site, &sum);
+
+      RAJA::forall<ExecPolicy>(RAJA::TypedRangeSegment<RAJA::Index_type>(0, N),
+                               [=](RAJA::Index_type i) {
+        acc += (DType)(i % 4 + 1);
+        acc -= (DType)1;
+      });
+    }
+
+    DType expected = (DType)5;
+    for (RAJA::Index_type i = 0; i < N; ++i) {
+      expected += (DType)(i % 4);
+    }
+    ASSERT_EQ(sum, expected);
+  }
+
+  // a scalar is privatized like a reduction, without probing
+  ASSERT_EQ(site.strategy(), RAJA::accumulate_strategy::privatized);
+  ASSERT_EQ(site.contention(), 0.0);
+
+  RAJA::accumulate_site scalar_site;
+  ASSERT_EQ((ForallAccumulateLoopImpl<ExecPolicy, ResType, DType>(
+                scalar_site, N, 1)),
+            RAJA::accumulate_strategy::privatized);
+
+  // unless forced otherwise
+  scalar_site.force(RAJA::accumulate_strategy::atomic);
+  ASSERT_EQ((ForallAccumulateLoopImpl<ExecPolicy, ResType, DType>(
+                scalar_site, N, 1)),
+            RAJA::accumulate_strategy::atomic);
+}
+
+TYPED_TEST_P(ForallAccumulateTest, AccumulateProbe)
+{
+  using ExecPolicy = typename camp::at<TypeParam, camp::num<0>>::type;
+  using ResType    = typename camp::at<TypeParam, camp::num<1>>::type;
+  using DType      = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  // contention is never high enough, so only the updates per element decide
+
+  // many updates per element: private buffers pay off
+  RAJA::accumulate_site dense_site(2, 1.0e30);
+  for (int run = 0; run < 2; ++run) {
+    ASSERT_EQ((ForallAccumulateLoopImpl<ExecPolicy, ResType, DType>(
+                  dense_site, 100000, 7)),
+              RAJA::accumulate_strategy::probe);
+  }
+  for (int run = 0; run < 2; ++run) {
+    ASSERT_EQ((ForallAccumulateLoopImpl<ExecPolicy, ResType, DType>(
+                  dense_site, 100000, 7)),
+              RAJA::accumulate_strategy::privatized);
+  }
+  ASSERT_EQ(dense_site.strategy(), RAJA::accumulate_strategy::privatized);
+
+  // fewer updates than elements: atomics are cheaper
+  RAJA::accumulate_site sparse_site(1, 1.0e30);
+  const RAJA::Index_type M = 4 * RAJA::detail::privatized_dense_limit + 1;
+  ASSERT_EQ((ForallAccumulateLoopImpl<ExecPolicy, ResType, DType>(
+                sparse_site, 1000, M)),
+            RAJA::accumulate_strategy::probe);
+  for (int run = 0; run < 2; ++run) {
+    ASSERT_EQ((ForallAccumulateLoopImpl<ExecPolicy, ResType, DType>(
+                  sparse_site, 1000, M)),
+              RAJA::accumulate_strategy::atomic);
+  }
+
+  // any retry counts as contention, so the same loop is privatized
+  RAJA::accumulate_site contended_site(1, -1.0);
+  ASSERT_EQ((ForallAccumulateLoopImpl<ExecPolicy, ResType, DType>(
+                contended_site, 1000, M)),
+            RAJA::accumulate_strategy::probe);
+  ASSERT_EQ((ForallAccumulateLoopImpl<ExecPolicy, ResType, DType>(
+                contended_site, 1000, M)),
+            RAJA::accumulate_strategy::privatized);
+  ASSERT_GE(contended_site.contention(), 0.0);
+}
+
+TYPED_TEST_P(ForallAccumulateTest, AccumulateForced)
+{
+  using ExecPolicy = typename camp::at<TypeParam, camp::num<0>>::type;
+  using ResType    = typename camp::at<TypeParam, camp::num<1>>::type;
+  using DType      = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  RAJA::accumulate_site site;
+
+  site.force(RAJA::accumulate_strategy::atomic);
+  for (int run = 0; run < 3; ++run) {
+    ASSERT_EQ((ForallAccumulateLoopImpl<ExecPolicy, ResType, DType>(
+                  site, 10000, 50)),
+              RAJA::accumulate_strategy::atomic);
+  }
+
+  site.force(RAJA::accumulate_strategy::privatized);
+  for (int run = 0; run < 3; ++run) {
+    ASSERT_EQ((ForallAccumulateLoopImpl<ExecPolicy, ResType, DType>(
+                  site, 10000, 50)),
+              RAJA::accumulate_strategy::privatized);
+  }
+
+  site.reset();
+  ASSERT_EQ(site.strategy(), RAJA::accumulate_strategy::probe);
+  ASSERT_EQ(site.contention(), 0.0);
+  ASSERT_EQ((ForallAccumulateLoopImpl<ExecPolicy, ResType, DType>(
+                site, 10000, 50)),
+            RAJA::accumulate_strategy::probe);
+}
+
+TYPED_TEST_P(ForallAccumulateTest, AccumulateOriginal)
+{
+  using DType = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  RAJA::accumulate_site site;
+  DType target[3] = {(DType)0, (DType)0, (DType)0};
+
+  // the object constructed by the user adds to the target right away and
+  // does not start an invocation of the site
+  RAJA::Accumulator<DType> acc(site, target, 3);
+  ASSERT_EQ(acc.strategy(), RAJA::accumulate_strategy::atomic);
+
+  acc(1) += (DType)4;
+  acc(2)++;
+  acc(2)--;
+  acc(0)++;
+  ASSERT_EQ(target[0], (DType)1);
+  ASSERT_EQ(target[1], (DType)4);
+  ASSERT_EQ(target[2], (DType)0);
+
+  ASSERT_EQ(site.strategy(), RAJA::accumulate_strategy::probe);
+  ASSERT_EQ(site.contention(), 0.0);
+
+  // a copy starts one, and its updates reach the target when it is destroyed
+  site.force(RAJA::accumulate_strategy::privatized);
+  {
+    RAJA::Accumulator<DType> copy(acc);
+    ASSERT_EQ(copy.strategy(), RAJA::accumulate_strategy::privatized);
+    copy(1) += (DType)2;
+    ASSERT_EQ(target[1], (DType)4);
+  }
+  ASSERT_EQ(target[1], (DType)6);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ForallAccumulateTest,
+                            AccumulateScalar,
+                            AccumulateProbe,
+                            AccumulateForced,
+                            AccumulateOriginal);
+
+#endif  //__TEST_FORALL_ACCUMULATE_HPP__
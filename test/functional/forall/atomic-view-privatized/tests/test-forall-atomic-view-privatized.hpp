@@ -0,0 +1,97 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Header file containing tests for privatized atomic views with forall.
+///
+
+#ifndef __TEST_FORALL_ATOMIC_VIEW_PRIVATIZED_HPP__
+#define __TEST_FORALL_ATOMIC_VIEW_PRIVATIZED_HPP__
+
+//
+// Scatter three updates per index i into a view of M entries, the first to
+// a pseudo-random entry so that larger views are privatized sparsely.
+//
+template <typename ExecPolicy, typename WORKINGRES, typename T>
+void ForallAtomicViewPrivatizedTestImpl( RAJA::Index_type N,
+                                         RAJA::Index_type M )
+{
+  RAJA::TypedRangeSegment<RAJA::Index_type> seg(0, N);
+
+  camp::resources::Resource work_res{WORKINGRES()};
+  camp::resources::Resource host_res{camp::resources::Host()};
+
+  T * dest = work_res.allocate<T>(M);
+  T * check_array = host_res.allocate<T>(M);
+  T * test_array = host_res.allocate<T>(M);
+
+  for (RAJA::Index_type j = 0; j < M; ++j) {
+    test_array[j] = (T)1;
+  }
+  work_res.memcpy( dest, test_array, sizeof(T) * M );
+
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    test_array[(i * 7919) % M] += (T)(i % 5);
+    test_array[(i / 3) % M] -= (T)1;
+    test_array[i % M] += (T)1;
+  }
+
+  RAJA::View<T, RAJA::Layout<1>> dest_view(dest, M);
+  auto dest_atomic_view =
+    RAJA::make_atomic_view<RAJA::privatized_atomic>(dest_view);
+
+  RAJA::forall<ExecPolicy>(seg, [=](RAJA::Index_type i) {
+    dest_atomic_view((i * 7919) % M) += (T)(i % 5);
+    dest_atomic_view((i / 3) % M) -= (T)1;
+    dest_atomic_view(i % M)++;
+  });
+
+  work_res.memcpy( check_array, dest, sizeof(T) * M );
+
+  for (RAJA::Index_type j = 0; j < M; ++j) {
+    ASSERT_EQ(test_array[j], check_array[j]);
+  }
+
+  work_res.deallocate( dest );
+  host_res.deallocate( check_array );
+  host_res.deallocate( test_array );
+}
+
+TYPED_TEST_SUITE_P(ForallAtomicViewPrivatizedTest);
+template <typename T>
+class ForallAtomicViewPrivatizedTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(ForallAtomicViewPrivatizedTest, AtomicViewPrivatizedDense)
+{
+  using ExecPolicy = typename camp::at<TypeParam, camp::num<0>>::type;
+  using ResType    = typename camp::at<TypeParam, camp::num<1>>::type;
+  using DType      = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  ForallAtomicViewPrivatizedTestImpl<ExecPolicy, ResType, DType>( 0, 7 );
+  ForallAtomicViewPrivatizedTestImpl<ExecPolicy, ResType, DType>( 100000, 1 );
+  ForallAtomicViewPrivatizedTestImpl<ExecPolicy, ResType, DType>( 100000, 50000 );
+}
+
+TYPED_TEST_P(ForallAtomicViewPrivatizedTest, AtomicViewPrivatizedSparse)
+{
+  using ExecPolicy = typename camp::at<TypeParam, camp::num<0>>::type;
+  using ResType    = typename camp::at<TypeParam, camp::num<1>>::type;
+  using DType      = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  const RAJA::Index_type M = 4 * RAJA::detail::privatized_dense_limit + 1;
+
+  ForallAtomicViewPrivatizedTestImpl<ExecPolicy, ResType, DType>( 1000, M );
+  ForallAtomicViewPrivatizedTestImpl<ExecPolicy, ResType, DType>( 100000, M );
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ForallAtomicViewPrivatizedTest,
+                            AtomicViewPrivatizedDense,
+                            AtomicViewPrivatizedSparse);
+
+#endif  //__TEST_FORALL_ATOMIC_VIEW_PRIVATIZED_HPP__
@@ -0,0 +1,119 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Header file containing tests for RAJA::Counter with forall.
+///
+
+#ifndef __TEST_FORALL_COUNTER_HPP__
+#define __TEST_FORALL_COUNTER_HPP__
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+//
+// Every index adds to the counter, some indices subtract again.
+//
+template <typename ExecPolicy, typename T>
+void ForallCounterCountTestImpl( RAJA::Index_type N )
+{
+  RAJA::TypedRangeSegment<RAJA::Index_type> seg(0, N);
+
+  RAJA::Counter<T> counter(T(3));
+
+  RAJA::forall<ExecPolicy>(seg, [=](RAJA::Index_type i) {
+    ++counter;
+    counter += (T)(i % 3);
+    if (i % 4 == 0) {
+      counter--;
+    }
+  });
+
+  T expected = (T)3;
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    expected = (T)(expected + 1 + (i % 3) - (i % 4 == 0 ? 1 : 0));
+  }
+  ASSERT_EQ(counter.get(), expected);
+}
+
+//
+// Every index takes 1 or 2 values with fetch_add. The values handed out and
+// the gaps reported by unused() must exactly tile [0, reserved()).
+//
+template <typename ExecPolicy, typename WORKINGRES, typename T>
+void ForallCounterFetchAddTestImpl( RAJA::Index_type N, T block_size )
+{
+  RAJA::TypedRangeSegment<RAJA::Index_type> seg(0, N);
+
+  camp::resources::Resource work_res{WORKINGRES()};
+  camp::resources::Resource host_res{camp::resources::Host()};
+
+  T * starts = work_res.allocate<T>(N);
+  T * check_array = host_res.allocate<T>(N);
+
+  RAJA::Counter<T> counter(T(0), block_size);
+
+  RAJA::forall<ExecPolicy>(seg, [=](RAJA::Index_type i) {
+    starts[i] = counter.fetch_add((T)(1 + i % 2));
+  });
+
+  work_res.memcpy( check_array, starts, sizeof(T) * N );
+
+  std::vector<std::pair<T, T>> ranges = counter.unused();
+  T total = (T)0;
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    const T n = (T)(1 + i % 2);
+    ranges.emplace_back(check_array[i], (T)(check_array[i] + n));
+    total = (T)(total + n);
+  }
+  std::sort(ranges.begin(), ranges.end());
+
+  ASSERT_EQ(counter.get(), total);
+
+  T next = (T)0;
+  for (auto const& range : ranges) {
+    ASSERT_EQ(range.first, next);
+    next = range.second;
+  }
+  ASSERT_EQ(next, counter.reserved());
+
+  work_res.deallocate( starts );
+  host_res.deallocate( check_array );
+}
+
+TYPED_TEST_SUITE_P(ForallCounterTest);
+template <typename T>
+class ForallCounterTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(ForallCounterTest, CounterCount)
+{
+  using ExecPolicy = typename camp::at<TypeParam, camp::num<0>>::type;
+  using DType      = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  ForallCounterCountTestImpl<ExecPolicy, DType>( 0 );
+  ForallCounterCountTestImpl<ExecPolicy, DType>( 5000 );
+}
+
+TYPED_TEST_P(ForallCounterTest, CounterFetchAdd)
+{
+  using ExecPolicy = typename camp::at<TypeParam, camp::num<0>>::type;
+  using ResType    = typename camp::at<TypeParam, camp::num<1>>::type;
+  using DType      = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  ForallCounterFetchAddTestImpl<ExecPolicy, ResType, DType>( 5000, (DType)1 );
+  ForallCounterFetchAddTestImpl<ExecPolicy, ResType, DType>( 5000, (DType)7 );
+  ForallCounterFetchAddTestImpl<ExecPolicy, ResType, DType>( 5000, (DType)64 );
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ForallCounterTest,
+                            CounterCount,
+                            CounterFetchAdd);
+
+#endif  //__TEST_FORALL_COUNTER_HPP__
@@ -0,0 +1,118 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+#ifndef __TEST_FORALL_BASIC_REDUCEMINLOCK_HPP__
+#define __TEST_FORALL_BASIC_REDUCEMINLOCK_HPP__
+
+#include <algorithm>
+#include <cstdlib>
+#include <utility>
+#include <vector>
+
+template <typename DATA_TYPE, typename WORKING_RES, 
+          typename EXEC_POLICY, typename REDUCE_POLICY>
+void ForallReduceMinLocKBasicTestImpl(RAJA::Index_type first, RAJA::Index_type last)
+{
+  RAJA::TypedRangeSegment<RAJA::Index_type> r1(first, last);
+
+  camp::resources::Resource working_res{WORKING_RES()};
+  DATA_TYPE* working_array;
+  DATA_TYPE* check_array;
+  DATA_TYPE* test_array;
+
+  allocateForallTestData<DATA_TYPE>(last,
+                                    working_res,
+                                    &working_array,
+                                    &check_array,
+                                    &test_array);
+
+  constexpr size_t K = 5;
+  const int modval = 100;
+
+  for (RAJA::Index_type i = 0; i < last; ++i) {
+    test_array[i] = static_cast<DATA_TYPE>( rand() % modval );
+  }
+
+  //
+  // Reference: min values first, ties broken by the smaller index
+  //
+  std::vector<std::pair<DATA_TYPE, RAJA::Index_type>> ref;
+  for (RAJA::Index_type i = first; i < last; ++i) {
+    ref.emplace_back(test_array[i], i);
+  }
+  std::sort(ref.begin(), ref.end(),
+            [](std::pair<DATA_TYPE, RAJA::Index_type> const& a,
+               std::pair<DATA_TYPE, RAJA::Index_type> const& b) {
+              return a.first < b.first ||
+                     (a.first == b.first && a.second < b.second);
+            });
+  const size_t ref_size = std::min(K, ref.size());
+
+  working_res.memcpy(working_array, test_array, sizeof(DATA_TYPE) * last);
+
+
+  RAJA::ReduceMinLocK<REDUCE_POLICY, DATA_TYPE, RAJA::Index_type, K> mink;
+
+  RAJA::forall<EXEC_POLICY>(r1, [=](RAJA::Index_type idx) {
+    mink.minloc( working_array[idx], idx );
+  });
+
+  ASSERT_EQ(mink.size(), ref_size);
+  for (size_t k = 0; k < ref_size; ++k) {
+    ASSERT_EQ(static_cast<DATA_TYPE>(mink.get(k)), ref[k].first);
+    ASSERT_EQ(static_cast<RAJA::Index_type>(mink.getLoc(k)), ref[k].second);
+  }
+
+  mink.reset();
+  ASSERT_EQ(mink.size(), static_cast<size_t>(0));
+
+  DATA_TYPE factor = 2;
+  RAJA::forall<EXEC_POLICY>(r1, [=](RAJA::Index_type idx) {
+    mink.minloc( working_array[idx] * factor, idx );
+  });
+
+  ASSERT_EQ(mink.size(), ref_size);
+  for (size_t k = 0; k < ref_size; ++k) {
+    ASSERT_EQ(static_cast<DATA_TYPE>(mink.get(k)), ref[k].first * factor);
+    ASSERT_EQ(static_cast<RAJA::Index_type>(mink.getLoc(k)), ref[k].second);
+  }
+
+
+  deallocateForallTestData<DATA_TYPE>(working_res,
+                                      working_array,
+                                      check_array,
+                                      test_array);
+}
+
+TYPED_TEST_SUITE_P(ForallReduceMinLocKBasicTest);
+template <typename T>
+class ForallReduceMinLocKBasicTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(ForallReduceMinLocKBasicTest, ReduceMinLocKBasicForall)
+{
+  using DATA_TYPE     = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES   = typename camp::at<TypeParam, camp::num<1>>::type;
+  using EXEC_POLICY   = typename camp::at<TypeParam, camp::num<2>>::type;
+  using REDUCE_POLICY = typename camp::at<TypeParam, camp::num<3>>::type;
+
+  ForallReduceMinLocKBasicTestImpl<DATA_TYPE, WORKING_RES, 
+                                    EXEC_POLICY, REDUCE_POLICY>(5, 8);
+  ForallReduceMinLocKBasicTestImpl<DATA_TYPE, WORKING_RES, 
+                                    EXEC_POLICY, REDUCE_POLICY>(0, 28);
+  ForallReduceMinLocKBasicTestImpl<DATA_TYPE, WORKING_RES, 
+                                    EXEC_POLICY, REDUCE_POLICY>(3, 642);
+  ForallReduceMinLocKBasicTestImpl<DATA_TYPE, WORKING_RES, 
+                                    EXEC_POLICY, REDUCE_POLICY>(0, 2057);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ForallReduceMinLocKBasicTest,
+                            ReduceMinLocKBasicForall);
+
+#endif  // __TEST_FORALL_BASIC_REDUCEMINLOCK_HPP__
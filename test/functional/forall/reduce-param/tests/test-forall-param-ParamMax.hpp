@@ -0,0 +1,98 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_FORALL_PARAM_MAX_HPP__
+#define __TEST_FORALL_PARAM_MAX_HPP__
+
+#include <cstdlib>
+#include <numeric>
+
+template <typename DATA_TYPE, typename WORKING_RES, typename EXEC_POLICY>
+void ForallParamMaxTestImpl(RAJA::Index_type first, RAJA::Index_type last)
+{
+  RAJA::TypedRangeSegment<RAJA::Index_type> r1(first, last);
+
+  camp::resources::Resource working_res{WORKING_RES()};
+  DATA_TYPE* working_array;
+  DATA_TYPE* check_array;
+  DATA_TYPE* test_array;
+
+  allocateForallTestData<DATA_TYPE>(last,
+                                    working_res,
+                                    &working_array,
+                                    &check_array,
+                                    &test_array);
+
+  const int modval = 100;
+  const DATA_TYPE max_init = -1;
+  const DATA_TYPE big_max = modval*2;
+
+  for (RAJA::Index_type i = 0; i < last; ++i) {
+    test_array[i] = static_cast<DATA_TYPE>( rand() % modval );
+  }
+
+  DATA_TYPE ref_max = max_init;
+  for (RAJA::Index_type i = first; i < last; ++i) {
+    ref_max = RAJA_MAX(test_array[i], ref_max); 
+  }
+
+  working_res.memcpy(working_array, test_array, sizeof(DATA_TYPE) * last);
+
+
+  DATA_TYPE maxinit = big_max;
+  DATA_TYPE max = max_init;
+
+  RAJA::forall<EXEC_POLICY>(r1,
+    RAJA::reduce_max(&maxinit),
+    RAJA::reduce_max(&max),
+    [=](RAJA::Index_type idx, DATA_TYPE& m0, DATA_TYPE& m1) {
+      m0 = RAJA_MAX(working_array[idx], m0);
+      m1 = RAJA_MAX(working_array[idx], m1);
+  });
+
+  ASSERT_EQ(maxinit, big_max);
+  ASSERT_EQ(max, ref_max);
+
+  max = max_init;
+
+  DATA_TYPE factor = 3; 
+  RAJA::forall<EXEC_POLICY>(r1,
+    RAJA::reduce_max(&max),
+    [=](RAJA::Index_type idx, DATA_TYPE& m) {
+      m = RAJA_MAX(working_array[idx] * factor, m);
+  });
+  ASSERT_EQ(max, ref_max * factor);
+   
+
+  deallocateForallTestData<DATA_TYPE>(working_res,
+                                      working_array,
+                                      check_array,
+                                      test_array);
+}
+
+
+TYPED_TEST_SUITE_P(ForallParamMaxTest);
+template <typename T>
+class ForallParamMaxTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(ForallParamMaxTest, ParamMaxForall)
+{
+  using DATA_TYPE     = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES   = typename camp::at<TypeParam, camp::num<1>>::type;
+  using EXEC_POLICY   = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  ForallParamMaxTestImpl<DATA_TYPE, WORKING_RES, EXEC_POLICY>(0, 28);
+  ForallParamMaxTestImpl<DATA_TYPE, WORKING_RES, EXEC_POLICY>(3, 642);
+  ForallParamMaxTestImpl<DATA_TYPE, WORKING_RES, EXEC_POLICY>(0, 2057);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ForallParamMaxTest,
+                            ParamMaxForall);
+
+#endif  // __TEST_FORALL_PARAM_MAX_HPP__
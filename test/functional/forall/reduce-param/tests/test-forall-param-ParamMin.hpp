@@ -0,0 +1,98 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_FORALL_PARAM_MIN_HPP__
+#define __TEST_FORALL_PARAM_MIN_HPP__
+
+#include <cstdlib>
+#include <numeric>
+
+template <typename DATA_TYPE, typename WORKING_RES, typename EXEC_POLICY>
+void ForallParamMinTestImpl(RAJA::Index_type first, RAJA::Index_type last)
+{
+  RAJA::TypedRangeSegment<RAJA::Index_type> r1(first, last);
+
+  camp::resources::Resource working_res{WORKING_RES()};
+  DATA_TYPE* working_array;
+  DATA_TYPE* check_array;
+  DATA_TYPE* test_array;
+
+  allocateForallTestData<DATA_TYPE>(last,
+                                    working_res,
+                                    &working_array,
+                                    &check_array,
+                                    &test_array);
+
+  const int modval = 100;
+  const DATA_TYPE min_init = modval+1;
+  const DATA_TYPE small_min = -modval;
+
+  for (RAJA::Index_type i = 0; i < last; ++i) {
+    test_array[i] = static_cast<DATA_TYPE>( rand() % modval );
+  }
+
+  DATA_TYPE ref_min = min_init;
+  for (RAJA::Index_type i = first; i < last; ++i) {
+    ref_min = RAJA_MIN(test_array[i], ref_min); 
+  }
+
+  working_res.memcpy(working_array, test_array, sizeof(DATA_TYPE) * last);
+
+
+  DATA_TYPE mininit = small_min;
+  DATA_TYPE min = min_init;
+
+  RAJA::forall<EXEC_POLICY>(r1,
+    RAJA::reduce_min(&mininit),
+    RAJA::reduce_min(&min),
+    [=](RAJA::Index_type idx, DATA_TYPE& m0, DATA_TYPE& m1) {
+      m0 = RAJA_MIN(working_array[idx], m0);
+      m1 = RAJA_MIN(working_array[idx], m1);
+  });
+
+  ASSERT_EQ(mininit, small_min);
+  ASSERT_EQ(min, ref_min);
+
+  min = min_init;
+
+  DATA_TYPE factor = 3; 
+  RAJA::forall<EXEC_POLICY>(r1,
+    RAJA::reduce_min(&min),
+    [=](RAJA::Index_type idx, DATA_TYPE& m) {
+      m = RAJA_MIN(working_array[idx] * factor, m);
+  });
+  ASSERT_EQ(min, ref_min * factor);
+   
+
+  deallocateForallTestData<DATA_TYPE>(working_res,
+                                      working_array,
+                                      check_array,
+                                      test_array);
+}
+
+
+TYPED_TEST_SUITE_P(ForallParamMinTest);
+template <typename T>
+class ForallParamMinTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(ForallParamMinTest, ParamMinForall)
+{
+  using DATA_TYPE     = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES   = typename camp::at<TypeParam, camp::num<1>>::type;
+  using EXEC_POLICY   = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  ForallParamMinTestImpl<DATA_TYPE, WORKING_RES, EXEC_POLICY>(0, 28);
+  ForallParamMinTestImpl<DATA_TYPE, WORKING_RES, EXEC_POLICY>(3, 642);
+  ForallParamMinTestImpl<DATA_TYPE, WORKING_RES, EXEC_POLICY>(0, 2057);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ForallParamMinTest,
+                            ParamMinForall);
+
+#endif  // __TEST_FORALL_PARAM_MIN_HPP__
@@ -0,0 +1,182 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_FORALL_PARAM_SUM_HPP__
+#define __TEST_FORALL_PARAM_SUM_HPP__
+
+#include <cstdlib>
+#include <numeric>
+#include <type_traits>
+
+//
+// Work-sharing policies that can be used inside an enclosing parallel region
+//
+template <typename EXEC_POLICY>
+struct ForallParamSumTeamPolicy : std::false_type
+{
+};
+
+#if defined(RAJA_ENABLE_OPENMP)
+template <>
+struct ForallParamSumTeamPolicy<RAJA::omp_for_exec> : std::true_type
+{
+};
+
+template <>
+struct ForallParamSumTeamPolicy<RAJA::omp_for_nowait_exec> : std::true_type
+{
+};
+#endif
+
+template <typename EXEC_POLICY, typename DATA_TYPE>
+void ForallParamSumTeamImpl(RAJA::TypedRangeSegment<RAJA::Index_type>,
+                            DATA_TYPE*,
+                            DATA_TYPE,
+                            std::false_type)
+{
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+template <typename EXEC_POLICY, typename DATA_TYPE>
+void ForallParamSumTeamImpl(RAJA::TypedRangeSegment<RAJA::Index_type> r1,
+                            DATA_TYPE* working_array,
+                            DATA_TYPE ref_sum,
+                            std::true_type)
+{
+  // every thread of the team calls forall() with the same target
+  DATA_TYPE sum = 5;
+
+#pragma omp parallel
+  {
+    RAJA::forall<EXEC_POLICY>(r1,
+      RAJA::reduce_sum(&sum),
+      [=](RAJA::Index_type idx, DATA_TYPE& s) {
+        s += working_array[idx];
+    });
+  }
+
+  ASSERT_EQ(sum, ref_sum + 5);
+}
+#endif
+
+template <typename DATA_TYPE,
+          typename WORKING_RES,
+          typename EXEC_POLICY,
+          typename REDUCE_POLICY>
+void ForallParamSumTestImpl(RAJA::Index_type first, RAJA::Index_type last)
+{
+  RAJA::TypedRangeSegment<RAJA::Index_type> r1(first, last);
+
+  camp::resources::Resource working_res{WORKING_RES()};
+  DATA_TYPE* working_array;
+  DATA_TYPE* check_array;
+  DATA_TYPE* test_array;
+
+  allocateForallTestData<DATA_TYPE>(last,
+                                    working_res,
+                                    &working_array,
+                                    &check_array,
+                                    &test_array);
+
+  const int modval = 100;
+
+  for (RAJA::Index_type i = 0; i < last; ++i) {
+    test_array[i] = static_cast<DATA_TYPE>( rand() % modval );
+  }
+
+  DATA_TYPE ref_sum = 0;
+  for (RAJA::Index_type i = first; i < last; ++i) {
+    ref_sum += test_array[i]; 
+  }
+
+  working_res.memcpy(working_array, test_array, sizeof(DATA_TYPE) * last);
+
+
+  DATA_TYPE sum = 0;
+  DATA_TYPE sum2 = 2;
+
+  RAJA::forall<EXEC_POLICY>(r1,
+    RAJA::reduce_sum(&sum),
+    RAJA::reduce_sum(&sum2),
+    [=](RAJA::Index_type idx, DATA_TYPE& s, DATA_TYPE& s2) {
+      s  += working_array[idx];
+      s2 += working_array[idx];
+  });
+
+  ASSERT_EQ(sum, ref_sum);
+  ASSERT_EQ(sum2, ref_sum + 2);
+
+  sum = 0;
+
+  const int nloops = 2;
+
+  for (int j = 0; j < nloops; ++j) {
+    RAJA::forall<EXEC_POLICY>(r1,
+      RAJA::reduce_sum(&sum),
+      [=](RAJA::Index_type idx, DATA_TYPE& s) {
+        s += working_array[idx];
+    });
+  }
+
+  ASSERT_EQ(sum, nloops * ref_sum);
+
+  sum = 0;
+
+  RAJA::forall(EXEC_POLICY{}, r1,
+    RAJA::reduce_sum(&sum),
+    [=](RAJA::Index_type idx, DATA_TYPE& s) {
+      s += working_array[idx];
+  });
+
+  ASSERT_EQ(sum, ref_sum);
+
+  // a reducer captured by the body is privatized along with the parameters
+  RAJA::ReduceSum<REDUCE_POLICY, DATA_TYPE> captured(0);
+  sum = 0;
+
+  RAJA::forall<EXEC_POLICY>(r1,
+    RAJA::reduce_sum(&sum),
+    [=](RAJA::Index_type idx, DATA_TYPE& s) {
+      s += working_array[idx];
+      captured += working_array[idx];
+  });
+
+  ASSERT_EQ(sum, ref_sum);
+  ASSERT_EQ(static_cast<DATA_TYPE>(captured.get()), ref_sum);
+
+  ForallParamSumTeamImpl<EXEC_POLICY>(
+      r1, working_array, ref_sum, ForallParamSumTeamPolicy<EXEC_POLICY>{});
+
+  deallocateForallTestData<DATA_TYPE>(working_res,
+                                      working_array,
+                                      check_array,
+                                      test_array);
+}
+
+
+TYPED_TEST_SUITE_P(ForallParamSumTest);
+template <typename T>
+class ForallParamSumTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(ForallParamSumTest, ParamSumForall)
+{
+  using DATA_TYPE     = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES   = typename camp::at<TypeParam, camp::num<1>>::type;
+  using EXEC_POLICY   = typename camp::at<TypeParam, camp::num<2>>::type;
+  using REDUCE_POLICY = typename camp::at<TypeParam, camp::num<3>>::type;
+
+  ForallParamSumTestImpl<DATA_TYPE, WORKING_RES, EXEC_POLICY, REDUCE_POLICY>(0, 28);
+  ForallParamSumTestImpl<DATA_TYPE, WORKING_RES, EXEC_POLICY, REDUCE_POLICY>(3, 642);
+  ForallParamSumTestImpl<DATA_TYPE, WORKING_RES, EXEC_POLICY, REDUCE_POLICY>(0, 2057);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ForallParamSumTest,
+                            ParamSumForall);
+
+#endif  // __TEST_FORALL_PARAM_SUM_HPP__
@@ -0,0 +1,104 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_MERGE_MERGE_HPP__
+#define __TEST_MERGE_MERGE_HPP__
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+template <typename EXEC_POLICY, typename WORKING_RES, typename T>
+void MergeMergeTestImpl(int M, int L, int max_value)
+{
+  camp::resources::Resource working_res{WORKING_RES()};
+
+  T* work_a;
+  T* host_a;
+  T* work_b;
+  T* host_b;
+  T* work_out;
+  T* host_out;
+
+  allocMergeTestData(M, working_res, &work_a, &host_a);
+  allocMergeTestData(L, working_res, &work_b, &host_b);
+  allocMergeTestData(M + L, working_res, &work_out, &host_out);
+
+  initMergeTestData(host_a, M, max_value, 1u);
+  initMergeTestData(host_b, L, max_value, 2u);
+  std::vector<T> expected(M + L);
+  std::merge(host_a, host_a + M, host_b, host_b + L, expected.begin());
+
+  working_res.memcpy(work_a, host_a, sizeof(T) * M);
+  working_res.memcpy(work_b, host_b, sizeof(T) * L);
+
+  auto count = RAJA::merge<EXEC_POLICY>(
+      work_a, work_a + M, work_b, work_b + L, work_out);
+
+  working_res.memcpy(host_out, work_out, sizeof(T) * (M + L));
+
+  ASSERT_EQ(count, static_cast<decltype(count)>(M + L));
+  for (int i = 0; i < M + L; ++i) {
+    ASSERT_EQ(host_out[i], expected[i]) << "(at index " << i << ")";
+  }
+
+  // descending order, with the inputs swapped
+  std::reverse(host_a, host_a + M);
+  std::reverse(host_b, host_b + L);
+  std::merge(host_b,
+             host_b + L,
+             host_a,
+             host_a + M,
+             expected.begin(),
+             std::greater<T>{});
+
+  working_res.memcpy(work_a, host_a, sizeof(T) * M);
+  working_res.memcpy(work_b, host_b, sizeof(T) * L);
+
+  count = RAJA::merge<EXEC_POLICY>(work_b,
+                                   work_b + L,
+                                   work_a,
+                                   work_a + M,
+                                   work_out,
+                                   RAJA::operators::greater<T>{});
+
+  working_res.memcpy(host_out, work_out, sizeof(T) * (M + L));
+
+  ASSERT_EQ(count, static_cast<decltype(count)>(M + L));
+  for (int i = 0; i < M + L; ++i) {
+    ASSERT_EQ(host_out[i], expected[i]) << "(at index " << i << ")";
+  }
+
+  deallocMergeTestData(working_res, work_a, host_a);
+  deallocMergeTestData(working_res, work_b, host_b);
+  deallocMergeTestData(working_res, work_out, host_out);
+}
+
+TYPED_TEST_SUITE_P(MergeMergeTest);
+template <typename T>
+class MergeMergeTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(MergeMergeTest, MergeMerge)
+{
+  using EXEC_POLICY      = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RESOURCE = typename camp::at<TypeParam, camp::num<1>>::type;
+  using DATA_TYPE        = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  for (auto const& sizes : MergeTestSizes) {
+    for (int max_value : MergeTestMaxValues) {
+      MergeMergeTestImpl<EXEC_POLICY, WORKING_RESOURCE, DATA_TYPE>(
+          sizes[0], sizes[1], max_value);
+    }
+  }
+}
+
+REGISTER_TYPED_TEST_SUITE_P(MergeMergeTest,
+                            MergeMerge);
+
+#endif // __TEST_MERGE_MERGE_HPP__
@@ -0,0 +1,142 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_MERGE_SET_INTERSECTION_HPP__
+#define __TEST_MERGE_SET_INTERSECTION_HPP__
+
+#include <algorithm>
+#include <vector>
+
+template <typename EXEC_POLICY, typename WORKING_RES, typename T>
+void MergeSetIntersectionTestImpl(int M, int L, int max_value)
+{
+  camp::resources::Resource working_res{WORKING_RES()};
+
+  T* work_a;
+  T* host_a;
+  T* work_b;
+  T* host_b;
+  T* work_out;
+  T* host_out;
+
+  allocMergeTestData(M, working_res, &work_a, &host_a);
+  allocMergeTestData(L, working_res, &work_b, &host_b);
+  allocMergeTestData(std::min(M, L), working_res, &work_out, &host_out);
+
+  initMergeTestData(host_a, M, max_value, 1u);
+  initMergeTestData(host_b, L, max_value, 2u);
+  std::vector<T> expected;
+  std::set_intersection(host_a,
+                        host_a + M,
+                        host_b,
+                        host_b + L,
+                        std::back_inserter(expected));
+
+  working_res.memcpy(work_a, host_a, sizeof(T) * M);
+  working_res.memcpy(work_b, host_b, sizeof(T) * L);
+
+  const auto count = RAJA::set_intersection<EXEC_POLICY>(
+      work_a, work_a + M, work_b, work_b + L, work_out);
+
+  working_res.memcpy(host_out, work_out, sizeof(T) * std::min(M, L));
+
+  ASSERT_EQ(count, static_cast<decltype(count)>(expected.size()));
+  for (size_t i = 0; i < expected.size(); ++i) {
+    ASSERT_EQ(host_out[i], expected[i]) << "(at index " << i << ")";
+  }
+
+  deallocMergeTestData(working_res, work_a, host_a);
+  deallocMergeTestData(working_res, work_b, host_b);
+  deallocMergeTestData(working_res, work_out, host_out);
+}
+
+//
+// Intersect the multiples of 2 and of 3 below N and iterate over the result
+// as a ListSegment.
+//
+template <typename EXEC_POLICY, typename WORKING_RES>
+void MergeSetIntersectionIndexTestImpl(int N)
+{
+  camp::resources::Resource working_res{WORKING_RES()};
+
+  const int M = (N + 1) / 2;
+  const int L = (N + 2) / 3;
+
+  RAJA::Index_type* work_a;
+  RAJA::Index_type* host_a;
+  RAJA::Index_type* work_b;
+  RAJA::Index_type* host_b;
+  RAJA::Index_type* work_list;
+  RAJA::Index_type* host_list;
+  int* work_mark;
+  int* host_mark;
+
+  allocMergeTestData(M, working_res, &work_a, &host_a);
+  allocMergeTestData(L, working_res, &work_b, &host_b);
+  allocMergeTestData(L, working_res, &work_list, &host_list);
+  allocMergeTestData(N, working_res, &work_mark, &host_mark);
+
+  for (int i = 0; i < M; ++i) {
+    host_a[i] = 2 * i;
+  }
+  for (int i = 0; i < L; ++i) {
+    host_b[i] = 3 * i;
+  }
+  std::fill(host_mark, host_mark + N, 0);
+
+  working_res.memcpy(work_a, host_a, sizeof(RAJA::Index_type) * M);
+  working_res.memcpy(work_b, host_b, sizeof(RAJA::Index_type) * L);
+  working_res.memcpy(work_mark, host_mark, sizeof(int) * N);
+
+  const auto count = RAJA::set_intersection<EXEC_POLICY>(
+      work_a, work_a + M, work_b, work_b + L, work_list);
+
+  RAJA::TypedListSegment<RAJA::Index_type> list(
+      work_list, count, working_res, RAJA::Unowned);
+  RAJA::forall<EXEC_POLICY>(list, [=](RAJA::Index_type i) {
+    work_mark[i] += 1;
+  });
+
+  working_res.memcpy(host_mark, work_mark, sizeof(int) * N);
+
+  ASSERT_EQ(count, static_cast<decltype(count)>((N + 5) / 6));
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(host_mark[i], i % 6 == 0 ? 1 : 0) << "(at index " << i << ")";
+  }
+
+  deallocMergeTestData(working_res, work_a, host_a);
+  deallocMergeTestData(working_res, work_b, host_b);
+  deallocMergeTestData(working_res, work_list, host_list);
+  deallocMergeTestData(working_res, work_mark, host_mark);
+}
+
+TYPED_TEST_SUITE_P(MergeSetIntersectionTest);
+template <typename T>
+class MergeSetIntersectionTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(MergeSetIntersectionTest, MergeSetIntersection)
+{
+  using EXEC_POLICY      = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RESOURCE = typename camp::at<TypeParam, camp::num<1>>::type;
+  using DATA_TYPE        = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  for (auto const& sizes : MergeTestSizes) {
+    for (int max_value : MergeTestMaxValues) {
+      MergeSetIntersectionTestImpl<EXEC_POLICY, WORKING_RESOURCE, DATA_TYPE>(
+          sizes[0], sizes[1], max_value);
+    }
+    MergeSetIntersectionIndexTestImpl<EXEC_POLICY, WORKING_RESOURCE>(
+        sizes[0] + sizes[1]);
+  }
+}
+
+REGISTER_TYPED_TEST_SUITE_P(MergeSetIntersectionTest,
+                            MergeSetIntersection);
+
+#endif // __TEST_MERGE_SET_INTERSECTION_HPP__
@@ -0,0 +1,74 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_MERGE_DATA_HPP__
+#define __TEST_MERGE_DATA_HPP__
+
+#include <algorithm>
+#include <random>
+
+//
+// Sizes of the two sorted inputs used by the merge tests; the largest are
+// split into several blocks by the parallel back-ends, including cases
+// where one input is much longer than the other.
+//
+const int MergeTestSizes[][2] = {{0, 0},
+                                 {0, 5},
+                                 {1, 0},
+                                 {17, 2},
+                                 {1000, 1000},
+                                 {70001, 13},
+                                 {50000, 90001}};
+
+//
+// Largest values used by the merge tests; the small one gives long runs of
+// equal values in both inputs.
+//
+const int MergeTestMaxValues[] = {3, 1000000};
+
+//
+// Methods to allocate/deallocate/initialize merge test data.
+//
+
+template <typename T>
+void allocMergeTestData(int N,
+                        camp::resources::Resource& work_res,
+                        T** work_data,
+                        T** host_data)
+{
+  camp::resources::Resource host_res{camp::resources::Host()};
+
+  *work_data = work_res.allocate<T>(N);
+  *host_data = host_res.allocate<T>(N);
+}
+
+template <typename T>
+void deallocMergeTestData(camp::resources::Resource& work_res,
+                          T* work_data,
+                          T* host_data)
+{
+  camp::resources::Resource host_res{camp::resources::Host()};
+
+  work_res.deallocate(work_data);
+  host_res.deallocate(host_data);
+}
+
+//
+// Fill data with N sorted values in [0, max_value].
+//
+template <typename T>
+void initMergeTestData(T* data, int N, int max_value, unsigned seed)
+{
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> dist(0, max_value);
+  for (int i = 0; i < N; ++i) {
+    data[i] = static_cast<T>(dist(gen));
+  }
+  std::sort(data, data + N);
+}
+
+#endif // __TEST_MERGE_DATA_HPP__
@@ -0,0 +1,215 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_REDUCE_VIEW_HPP__
+#define __TEST_REDUCE_VIEW_HPP__
+
+#include <cstdlib>
+
+//
+// Reduce a 3D View with the given input layout along dim, and check the
+// result against a sequential reference built with View indexing.
+//
+template <typename EXEC_POLICY,
+          typename OP_TYPE,
+          typename InLayout,
+          typename OutLayout>
+void ReduceViewTestImpl(camp::resources::Resource& working_res,
+                        InLayout in_layout,
+                        OutLayout out_layout,
+                        std::array<RAJA::Index_type, 3> lower,
+                        std::array<RAJA::Index_type, 3> sizes,
+                        int dim)
+{
+  using T = typename OP_TYPE::result_type;
+
+  const RAJA::Index_type N = sizes[0] * sizes[1] * sizes[2];
+  const RAJA::Index_type M = N / sizes[dim];
+
+  T* in_array  = working_res.allocate<T>(N);
+  T* out_array = working_res.allocate<T>(M);
+  T* ref_array = working_res.allocate<T>(M);
+
+  RAJA::View<T, InLayout> in(in_array, in_layout);
+  RAJA::View<T, OutLayout> out(out_array, out_layout);
+  RAJA::View<T, OutLayout> ref(ref_array, out_layout);
+
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    in_array[i] = static_cast<T>( rand() % 100 );
+  }
+
+  for (RAJA::Index_type i = 0; i < M; ++i) {
+    ref_array[i] = OP_TYPE::identity();
+    out_array[i] = static_cast<T>( -1 );
+  }
+
+  for (RAJA::Index_type i = lower[0]; i < lower[0] + sizes[0]; ++i) {
+    for (RAJA::Index_type j = lower[1]; j < lower[1] + sizes[1]; ++j) {
+      for (RAJA::Index_type k = lower[2]; k < lower[2] + sizes[2]; ++k) {
+        T& r = (dim == 0) ? ref(j, k) : ((dim == 1) ? ref(i, k) : ref(i, j));
+        r = OP_TYPE{}(r, in(i, j, k));
+      }
+    }
+  }
+
+  RAJA::reduce_view<EXEC_POLICY, OP_TYPE>(in, out, dim);
+
+  for (RAJA::Index_type i = 0; i < M; ++i) {
+    ASSERT_EQ(out_array[i], ref_array[i]);
+  }
+
+  working_res.deallocate(in_array);
+  working_res.deallocate(out_array);
+  working_res.deallocate(ref_array);
+}
+
+//
+// Reduce a 3D View over two dimensions, which leaves few enough outputs
+// that the input is split across threads.
+//
+template <typename EXEC_POLICY, typename OP_TYPE>
+void ReduceViewSlabTestImpl(camp::resources::Resource& working_res,
+                            RAJA::Index_type ni,
+                            RAJA::Index_type nj,
+                            RAJA::Index_type nk)
+{
+  using T = typename OP_TYPE::result_type;
+
+  T* in_array  = working_res.allocate<T>(ni * nj * nk);
+  T* out_array = working_res.allocate<T>(nj);
+
+  RAJA::View<T, RAJA::Layout<3>> in(in_array, ni, nj, nk);
+  RAJA::View<T, RAJA::Layout<1>> out(out_array, nj);
+
+  for (RAJA::Index_type i = 0; i < ni * nj * nk; ++i) {
+    in_array[i] = static_cast<T>( rand() % 100 );
+  }
+
+  RAJA::reduce_view<EXEC_POLICY, OP_TYPE>(in, out, 0, 2);
+
+  for (RAJA::Index_type j = 0; j < nj; ++j) {
+    T ref = OP_TYPE::identity();
+    for (RAJA::Index_type i = 0; i < ni; ++i) {
+      for (RAJA::Index_type k = 0; k < nk; ++k) {
+        ref = OP_TYPE{}(ref, in(i, j, k));
+      }
+    }
+    ASSERT_EQ(out(j), ref);
+  }
+
+  working_res.deallocate(in_array);
+  working_res.deallocate(out_array);
+}
+
+
+TYPED_TEST_SUITE_P(ReduceViewTest);
+template <typename T>
+class ReduceViewTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(ReduceViewTest, ReduceViewDims)
+{
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+  using OP_TYPE     = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  camp::resources::Resource working_res{WORKING_RES()};
+
+  const std::array<RAJA::Index_type, 3> zero{{0, 0, 0}};
+  const std::array<RAJA::Index_type, 3> sizes{{13, 7, 301}};
+
+  for (int dim = 0; dim < 3; ++dim) {
+    std::array<RAJA::Index_type, 2> out_sizes;
+    for (int d = 0, o = 0; d < 3; ++d) {
+      if (d != dim) out_sizes[o++] = sizes[d];
+    }
+
+    ReduceViewTestImpl<EXEC_POLICY, OP_TYPE>(
+        working_res,
+        RAJA::Layout<3>(sizes[0], sizes[1], sizes[2]),
+        RAJA::Layout<2>(out_sizes[0], out_sizes[1]),
+        zero, sizes, dim);
+  }
+}
+
+TYPED_TEST_P(ReduceViewTest, ReduceViewPermuted)
+{
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+  using OP_TYPE     = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  camp::resources::Resource working_res{WORKING_RES()};
+
+  const std::array<RAJA::Index_type, 3> zero{{0, 0, 0}};
+  const std::array<RAJA::Index_type, 3> sizes{{257, 9, 31}};
+
+  for (int dim = 0; dim < 3; ++dim) {
+    std::array<RAJA::Index_type, 2> out_sizes;
+    for (int d = 0, o = 0; d < 3; ++d) {
+      if (d != dim) out_sizes[o++] = sizes[d];
+    }
+
+    ReduceViewTestImpl<EXEC_POLICY, OP_TYPE>(
+        working_res,
+        RAJA::make_permuted_layout(sizes, RAJA::as_array<RAJA::Perm<2, 0, 1>>::get()),
+        RAJA::make_permuted_layout(out_sizes, RAJA::as_array<RAJA::Perm<1, 0>>::get()),
+        zero, sizes, dim);
+  }
+}
+
+TYPED_TEST_P(ReduceViewTest, ReduceViewOffset)
+{
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+  using OP_TYPE     = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  camp::resources::Resource working_res{WORKING_RES()};
+
+  const std::array<RAJA::Index_type, 3> lower{{-2, 5, 1}};
+  const std::array<RAJA::Index_type, 3> sizes{{6, 143, 20}};
+
+  for (int dim = 0; dim < 3; ++dim) {
+    std::array<RAJA::Index_type, 2> out_lower, out_upper;
+    for (int d = 0, o = 0; d < 3; ++d) {
+      if (d != dim) {
+        out_lower[o] = lower[d];
+        out_upper[o] = lower[d] + sizes[d] - 1;
+        ++o;
+      }
+    }
+
+    ReduceViewTestImpl<EXEC_POLICY, OP_TYPE>(
+        working_res,
+        RAJA::make_offset_layout<3>(lower,
+                                    {{lower[0] + sizes[0] - 1,
+                                      lower[1] + sizes[1] - 1,
+                                      lower[2] + sizes[2] - 1}}),
+        RAJA::make_offset_layout<2>(out_lower, out_upper),
+        lower, sizes, dim);
+  }
+}
+
+TYPED_TEST_P(ReduceViewTest, ReduceViewSlab)
+{
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+  using OP_TYPE     = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  camp::resources::Resource working_res{WORKING_RES()};
+
+  ReduceViewSlabTestImpl<EXEC_POLICY, OP_TYPE>(working_res, 3, 4, 5);
+  ReduceViewSlabTestImpl<EXEC_POLICY, OP_TYPE>(working_res, 61, 5, 173);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ReduceViewTest,
+                            ReduceViewDims,
+                            ReduceViewPermuted,
+                            ReduceViewOffset,
+                            ReduceViewSlab);
+
+#endif  // __TEST_REDUCE_VIEW_HPP__
@@ -0,0 +1,111 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_SCATTER_ADD_HPP__
+#define __TEST_SCATTER_ADD_HPP__
+
+#include <random>
+#include <vector>
+
+//
+// Number of scattered values and target sizes; small targets make most
+// indices repeat, the largest inputs are split across threads.
+//
+const int ScatterTestSizes[] = {0, 1, 17, 1000, 300007};
+const int ScatterTestTargets[] = {1, 13, 100000};
+
+template <typename EXEC_POLICY, typename WORKING_RES, typename T>
+void ScatterAddTestImpl(int N, int M)
+{
+  camp::resources::Resource working_res{WORKING_RES()};
+  camp::resources::Resource host_res{camp::resources::Host()};
+
+  int* work_idx = working_res.allocate<int>(N);
+  T* work_vals = working_res.allocate<T>(N);
+  T* work_target = working_res.allocate<T>(M);
+  int* host_idx = host_res.allocate<int>(N);
+  T* host_vals = host_res.allocate<T>(N);
+  T* host_target = host_res.allocate<T>(M);
+  T* check_target = host_res.allocate<T>(M);
+
+  std::mt19937 gen(N + M);
+  std::uniform_int_distribution<int> idx_dist(0, M - 1);
+  std::uniform_int_distribution<int> val_dist(0, 100);
+  for (int i = 0; i < N; ++i) {
+    host_idx[i] = idx_dist(gen);
+    host_vals[i] = static_cast<T>(val_dist(gen));
+  }
+  for (int k = 0; k < M; ++k) {
+    host_target[k] = static_cast<T>(k % 7);
+    check_target[k] = host_target[k];
+  }
+  for (int i = 0; i < N; ++i) {
+    check_target[host_idx[i]] += host_vals[i];
+  }
+
+  working_res.memcpy(work_idx, host_idx, sizeof(int) * N);
+  working_res.memcpy(work_vals, host_vals, sizeof(T) * N);
+  working_res.memcpy(work_target, host_target, sizeof(T) * M);
+
+  RAJA::scatter_add<EXEC_POLICY>(work_target,
+                                 work_idx,
+                                 work_idx + N,
+                                 work_vals);
+
+  working_res.memcpy(host_target, work_target, sizeof(T) * M);
+
+  for (int k = 0; k < M; ++k) {
+    ASSERT_EQ(host_target[k], check_target[k]);
+  }
+
+  // indices passed as a container
+  std::vector<int> idx(host_idx, host_idx + N);
+  for (int k = 0; k < M; ++k) {
+    check_target[k] = host_target[k];
+  }
+  for (int i = 0; i < N; ++i) {
+    check_target[host_idx[i]] += host_vals[i];
+  }
+
+  RAJA::scatter_add<EXEC_POLICY>(host_target, idx, host_vals);
+
+  for (int k = 0; k < M; ++k) {
+    ASSERT_EQ(host_target[k], check_target[k]);
+  }
+
+  working_res.deallocate(work_idx);
+  working_res.deallocate(work_vals);
+  working_res.deallocate(work_target);
+  host_res.deallocate(host_idx);
+  host_res.deallocate(host_vals);
+  host_res.deallocate(host_target);
+  host_res.deallocate(check_target);
+}
+
+TYPED_TEST_SUITE_P(ScatterAddTest);
+template <typename T>
+class ScatterAddTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(ScatterAddTest, ScatterAdd)
+{
+  using EXEC_POLICY      = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RESOURCE = typename camp::at<TypeParam, camp::num<1>>::type;
+  using DATA_TYPE        = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  for (int N : ScatterTestSizes) {
+    for (int M : ScatterTestTargets) {
+      ScatterAddTestImpl<EXEC_POLICY, WORKING_RESOURCE, DATA_TYPE>(N, M);
+    }
+  }
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ScatterAddTest,
+                            ScatterAdd);
+
+#endif // __TEST_SCATTER_ADD_HPP__
@@ -0,0 +1,62 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_SEARCH_ANY_OF_HPP__
+#define __TEST_SEARCH_ANY_OF_HPP__
+
+#include <algorithm>
+#include <vector>
+
+template <typename EXEC_POLICY, typename WORKING_RES, typename T>
+void SearchAnyOfTestImpl(int N, std::vector<int> const& matches)
+{
+  camp::resources::Resource working_res{WORKING_RES()};
+
+  T* work_in;
+  T* host_in;
+
+  allocSearchTestData(N, working_res, &work_in, &host_in);
+
+  initSearchTestData(host_in, N, matches);
+
+  working_res.memcpy(work_in, host_in, sizeof(T) * N);
+
+  const bool any = RAJA::any_of<EXEC_POLICY>(
+      work_in, work_in + N, SearchTestPred<T>{});
+  ASSERT_EQ(any, !matches.empty());
+
+  const bool any_index = RAJA::any_of<EXEC_POLICY>(
+      RAJA::TypedRangeSegment<RAJA::Index_type>(0, N),
+      [=](RAJA::Index_type i) { return SearchTestPred<T>{}(work_in[i]); });
+  ASSERT_EQ(any_index, !matches.empty());
+
+  deallocSearchTestData(working_res, work_in, host_in);
+}
+
+TYPED_TEST_SUITE_P(SearchAnyOfTest);
+template <typename T>
+class SearchAnyOfTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(SearchAnyOfTest, SearchAnyOf)
+{
+  using EXEC_POLICY      = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RESOURCE = typename camp::at<TypeParam, camp::num<1>>::type;
+  using DATA_TYPE        = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  for (int N : SearchTestSizes) {
+    for (auto const& matches : searchTestMatches(N)) {
+      SearchAnyOfTestImpl<EXEC_POLICY, WORKING_RESOURCE, DATA_TYPE>(N, matches);
+    }
+  }
+}
+
+REGISTER_TYPED_TEST_SUITE_P(SearchAnyOfTest,
+                            SearchAnyOf);
+
+#endif // __TEST_SEARCH_ANY_OF_HPP__
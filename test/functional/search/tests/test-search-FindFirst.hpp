@@ -0,0 +1,68 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_SEARCH_FIND_FIRST_HPP__
+#define __TEST_SEARCH_FIND_FIRST_HPP__
+
+#include <algorithm>
+#include <vector>
+
+template <typename EXEC_POLICY, typename WORKING_RES, typename T>
+void SearchFindFirstTestImpl(int N, std::vector<int> const& matches)
+{
+  camp::resources::Resource working_res{WORKING_RES()};
+
+  T* work_in;
+  T* host_in;
+
+  allocSearchTestData(N, working_res, &work_in, &host_in);
+
+  initSearchTestData(host_in, N, matches);
+
+  working_res.memcpy(work_in, host_in, sizeof(T) * N);
+
+  const int expected = matches.empty()
+                           ? N
+                           : *std::min_element(matches.begin(), matches.end());
+
+  const auto pos = RAJA::find_first<EXEC_POLICY>(
+      work_in, work_in + N, SearchTestPred<T>{});
+  ASSERT_EQ(pos, static_cast<decltype(pos)>(expected));
+
+  // search the indices of a range segment
+  const auto index = RAJA::find_first<EXEC_POLICY>(
+      RAJA::TypedRangeSegment<RAJA::Index_type>(0, N),
+      [=](RAJA::Index_type i) { return SearchTestPred<T>{}(work_in[i]); });
+  ASSERT_EQ(index, static_cast<decltype(index)>(expected));
+
+  deallocSearchTestData(working_res, work_in, host_in);
+}
+
+TYPED_TEST_SUITE_P(SearchFindFirstTest);
+template <typename T>
+class SearchFindFirstTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(SearchFindFirstTest, SearchFindFirst)
+{
+  using EXEC_POLICY      = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RESOURCE = typename camp::at<TypeParam, camp::num<1>>::type;
+  using DATA_TYPE        = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  for (int N : SearchTestSizes) {
+    for (auto const& matches : searchTestMatches(N)) {
+      SearchFindFirstTestImpl<EXEC_POLICY, WORKING_RESOURCE, DATA_TYPE>(
+          N, matches);
+    }
+  }
+}
+
+REGISTER_TYPED_TEST_SUITE_P(SearchFindFirstTest,
+                            SearchFindFirst);
+
+#endif // __TEST_SEARCH_FIND_FIRST_HPP__
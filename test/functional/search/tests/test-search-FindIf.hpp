@@ -0,0 +1,64 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_SEARCH_FIND_IF_HPP__
+#define __TEST_SEARCH_FIND_IF_HPP__
+
+#include <algorithm>
+#include <vector>
+
+template <typename EXEC_POLICY, typename WORKING_RES, typename T>
+void SearchFindIfTestImpl(int N, std::vector<int> const& matches)
+{
+  camp::resources::Resource working_res{WORKING_RES()};
+
+  T* work_in;
+  T* host_in;
+
+  allocSearchTestData(N, working_res, &work_in, &host_in);
+
+  initSearchTestData(host_in, N, matches);
+
+  working_res.memcpy(work_in, host_in, sizeof(T) * N);
+
+  const auto pos = RAJA::find_if<EXEC_POLICY>(
+      work_in, work_in + N, SearchTestPred<T>{});
+
+  if (matches.empty()) {
+    ASSERT_EQ(pos, static_cast<decltype(pos)>(N));
+  } else {
+    ASSERT_NE(std::find(matches.begin(), matches.end(), pos), matches.end())
+        << "(found index " << pos << ")";
+  }
+
+  deallocSearchTestData(working_res, work_in, host_in);
+}
+
+TYPED_TEST_SUITE_P(SearchFindIfTest);
+template <typename T>
+class SearchFindIfTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(SearchFindIfTest, SearchFindIf)
+{
+  using EXEC_POLICY      = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RESOURCE = typename camp::at<TypeParam, camp::num<1>>::type;
+  using DATA_TYPE        = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  for (int N : SearchTestSizes) {
+    for (auto const& matches : searchTestMatches(N)) {
+      SearchFindIfTestImpl<EXEC_POLICY, WORKING_RESOURCE, DATA_TYPE>(
+          N, matches);
+    }
+  }
+}
+
+REGISTER_TYPED_TEST_SUITE_P(SearchFindIfTest,
+                            SearchFindIf);
+
+#endif // __TEST_SEARCH_FIND_IF_HPP__
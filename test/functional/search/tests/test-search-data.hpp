@@ -0,0 +1,89 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_SEARCH_DATA_HPP__
+#define __TEST_SEARCH_DATA_HPP__
+
+#include <random>
+#include <vector>
+
+//
+// Sizes used by the search tests; the largest are split into many chunks
+// by the parallel back-ends.
+//
+const int SearchTestSizes[] = {0, 1, 2, 17, 1000, 70001, 300007};
+
+//
+// Predicate used by the search tests; holds for the zeros placed by
+// initSearchTestData and for no other value.
+//
+template <typename T>
+struct SearchTestPred {
+  bool operator()(const T& x) const { return x < static_cast<T>(1); }
+};
+
+//
+// Positions of the zeros placed in a range of length N; none, one or
+// several, including matches at both ends and in neighboring chunks.
+//
+inline std::vector<std::vector<int>> searchTestMatches(int N)
+{
+  std::vector<std::vector<int>> matches{{}};
+  if (N > 0) {
+    matches.push_back({0});
+    matches.push_back({N - 1});
+    matches.push_back({N / 2});
+    matches.push_back({N / 3, N / 2, N - 1});
+    matches.push_back({N - N / 7 - 1, N - 1});
+  }
+  return matches;
+}
+
+//
+// Methods to allocate/deallocate/initialize search test data.
+//
+
+template <typename T>
+void allocSearchTestData(int N,
+                         camp::resources::Resource& work_res,
+                         T** work_data,
+                         T** host_data)
+{
+  camp::resources::Resource host_res{camp::resources::Host()};
+
+  *work_data = work_res.allocate<T>(N);
+  *host_data = host_res.allocate<T>(N);
+}
+
+template <typename T>
+void deallocSearchTestData(camp::resources::Resource& work_res,
+                           T* work_data,
+                           T* host_data)
+{
+  camp::resources::Resource host_res{camp::resources::Host()};
+
+  work_res.deallocate(work_data);
+  host_res.deallocate(host_data);
+}
+
+//
+// Fill data with values in [1, 1000] and zeros at the given positions.
+//
+template <typename T>
+void initSearchTestData(T* data, int N, std::vector<int> const& matches)
+{
+  std::mt19937 gen(N);
+  std::uniform_int_distribution<int> dist(1, 1000);
+  for (int i = 0; i < N; ++i) {
+    data[i] = static_cast<T>(dist(gen));
+  }
+  for (int i : matches) {
+    data[i] = static_cast<T>(0);
+  }
+}
+
+#endif // __TEST_SEARCH_DATA_HPP__
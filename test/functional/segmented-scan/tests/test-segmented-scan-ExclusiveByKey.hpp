@@ -0,0 +1,80 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_SEGMENTED_SCAN_EXCLUSIVE_BY_KEY_HPP__
+#define __TEST_SEGMENTED_SCAN_EXCLUSIVE_BY_KEY_HPP__
+
+template <typename EXEC_POLICY, typename WORKING_RES, typename OP_TYPE>
+void SegmentedScanExclusiveByKeyTestImpl(int N, int seglen)
+{
+  using T = typename OP_TYPE::result_type;
+
+  camp::resources::Resource working_res{WORKING_RES()};
+
+  T* work_in;
+  T* host_in;
+  T* work_out;
+  T* host_out;
+  int* work_keys;
+  int* host_keys;
+  int* work_flags;
+  int* host_flags;
+  std::vector<int> offsets;
+
+  allocSegmentedScanTestData(N, working_res, &work_in, &host_in);
+  allocSegmentedScanTestData(N, working_res, &work_out, &host_out);
+  allocSegmentedScanTestData(N, working_res, &work_keys, &host_keys);
+  allocSegmentedScanTestData(N, working_res, &work_flags, &host_flags);
+
+  initSegmentedScanTestData(N, seglen, host_in, host_keys, host_flags, offsets);
+
+  working_res.memcpy(work_in, host_in, sizeof(T) * N);
+  working_res.memcpy(work_keys, host_keys, sizeof(int) * N);
+
+  RAJA::exclusive_scan_by_key<EXEC_POLICY>(work_keys,
+                                           work_keys + N,
+                                           work_in,
+                                           work_out,
+                                           OP_TYPE{},
+                                           T(3));
+
+  working_res.memcpy(host_out, work_out, sizeof(T) * N);
+
+  ASSERT_TRUE(check_segmented<false, OP_TYPE>(
+      host_out, host_in, host_keys, T(3), N));
+
+  deallocSegmentedScanTestData(working_res, work_in, host_in);
+  deallocSegmentedScanTestData(working_res, work_out, host_out);
+  deallocSegmentedScanTestData(working_res, work_keys, host_keys);
+  deallocSegmentedScanTestData(working_res, work_flags, host_flags);
+}
+
+TYPED_TEST_SUITE_P(SegmentedScanExclusiveByKeyTest);
+template <typename T>
+class SegmentedScanExclusiveByKeyTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(SegmentedScanExclusiveByKeyTest, SegmentedScanExclusiveByKey)
+{
+  using EXEC_POLICY      = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RESOURCE = typename camp::at<TypeParam, camp::num<1>>::type;
+  using OP_TYPE          = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  for (int N : SegmentedScanTestSizes) {
+    for (int seglen : SegmentedScanTestSegLens) {
+      SegmentedScanExclusiveByKeyTestImpl<EXEC_POLICY,
+                                          WORKING_RESOURCE,
+                                          OP_TYPE>(N, seglen);
+    }
+  }
+}
+
+REGISTER_TYPED_TEST_SUITE_P(SegmentedScanExclusiveByKeyTest,
+                            SegmentedScanExclusiveByKey);
+
+#endif // __TEST_SEGMENTED_SCAN_EXCLUSIVE_BY_KEY_HPP__
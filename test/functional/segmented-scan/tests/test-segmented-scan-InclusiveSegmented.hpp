@@ -0,0 +1,104 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_SEGMENTED_SCAN_INCLUSIVE_SEGMENTED_HPP__
+#define __TEST_SEGMENTED_SCAN_INCLUSIVE_SEGMENTED_HPP__
+
+template <typename EXEC_POLICY, typename WORKING_RES, typename OP_TYPE>
+void SegmentedScanInclusiveSegmentedTestImpl(int N, int seglen)
+{
+  using T = typename OP_TYPE::result_type;
+
+  camp::resources::Resource working_res{WORKING_RES()};
+
+  T* work_in;
+  T* host_in;
+  T* work_out;
+  T* host_out;
+  int* work_keys;
+  int* host_keys;
+  int* work_flags;
+  int* host_flags;
+  int* work_offsets;
+  int* host_offsets;
+  std::vector<int> offsets;
+
+  allocSegmentedScanTestData(N, working_res, &work_in, &host_in);
+  allocSegmentedScanTestData(N, working_res, &work_out, &host_out);
+  allocSegmentedScanTestData(N, working_res, &work_keys, &host_keys);
+  allocSegmentedScanTestData(N, working_res, &work_flags, &host_flags);
+
+  initSegmentedScanTestData(N, seglen, host_in, host_keys, host_flags, offsets);
+
+  const int M = static_cast<int>(offsets.size());
+  allocSegmentedScanTestData(M, working_res, &work_offsets, &host_offsets);
+  std::copy(offsets.begin(), offsets.end(), host_offsets);
+
+  working_res.memcpy(work_in, host_in, sizeof(T) * N);
+  working_res.memcpy(work_flags, host_flags, sizeof(int) * N);
+  working_res.memcpy(work_offsets, host_offsets, sizeof(int) * M);
+
+  // segments given by head flags
+  RAJA::inclusive_segmented_scan<EXEC_POLICY>(work_in,
+                                              work_in + N,
+                                              work_flags,
+                                              work_out,
+                                              OP_TYPE{});
+
+  working_res.memcpy(host_out, work_out, sizeof(T) * N);
+
+  ASSERT_TRUE(check_segmented<true, OP_TYPE>(
+      host_out, host_in, host_keys, OP_TYPE::identity(), N));
+
+  // segments given by offsets, scanned in place
+  working_res.memcpy(work_out, host_in, sizeof(T) * N);
+
+  RAJA::inclusive_segmented_scan_by_offsets<EXEC_POLICY>(work_out,
+                                                         work_out + N,
+                                                         work_offsets,
+                                                         work_offsets + M,
+                                                         work_out,
+                                                         OP_TYPE{});
+
+  working_res.memcpy(host_out, work_out, sizeof(T) * N);
+
+  ASSERT_TRUE(check_segmented<true, OP_TYPE>(
+      host_out, host_in, host_keys, OP_TYPE::identity(), N));
+
+  deallocSegmentedScanTestData(working_res, work_in, host_in);
+  deallocSegmentedScanTestData(working_res, work_out, host_out);
+  deallocSegmentedScanTestData(working_res, work_keys, host_keys);
+  deallocSegmentedScanTestData(working_res, work_flags, host_flags);
+  deallocSegmentedScanTestData(working_res, work_offsets, host_offsets);
+}
+
+TYPED_TEST_SUITE_P(SegmentedScanInclusiveSegmentedTest);
+template <typename T>
+class SegmentedScanInclusiveSegmentedTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(SegmentedScanInclusiveSegmentedTest,
+             SegmentedScanInclusiveSegmented)
+{
+  using EXEC_POLICY      = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RESOURCE = typename camp::at<TypeParam, camp::num<1>>::type;
+  using OP_TYPE          = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  for (int N : SegmentedScanTestSizes) {
+    for (int seglen : SegmentedScanTestSegLens) {
+      SegmentedScanInclusiveSegmentedTestImpl<EXEC_POLICY,
+                                              WORKING_RESOURCE,
+                                              OP_TYPE>(N, seglen);
+    }
+  }
+}
+
+REGISTER_TYPED_TEST_SUITE_P(SegmentedScanInclusiveSegmentedTest,
+                            SegmentedScanInclusiveSegmented);
+
+#endif // __TEST_SEGMENTED_SCAN_INCLUSIVE_SEGMENTED_HPP__
@@ -0,0 +1,97 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_SEGMENTED_SCAN_RUN_LENGTH_ENCODE_HPP__
+#define __TEST_SEGMENTED_SCAN_RUN_LENGTH_ENCODE_HPP__
+
+//
+// The runs are the segments of the test keys; the operator type only
+// selects the type of the encoded values.
+//
+template <typename EXEC_POLICY, typename WORKING_RES, typename OP_TYPE>
+void SegmentedScanRunLengthEncodeTestImpl(int N, int seglen)
+{
+  using T = typename OP_TYPE::result_type;
+
+  camp::resources::Resource working_res{WORKING_RES()};
+
+  T* work_in;
+  T* host_in;
+  T* work_unique;
+  T* host_unique;
+  int* work_counts;
+  int* host_counts;
+  int* work_keys;
+  int* host_keys;
+  int* work_flags;
+  int* host_flags;
+  std::vector<int> offsets;
+
+  allocSegmentedScanTestData(N, working_res, &work_in, &host_in);
+  allocSegmentedScanTestData(N, working_res, &work_unique, &host_unique);
+  allocSegmentedScanTestData(N, working_res, &work_counts, &host_counts);
+  allocSegmentedScanTestData(N, working_res, &work_keys, &host_keys);
+  allocSegmentedScanTestData(N, working_res, &work_flags, &host_flags);
+
+  initSegmentedScanTestData(N, seglen, host_in, host_keys, host_flags, offsets);
+
+  std::vector<int> ones(N, 1);
+  std::vector<int> unique_keys(N);
+  for (int i = 0; i < N; ++i) {
+    host_in[i] = static_cast<T>(host_keys[i]);
+  }
+
+  working_res.memcpy(work_in, host_in, sizeof(T) * N);
+
+  const int count = static_cast<int>(
+      RAJA::run_length_encode<EXEC_POLICY>(work_in,
+                                           work_in + N,
+                                           work_unique,
+                                           work_counts));
+
+  working_res.memcpy(host_unique, work_unique, sizeof(T) * N);
+  working_res.memcpy(host_counts, work_counts, sizeof(int) * N);
+
+  for (int s = 0; s < count && s < N; ++s) {
+    unique_keys[s] = static_cast<int>(host_unique[s]);
+  }
+
+  ASSERT_TRUE(check_reduce_by_key<RAJA::operators::plus<int>>(
+      count, unique_keys.data(), host_counts, ones.data(), host_keys, N));
+
+  deallocSegmentedScanTestData(working_res, work_in, host_in);
+  deallocSegmentedScanTestData(working_res, work_unique, host_unique);
+  deallocSegmentedScanTestData(working_res, work_counts, host_counts);
+  deallocSegmentedScanTestData(working_res, work_keys, host_keys);
+  deallocSegmentedScanTestData(working_res, work_flags, host_flags);
+}
+
+TYPED_TEST_SUITE_P(SegmentedScanRunLengthEncodeTest);
+template <typename T>
+class SegmentedScanRunLengthEncodeTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(SegmentedScanRunLengthEncodeTest, SegmentedScanRunLengthEncode)
+{
+  using EXEC_POLICY      = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RESOURCE = typename camp::at<TypeParam, camp::num<1>>::type;
+  using OP_TYPE          = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  for (int N : SegmentedScanTestSizes) {
+    for (int seglen : SegmentedScanTestSegLens) {
+      SegmentedScanRunLengthEncodeTestImpl<EXEC_POLICY,
+                                           WORKING_RESOURCE,
+                                           OP_TYPE>(N, seglen);
+    }
+  }
+}
+
+REGISTER_TYPED_TEST_SUITE_P(SegmentedScanRunLengthEncodeTest,
+                            SegmentedScanRunLengthEncode);
+
+#endif // __TEST_SEGMENTED_SCAN_RUN_LENGTH_ENCODE_HPP__
@@ -0,0 +1,151 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_SEGMENTED_SCAN_DATA_HPP__
+#define __TEST_SEGMENTED_SCAN_DATA_HPP__
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+//
+// Problem sizes and mean segment lengths used by the segmented scan tests;
+// long segments span the blocks of the parallel back-ends.
+//
+const int SegmentedScanTestSizes[] = {0, 1, 357, 32000};
+const int SegmentedScanTestSegLens[] = {1, 7, 5000, 100000};
+
+//
+// Methods to allocate/deallocate segmented scan test data.
+//
+
+template <typename T>
+void allocSegmentedScanTestData(int N,
+                                camp::resources::Resource& work_res,
+                                T** work_data,
+                                T** host_data)
+{
+  camp::resources::Resource host_res{camp::resources::Host()};
+
+  *work_data = work_res.allocate<T>(N);
+  *host_data = host_res.allocate<T>(N);
+}
+
+template <typename T>
+void deallocSegmentedScanTestData(camp::resources::Resource& work_res,
+                                  T* work_data,
+                                  T* host_data)
+{
+  camp::resources::Resource host_res{camp::resources::Host()};
+
+  work_res.deallocate(work_data);
+  host_res.deallocate(host_data);
+}
+
+//
+// Fill values and segment keys; a new segment starts with probability
+// 1/seglen. Flags are nonzero at segment heads, and offsets hold the head
+// indices with some repeated to describe empty segments.
+//
+template <typename T>
+void initSegmentedScanTestData(int N,
+                               int seglen,
+                               T* vals,
+                               int* keys,
+                               int* flags,
+                               std::vector<int>& offsets)
+{
+  std::mt19937 gen(N + seglen);
+  std::uniform_int_distribution<int> val_dist(1, 9);
+  std::uniform_int_distribution<int> seg_dist(0, seglen - 1);
+  offsets.clear();
+  int key = 0;
+  for (int i = 0; i < N; ++i) {
+    const bool head = (i > 0 && seg_dist(gen) == 0);
+    if (head) {
+      ++key;
+      offsets.push_back(i);
+      if (key % 3 == 0) {
+        offsets.push_back(i);
+      }
+    }
+    vals[i] = static_cast<T>(val_dist(gen));
+    keys[i] = key;
+    flags[i] = head ? 1 : 0;
+  }
+}
+
+//
+// Check a segmented scan of in with segments given by keys.
+//
+template <bool Inclusive, typename OP>
+::testing::AssertionResult check_segmented(
+    const typename OP::result_type* actual,
+    const typename OP::result_type* in,
+    const int* keys,
+    typename OP::result_type init,
+    int N)
+{
+  typename OP::result_type agg = init;
+  for (int i = 0; i < N; ++i) {
+    if (i == 0 || keys[i] != keys[i - 1]) {
+      agg = init;
+    }
+    typename OP::result_type expected = agg;
+    agg = OP()(agg, in[i]);
+    if (Inclusive) {
+      expected = agg;
+    }
+    if (actual[i] != expected) {
+      return ::testing::AssertionFailure()
+             << actual[i] << " != " << expected << " (at index " << i << ")";
+    }
+  }
+  return ::testing::AssertionSuccess();
+}
+
+//
+// Check a reduction of in by the segments given by keys; keys_out and
+// vals_out hold the first key and the reduction of each of the count
+// segments.
+//
+template <typename OP>
+::testing::AssertionResult check_reduce_by_key(
+    int count,
+    const int* keys_out,
+    const typename OP::result_type* vals_out,
+    const typename OP::result_type* in,
+    const int* keys,
+    int N)
+{
+  int s = -1;
+  typename OP::result_type agg = OP::identity();
+  for (int i = 0; i <= N; ++i) {
+    if (i == N || i == 0 || keys[i] != keys[i - 1]) {
+      if (s >= 0 && (s >= count || vals_out[s] != agg)) {
+        return ::testing::AssertionFailure()
+               << "wrong reduction of segment " << s;
+      }
+      if (i == N) {
+        break;
+      }
+      ++s;
+      if (s >= count || keys_out[s] != keys[i]) {
+        return ::testing::AssertionFailure() << "wrong key of segment " << s;
+      }
+      agg = OP::identity();
+    }
+    agg = OP()(agg, in[i]);
+  }
+  if (count != s + 1) {
+    return ::testing::AssertionFailure()
+           << count << " != " << s + 1 << " segments";
+  }
+  return ::testing::AssertionSuccess();
+}
+
+#endif // __TEST_SEGMENTED_SCAN_DATA_HPP__
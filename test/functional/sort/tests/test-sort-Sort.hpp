@@ -0,0 +1,69 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_SORT_SORT_HPP__
+#define __TEST_SORT_SORT_HPP__
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+template <typename EXEC_POLICY, typename WORKING_RES, typename COMPARE>
+void SortSortTestImpl(int N)
+{
+  using T = typename COMPARE::first_argument_type;
+
+  camp::resources::Resource working_res{WORKING_RES()};
+
+  T* work_keys;
+  T* host_keys;
+
+  allocSortTestData(N, working_res, &work_keys, &host_keys);
+
+  initSortTestKeys(host_keys, N);
+  std::vector<T> expected(host_keys, host_keys + N);
+  std::stable_sort(expected.begin(), expected.end(), COMPARE{});
+
+  working_res.memcpy(work_keys, host_keys, sizeof(T) * N);
+
+  RAJA::sort<EXEC_POLICY>(work_keys, work_keys + N, COMPARE{});
+
+  working_res.memcpy(host_keys, work_keys, sizeof(T) * N);
+
+  // sorted, and the same keys as a stable sort up to the order of keys
+  // that compare equal
+  ASSERT_TRUE(std::is_sorted(host_keys, host_keys + N, COMPARE{}));
+  std::sort(host_keys, host_keys + N);
+  std::sort(expected.begin(), expected.end());
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(host_keys[i], expected[i]) << "at index " << i;
+  }
+
+  deallocSortTestData(working_res, work_keys, host_keys);
+}
+
+TYPED_TEST_SUITE_P(SortSortTest);
+template <typename T>
+class SortSortTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(SortSortTest, SortSort)
+{
+  using EXEC_POLICY      = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RESOURCE = typename camp::at<TypeParam, camp::num<1>>::type;
+  using COMPARE          = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  for (int N : SortTestSizes) {
+    SortSortTestImpl<EXEC_POLICY, WORKING_RESOURCE, COMPARE>(N);
+  }
+}
+
+REGISTER_TYPED_TEST_SUITE_P(SortSortTest,
+                            SortSort);
+
+#endif // __TEST_SORT_SORT_HPP__
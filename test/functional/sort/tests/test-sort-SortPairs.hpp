@@ -0,0 +1,77 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_SORT_SORT_PAIRS_HPP__
+#define __TEST_SORT_SORT_PAIRS_HPP__
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+template <typename EXEC_POLICY, typename WORKING_RES, typename COMPARE>
+void SortSortPairsTestImpl(int N)
+{
+  using T = typename COMPARE::first_argument_type;
+
+  camp::resources::Resource working_res{WORKING_RES()};
+
+  T* work_keys;
+  T* host_keys;
+  int* work_vals;
+  int* host_vals;
+
+  allocSortTestData(N, working_res, &work_keys, &host_keys);
+  allocSortTestData(N, working_res, &work_vals, &host_vals);
+
+  initSortTestKeys(host_keys, N);
+  std::vector<T> original(host_keys, host_keys + N);
+  std::iota(host_vals, host_vals + N, 0);
+
+  working_res.memcpy(work_keys, host_keys, sizeof(T) * N);
+  working_res.memcpy(work_vals, host_vals, sizeof(int) * N);
+
+  RAJA::sort_pairs<EXEC_POLICY>(work_keys, work_keys + N, work_vals, COMPARE{});
+
+  working_res.memcpy(host_keys, work_keys, sizeof(T) * N);
+  working_res.memcpy(host_vals, work_vals, sizeof(int) * N);
+
+  // sorted, and every value still travels with its key
+  ASSERT_TRUE(std::is_sorted(host_keys, host_keys + N, COMPARE{}));
+  std::vector<bool> seen(N, false);
+  for (int i = 0; i < N; ++i) {
+    ASSERT_TRUE(host_vals[i] >= 0 && host_vals[i] < N && !seen[host_vals[i]])
+        << "bad value " << host_vals[i] << " (at index " << i << ")";
+    seen[host_vals[i]] = true;
+    ASSERT_TRUE(sortSameBits(host_keys[i], original[host_vals[i]]))
+        << "at index " << i;
+  }
+
+  deallocSortTestData(working_res, work_keys, host_keys);
+  deallocSortTestData(working_res, work_vals, host_vals);
+}
+
+TYPED_TEST_SUITE_P(SortSortPairsTest);
+template <typename T>
+class SortSortPairsTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(SortSortPairsTest, SortSortPairs)
+{
+  using EXEC_POLICY      = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RESOURCE = typename camp::at<TypeParam, camp::num<1>>::type;
+  using COMPARE          = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  for (int N : SortTestSizes) {
+    SortSortPairsTestImpl<EXEC_POLICY, WORKING_RESOURCE, COMPARE>(N);
+  }
+}
+
+REGISTER_TYPED_TEST_SUITE_P(SortSortPairsTest,
+                            SortSortPairs);
+
+#endif // __TEST_SORT_SORT_PAIRS_HPP__
@@ -0,0 +1,79 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_SORT_STABLE_SORT_PAIRS_HPP__
+#define __TEST_SORT_STABLE_SORT_PAIRS_HPP__
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+template <typename EXEC_POLICY, typename WORKING_RES, typename COMPARE>
+void SortStableSortPairsTestImpl(int N)
+{
+  using T = typename COMPARE::first_argument_type;
+
+  camp::resources::Resource working_res{WORKING_RES()};
+
+  T* work_keys;
+  T* host_keys;
+  int* work_vals;
+  int* host_vals;
+
+  allocSortTestData(N, working_res, &work_keys, &host_keys);
+  allocSortTestData(N, working_res, &work_vals, &host_vals);
+
+  initSortTestKeys(host_keys, N);
+  std::vector<T> original(host_keys, host_keys + N);
+  std::iota(host_vals, host_vals + N, 0);
+
+  working_res.memcpy(work_keys, host_keys, sizeof(T) * N);
+  working_res.memcpy(work_vals, host_vals, sizeof(int) * N);
+
+  RAJA::stable_sort_pairs<EXEC_POLICY>(RAJA::make_span(work_keys, N),
+                                       RAJA::make_span(work_vals, N),
+                                       COMPARE{});
+
+  working_res.memcpy(host_keys, work_keys, sizeof(T) * N);
+  working_res.memcpy(host_vals, work_vals, sizeof(int) * N);
+
+  std::vector<int> expected(N);
+  std::iota(expected.begin(), expected.end(), 0);
+  std::stable_sort(expected.begin(), expected.end(), [&](int a, int b) {
+    return COMPARE{}(original[a], original[b]);
+  });
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(host_vals[i], expected[i]) << "at index " << i;
+    ASSERT_TRUE(sortSameBits(host_keys[i], original[expected[i]]))
+        << "at index " << i;
+  }
+
+  deallocSortTestData(working_res, work_keys, host_keys);
+  deallocSortTestData(working_res, work_vals, host_vals);
+}
+
+TYPED_TEST_SUITE_P(SortStableSortPairsTest);
+template <typename T>
+class SortStableSortPairsTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(SortStableSortPairsTest, SortStableSortPairs)
+{
+  using EXEC_POLICY      = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RESOURCE = typename camp::at<TypeParam, camp::num<1>>::type;
+  using COMPARE          = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  for (int N : SortTestSizes) {
+    SortStableSortPairsTestImpl<EXEC_POLICY, WORKING_RESOURCE, COMPARE>(N);
+  }
+}
+
+REGISTER_TYPED_TEST_SUITE_P(SortStableSortPairsTest,
+                            SortStableSortPairs);
+
+#endif // __TEST_SORT_STABLE_SORT_PAIRS_HPP__
@@ -0,0 +1,91 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_SORT_DATA_HPP__
+#define __TEST_SORT_DATA_HPP__
+
+#include <cstring>
+#include <random>
+#include <type_traits>
+
+//
+// Comparison that orders by the last decimal digit only, so many keys
+// compare equal and the relative order of equal keys is visible.
+//
+struct SortLastDigitLess
+    : RAJA::operators::detail::comparison_function<int, int> {
+  bool operator()(const int& lhs, const int& rhs) const
+  {
+    return (lhs % 10 + 10) % 10 < (rhs % 10 + 10) % 10;
+  }
+};
+
+//
+// Sizes used by the sort tests; the largest is split into several blocks
+// by the parallel back-ends.
+//
+const int SortTestSizes[] = {0, 1, 2, 17, 1000, 70001};
+
+//
+// Methods to allocate/deallocate/initialize sort test data.
+//
+
+template <typename T>
+void allocSortTestData(int N,
+                       camp::resources::Resource& work_res,
+                       T** work_data,
+                       T** host_data)
+{
+  camp::resources::Resource host_res{camp::resources::Host()};
+
+  *work_data = work_res.allocate<T>(N);
+  *host_data = host_res.allocate<T>(N);
+}
+
+template <typename T>
+void deallocSortTestData(camp::resources::Resource& work_res,
+                         T* work_data,
+                         T* host_data)
+{
+  camp::resources::Resource host_res{camp::resources::Host()};
+
+  work_res.deallocate(work_data);
+  host_res.deallocate(host_data);
+}
+
+//
+// Fill keys with values of both signs and many duplicates; floating point
+// keys also get both signed zeros.
+//
+template <typename T>
+void initSortTestKeys(T* keys, int N)
+{
+  std::mt19937 gen(N);
+  std::uniform_int_distribution<int> dist(-N / 4 - 1, N / 4 + 1);
+  for (int i = 0; i < N; ++i) {
+    keys[i] = static_cast<T>(dist(gen));
+  }
+  if (std::is_floating_point<T>::value) {
+    for (int i = 0; i < N; i += 7) {
+      keys[i] = static_cast<T>(keys[i] / 3.0);
+    }
+    for (int i = 3; i < N; i += 11) {
+      keys[i] = (i % 2) ? static_cast<T>(-0.0) : static_cast<T>(0.0);
+    }
+  }
+}
+
+//
+// Bitwise comparison of keys, so signed zeros are told apart.
+//
+template <typename T>
+bool sortSameBits(const T& a, const T& b)
+{
+  return std::memcmp(&a, &b, sizeof(T)) == 0;
+}
+
+#endif // __TEST_SORT_DATA_HPP__
@@ -0,0 +1,82 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_TRANSFORM_SCAN_INCLUSIVE_HPP__
+#define __TEST_TRANSFORM_SCAN_INCLUSIVE_HPP__
+
+template <typename EXEC_POLICY, typename WORKING_RES, typename OP_TYPE>
+void TransformScanInclusiveTestImpl(int N)
+{
+  using T = typename OP_TYPE::result_type;
+
+  camp::resources::Resource working_res{WORKING_RES()};
+
+  T* work_in;
+  T* host_in;
+  T* work_out;
+  T* host_out;
+
+  allocTransformScanTestData(N, working_res, &work_in, &host_in);
+  allocTransformScanTestData(N, working_res, &work_out, &host_out);
+
+  //
+  // Index-space producer and consumer, no input or temporary array
+  //
+  RAJA::transform_inclusive_scan<EXEC_POLICY>(
+      RAJA::RangeSegment(0, N),
+      [=](RAJA::Index_type i) { return transformScanTestValue<T>(i); },
+      [=](RAJA::Index_type i, T v) { work_out[i] = v; },
+      OP_TYPE{});
+
+  working_res.memcpy(host_out, work_out, sizeof(T) * N);
+
+  ASSERT_TRUE(
+      check_transform_scan<true, OP_TYPE>(host_out, OP_TYPE::identity(), T(1), N));
+
+  //
+  // Transformed input scanned into an output array
+  //
+  for (int i = 0; i < N; ++i) {
+    host_in[i] = transformScanTestValue<T>(i);
+  }
+  working_res.memcpy(work_in, host_in, sizeof(T) * N);
+
+  RAJA::transform_inclusive_scan<EXEC_POLICY>(work_in,
+                                              work_in + N,
+                                              work_out,
+                                              [=](T x) { return T(2) * x; },
+                                              OP_TYPE{});
+
+  working_res.memcpy(host_out, work_out, sizeof(T) * N);
+
+  ASSERT_TRUE(
+      check_transform_scan<true, OP_TYPE>(host_out, OP_TYPE::identity(), T(2), N));
+
+  deallocTransformScanTestData(working_res, work_in, host_in);
+  deallocTransformScanTestData(working_res, work_out, host_out);
+}
+
+TYPED_TEST_SUITE_P(TransformScanInclusiveTest);
+template <typename T>
+class TransformScanInclusiveTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(TransformScanInclusiveTest, TransformScanInclusive)
+{
+  using EXEC_POLICY      = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RESOURCE = typename camp::at<TypeParam, camp::num<1>>::type;
+  using OP_TYPE          = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  for (int N : TransformScanTestSizes) {
+    TransformScanInclusiveTestImpl<EXEC_POLICY, WORKING_RESOURCE, OP_TYPE>(N);
+  }
+}
+
+REGISTER_TYPED_TEST_SUITE_P(TransformScanInclusiveTest, TransformScanInclusive);
+
+#endif // __TEST_TRANSFORM_SCAN_INCLUSIVE_HPP__
@@ -0,0 +1,80 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_TRANSFORM_SCAN_DATA_HPP__
+#define __TEST_TRANSFORM_SCAN_DATA_HPP__
+
+//
+// Problem sizes used by the transform scan tests.
+//
+const int TransformScanTestSizes[] = {0, 1, 357, 32000};
+
+//
+// Value produced for index i, standing in for a computed count such as
+// predicate(i) ? n_i : 0.
+//
+template <typename T>
+RAJA_HOST_DEVICE T transformScanTestValue(RAJA::Index_type i)
+{
+  return (i % 3 == 0) ? static_cast<T>(i % 11) : T(0);
+}
+
+//
+// Methods to allocate/deallocate transform scan test data.
+//
+
+template <typename T>
+void allocTransformScanTestData(int N,
+                                camp::resources::Resource& work_res,
+                                T** work_data,
+                                T** host_data)
+{
+  camp::resources::Resource host_res{camp::resources::Host()};
+
+  *work_data = work_res.allocate<T>(N);
+  *host_data = host_res.allocate<T>(N);
+}
+
+template <typename T>
+void deallocTransformScanTestData(camp::resources::Resource& work_res,
+                                  T* work_data,
+                                  T* host_data)
+{
+  camp::resources::Resource host_res{camp::resources::Host()};
+
+  work_res.deallocate(work_data);
+  host_res.deallocate(host_data);
+}
+
+//
+// Check a scan of transformScanTestValue(i) for i in [0, N), scaled by
+// factor.
+//
+template <bool Inclusive, typename OP>
+::testing::AssertionResult check_transform_scan(
+    const typename OP::result_type* actual,
+    typename OP::result_type init,
+    typename OP::result_type factor,
+    int N)
+{
+  using T = typename OP::result_type;
+  T agg = init;
+  for (int i = 0; i < N; ++i) {
+    T expected = agg;
+    agg = OP()(agg, factor * transformScanTestValue<T>(i));
+    if (Inclusive) {
+      expected = agg;
+    }
+    if (actual[i] != expected) {
+      return ::testing::AssertionFailure()
+             << actual[i] << " != " << expected << " (at index " << i << ")";
+    }
+  }
+  return ::testing::AssertionSuccess();
+}
+
+#endif // __TEST_TRANSFORM_SCAN_DATA_HPP__
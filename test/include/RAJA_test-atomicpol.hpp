@@ -24,6 +24,8 @@ using OpenMPAtomicPols =
               RAJA::omp_atomic,
               RAJA::builtin_atomic,
 #endif
+              RAJA::backoff_atomic,
+              RAJA::cpp20_atomic,
               RAJA::auto_atomic
             >;
 #endif  // RAJA_ENABLE_OPENMP
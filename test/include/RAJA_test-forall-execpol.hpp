@@ -29,6 +29,14 @@ using SequentialForallExecPols = camp::list< RAJA::seq_exec,
 using SequentialForallReduceExecPols = camp::list< RAJA::seq_exec,
                                                    RAJA::loop_exec >;
 
+//
+// Sequential execution policy types for kernel parameter reduction tests,
+// which also support RAJA::simd_exec.
+//
+using SequentialForallParamReduceExecPols = camp::list< RAJA::seq_exec,
+                                                        RAJA::loop_exec,
+                                                        RAJA::simd_exec >;
+
 using SequentialForallAtomicExecPols = camp::list< RAJA::seq_exec, 
                                                    RAJA::loop_exec >;
 
@@ -42,6 +50,7 @@ using OpenMPForallExecPols =
               RAJA::omp_for_exec >;
 
 using OpenMPForallReduceExecPols = OpenMPForallExecPols;
+using OpenMPForallParamReduceExecPols = OpenMPForallReduceExecPols;
 
 using OpenMPForallAtomicExecPols =
   camp::list< // This policy works for the tests, but commenting it out
@@ -64,6 +73,7 @@ using TBBForallExecPols = camp::list< RAJA::tbb_for_exec,
                                       RAJA::tbb_for_dynamic >;
 
 using TBBForallReduceExecPols = TBBForallExecPols;
+using TBBForallParamReduceExecPols = TBBForallReduceExecPols;
 
 using TBBForallAtomicExecPols = TBBForallExecPols;
 
@@ -1670,6 +1670,319 @@ TEST(Kernel, ReduceSeqSum)
   delete[] data;
 }
 
+TEST(Kernel, ReduceSeqRowSum)
+{
+
+  int N = 37;
+  int M = 511;
+
+  int *data = new int[N*M];
+  for (int i = 0; i < N*M; ++i) {
+    data[i] = (i * 37) % 11;
+  }
+
+  int *rowsum = new int[N];
+  int *rowmax = new int[N];
+
+  // every column iteration leaves its value in Param<0>, and the Reduce
+  // ending the column loop combines them once per row
+  using SumPol = RAJA::KernelPolicy<
+      For<0, seq_exec,
+        Lambda<0, Params<0>>,
+        For<1, seq_exec,
+          Lambda<1>,
+          RAJA::statement::Reduce<seq_reduce, RAJA::operators::plus, Param<0>,
+            Lambda<2, Segs<0>, Params<0>>
+          >
+        >
+      >
+     >;
+
+  RAJA::kernel_param<SumPol>(
+      RAJA::make_tuple(RAJA::RangeSegment(0, N), RAJA::RangeSegment(0, M)),
+
+      RAJA::make_tuple((int)0),
+
+      [=](int &value) {
+        value = 0;
+      },
+      [=](Index_type r, Index_type c, int &value) {
+        value += data[r*M + c];
+      },
+      [=](Index_type r, int &value) {
+        rowsum[r] = value;
+      });
+
+  using MaxPol = RAJA::KernelPolicy<
+      For<0, seq_exec,
+        Lambda<0, Params<0>>,
+        For<1, seq_exec,
+          Lambda<1>,
+          RAJA::statement::Reduce<seq_reduce, RAJA::operators::maximum,
+                                  Param<0>,
+            Lambda<2, Segs<0>, Params<0>>
+          >
+        >
+      >
+     >;
+
+  RAJA::kernel_param<MaxPol>(
+      RAJA::make_tuple(RAJA::RangeSegment(0, N), RAJA::RangeSegment(0, M)),
+
+      RAJA::make_tuple((int)-1),
+
+      [=](int &value) {
+        value = -1;
+      },
+      [=](Index_type r, Index_type c, int &value) {
+        value = data[r*M + c];
+      },
+      [=](Index_type r, int &value) {
+        rowmax[r] = value;
+      });
+
+  for (int r = 0; r < N; ++r) {
+    int expected_sum = 0;
+    int expected_max = -1;
+    for (int c = 0; c < M; ++c) {
+      expected_sum += data[r*M + c];
+      expected_max = data[r*M + c] > expected_max ? data[r*M + c]
+                                                  : expected_max;
+    }
+    ASSERT_EQ(rowsum[r], expected_sum);
+    ASSERT_EQ(rowmax[r], expected_max);
+  }
+
+  delete[] rowmax;
+  delete[] rowsum;
+  delete[] data;
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+TEST(Kernel, ReduceOmpRegionRowSum)
+{
+
+  int N = 37;
+  int M = 511;
+
+  int *data = new int[N*M];
+  for (int i = 0; i < N*M; ++i) {
+    data[i] = i % 7;
+  }
+
+  int *rowsum = new int[N];
+  for (int r = 0; r < N; ++r) {
+    rowsum[r] = -1;
+  }
+
+  // each thread accumulates a partial row sum in its own copy of Param<0>,
+  // and the team combines them without atomics
+  using Pol = RAJA::KernelPolicy<
+      Region<RAJA::omp_parallel_region,
+        For<0, loop_exec,
+          Lambda<0, Params<0>>,
+          For<1, omp_for_nowait_exec,
+            Lambda<1>
+          >,
+          RAJA::statement::Reduce<omp_reduce, RAJA::operators::plus, Param<0>,
+            Lambda<2, Segs<0>, Params<0>>
+          >
+        >
+      >
+     >;
+
+  RAJA::kernel_param<Pol>(
+      RAJA::make_tuple(RAJA::RangeSegment(0, N), RAJA::RangeSegment(0, M)),
+
+      RAJA::make_tuple((int)0),
+
+      [=](int &value) {
+        value = 0;
+      },
+      [=](Index_type r, Index_type c, int &value) {
+        value += data[r*M + c];
+      },
+      [=](Index_type r, int &value) {
+        rowsum[r] = value;
+      });
+
+  for (int r = 0; r < N; ++r) {
+    int expected = 0;
+    for (int c = 0; c < M; ++c) {
+      expected += data[r*M + c];
+    }
+    ASSERT_EQ(rowsum[r], expected);
+  }
+
+  delete[] rowsum;
+  delete[] data;
+}
+
+TEST(Kernel, ReduceOmpOrderedRegionMax)
+{
+
+  int N = 1023;
+
+  int *data = new int[N];
+  for (int i = 0; i < N; ++i) {
+    data[i] = (i * 37) % N;
+  }
+
+  int max = -1;
+  int *maxPtr = &max;
+
+  using Pol = RAJA::KernelPolicy<
+      Region<RAJA::omp_parallel_region,
+        For<0, omp_for_nowait_exec,
+          Lambda<0>
+        >,
+        RAJA::statement::Reduce<omp_reduce_ordered, RAJA::operators::maximum,
+                                Param<0>,
+          Lambda<1, Params<0>>
+        >
+      >
+     >;
+
+  RAJA::kernel_param<Pol>(
+      RAJA::make_tuple(RAJA::RangeSegment(0, N)),
+
+      RAJA::make_tuple((int)-1),
+
+      [=](Index_type i, int &value) {
+        value = data[i] > value ? data[i] : value;
+      },
+      [=](int &value) {
+        *maxPtr = value;
+      });
+
+  ASSERT_EQ(max, N-1);
+
+  delete[] data;
+}
+
+#endif  // RAJA_ENABLE_OPENMP
+
+#if defined(RAJA_ENABLE_TBB)
+
+TEST(Kernel, ReduceTBBSum)
+{
+
+  int N = 1023;
+
+  int *data = new int[N];
+  for (int i = 0; i < N; ++i) {
+    data[i] = i;
+  }
+
+  using Pol = RAJA::KernelPolicy<
+      RAJA::statement::For<0, seq_exec,
+        Lambda<0>,
+        RAJA::statement::Reduce<tbb_reduce, RAJA::operators::plus, Param<0>,
+          Lambda<1, Params<0>>
+        >
+      >
+     >;
+
+  int sum = 0;
+  int *sumPtr = &sum;
+
+  RAJA::kernel_param<Pol>(
+      RAJA::make_tuple(RAJA::RangeSegment(0, N)),
+
+      RAJA::make_tuple((int)0),
+
+      [=](Index_type i, int &value) {
+        value = data[i];
+      },
+      [=](int &value) {
+        (*sumPtr) += value;
+      });
+
+  ASSERT_EQ(sum, N*(N-1)/2);
+
+  delete[] data;
+}
+
+TEST(Kernel, ReduceTBBRowSum)
+{
+
+  int N = 37;
+  int M = 511;
+
+  int *data = new int[N*M];
+  for (int i = 0; i < N*M; ++i) {
+    data[i] = (i * 37) % 11;
+  }
+
+  int *rowsum = new int[N];
+  int *rowsum_by_row = new int[N];
+
+  // the columns of each row are split over TBB tasks, each with its own copy
+  // of Param<0>; the partial values of the tasks are combined per row
+  using ColPol = RAJA::KernelPolicy<
+      For<0, seq_exec,
+        Lambda<0, Params<0>>,
+        For<1, tbb_for_exec,
+          Lambda<1>,
+          RAJA::statement::Reduce<tbb_reduce, RAJA::operators::plus, Param<0>,
+            Lambda<2, Segs<0>, Params<0>>
+          >
+        >
+      >
+     >;
+
+  // the rows are split over TBB tasks, and each row is reduced by one task
+  using RowPol = RAJA::KernelPolicy<
+      For<0, tbb_for_exec,
+        Lambda<0, Params<0>>,
+        For<1, seq_exec,
+          Lambda<1>,
+          RAJA::statement::Reduce<tbb_reduce, RAJA::operators::plus, Param<0>,
+            Lambda<3, Segs<0>, Params<0>>
+          >
+        >
+      >
+     >;
+
+  auto segs = RAJA::make_tuple(RAJA::RangeSegment(0, N),
+                               RAJA::RangeSegment(0, M));
+
+  auto init = [=](int &value) {
+    value = 0;
+  };
+  auto add = [=](Index_type r, Index_type c, int &value) {
+    value += data[r*M + c];
+  };
+  auto store = [=](Index_type r, int &value) {
+    rowsum[r] = value;
+  };
+  auto store_by_row = [=](Index_type r, int &value) {
+    rowsum_by_row[r] = value;
+  };
+
+  RAJA::kernel_param<ColPol>(segs, RAJA::make_tuple((int)0),
+                             init, add, store, store_by_row);
+
+  RAJA::kernel_param<RowPol>(segs, RAJA::make_tuple((int)0),
+                             init, add, store, store_by_row);
+
+  for (int r = 0; r < N; ++r) {
+    int expected = 0;
+    for (int c = 0; c < M; ++c) {
+      expected += data[r*M + c];
+    }
+    ASSERT_EQ(rowsum[r], expected);
+    ASSERT_EQ(rowsum_by_row[r], expected);
+  }
+
+  delete[] rowsum_by_row;
+  delete[] rowsum;
+  delete[] data;
+}
+
+#endif  // RAJA_ENABLE_TBB
+
 
 
 #if defined(RAJA_ENABLE_CUDA)
@@ -13,6 +13,7 @@
 #include <cstdio>
 #include <cstdlib>
 #include <iostream>
+#include <vector>
 
 
 using namespace RAJA;
@@ -48,6 +49,85 @@ TEST(SIMD, Align)
   RAJA::free_aligned(b);
 }
 
+template <typename Op>
+class SIMDScan : public ::testing::Test
+{
+};
+
+using SIMDScanOps = ::testing::Types<RAJA::operators::plus<int>,
+                                     RAJA::operators::minimum<int>,
+                                     RAJA::operators::maximum<int>,
+                                     RAJA::operators::plus<float>,
+                                     RAJA::operators::minimum<float>,
+                                     RAJA::operators::maximum<float>,
+                                     RAJA::operators::plus<double>,
+                                     RAJA::operators::minimum<double>,
+                                     RAJA::operators::maximum<double>>;
+
+TYPED_TEST_SUITE(SIMDScan, SIMDScanOps);
+
+// sizes around the 4, 8 and 16 lanes of the AVX2 and AVX-512 kernels
+static const int simd_scan_sizes[] = {1, 3, 4, 7, 8, 9, 15, 16, 17, 31, 33, 357};
+
+template <typename T>
+std::vector<T> simd_scan_input(int N)
+{
+  std::vector<T> in(N);
+  for (int i = 0; i < N; ++i) {
+    in[i] = static_cast<T>((i * 37) % 101 - 50);
+  }
+  return in;
+}
+
+TYPED_TEST(SIMDScan, Inclusive)
+{
+  using Op = TypeParam;
+  using T = typename Op::result_type;
+
+  for (int N : simd_scan_sizes) {
+    std::vector<T> in = simd_scan_input<T>(N);
+    std::vector<T> out(N);
+    std::vector<T> inplace = in;
+
+    RAJA::inclusive_scan(RAJA::simd_exec{}, in.data(), in.data() + N,
+                         out.data(), Op{});
+    RAJA::inclusive_scan_inplace(RAJA::simd_exec{}, inplace.data(),
+                                 inplace.data() + N, Op{});
+
+    T agg = in[0];
+    for (int i = 0; i < N; ++i) {
+      if (i > 0) agg = Op{}(agg, in[i]);
+      ASSERT_EQ(out[i], agg) << "N = " << N << ", i = " << i;
+      ASSERT_EQ(inplace[i], agg) << "N = " << N << ", i = " << i;
+    }
+  }
+}
+
+TYPED_TEST(SIMDScan, Exclusive)
+{
+  using Op = TypeParam;
+  using T = typename Op::result_type;
+
+  for (int N : simd_scan_sizes) {
+    std::vector<T> in = simd_scan_input<T>(N);
+    std::vector<T> out(N);
+    std::vector<T> inplace = in;
+    const T init = static_cast<T>(5);
+
+    RAJA::exclusive_scan(RAJA::simd_exec{}, in.data(), in.data() + N,
+                         out.data(), Op{}, init);
+    RAJA::exclusive_scan_inplace(RAJA::simd_exec{}, inplace.data(),
+                                 inplace.data() + N, Op{}, init);
+
+    T agg = init;
+    for (int i = 0; i < N; ++i) {
+      ASSERT_EQ(out[i], agg) << "N = " << N << ", i = " << i;
+      ASSERT_EQ(inplace[i], agg) << "N = " << N << ", i = " << i;
+      agg = Op{}(agg, in[i]);
+    }
+  }
+}
+
 #if defined(RAJA_ENABLE_OPENMP)
 TEST(SIMD, OMPAndSimd)
 {
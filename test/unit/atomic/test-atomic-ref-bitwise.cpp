@@ -71,10 +71,16 @@ REGISTER_TYPED_TEST_SUITE_P( AtomicRefBasicBitwiseUnitTest,
 using basic_types = 
     ::testing::Types<
                       std::tuple<int, RAJA::builtin_atomic>,
+                      std::tuple<int, RAJA::backoff_atomic>,
+                      std::tuple<int, RAJA::cpp20_atomic>,
                       std::tuple<int, RAJA::seq_atomic>,
                       std::tuple<unsigned int, RAJA::builtin_atomic>,
+                      std::tuple<unsigned int, RAJA::backoff_atomic>,
+                      std::tuple<unsigned int, RAJA::cpp20_atomic>,
                       std::tuple<unsigned int, RAJA::seq_atomic>,
                       std::tuple<unsigned long long int, RAJA::builtin_atomic>,
+                      std::tuple<unsigned long long int, RAJA::backoff_atomic>,
+                      std::tuple<unsigned long long int, RAJA::cpp20_atomic>,
                       std::tuple<unsigned long long int, RAJA::seq_atomic>
 #if defined(RAJA_ENABLE_OPENMP)
                       ,
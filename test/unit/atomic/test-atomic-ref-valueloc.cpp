@@ -0,0 +1,275 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for atomic min and max with location and
+/// 16 byte atomics
+///
+
+#include "RAJA/RAJA.hpp"
+
+#include "RAJA_gtest.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// Basic MinLoc/MaxLoc
+
+template <typename T>
+class AtomicRefValueLocUnitTest : public ::testing::Test
+{};
+
+TYPED_TEST_SUITE_P( AtomicRefValueLocUnitTest );
+
+TYPED_TEST_P( AtomicRefValueLocUnitTest, BasicMinLoc )
+{
+  using AtomicPolicy = typename std::tuple_element<0, TypeParam>::type;
+  using VL = RAJA::MinLoc<double>;
+
+  VL theval;
+  RAJA::AtomicRef<VL, AtomicPolicy> test1( &theval );
+
+  VL result = test1.fetch_min( VL(5.0, 7) );
+  ASSERT_EQ( result.loc, -1 );
+  ASSERT_EQ( theval.val, 5.0 );
+  ASSERT_EQ( theval.loc, 7 );
+
+  // larger value is discarded
+  result = test1.fetch_min( VL(6.0, 2) );
+  ASSERT_EQ( result.val, 5.0 );
+  ASSERT_EQ( theval.loc, 7 );
+
+  // equal value keeps the smaller index
+  test1.fetch_min( VL(5.0, 9) );
+  ASSERT_EQ( theval.loc, 7 );
+  test1.fetch_min( VL(5.0, 3) );
+  ASSERT_EQ( theval.val, 5.0 );
+  ASSERT_EQ( theval.loc, 3 );
+
+  result = test1.fetch_min( VL(-1.0, 11) );
+  ASSERT_EQ( result.val, 5.0 );
+  ASSERT_EQ( result.loc, 3 );
+  ASSERT_EQ( theval.val, -1.0 );
+  ASSERT_EQ( theval.loc, 11 );
+}
+
+TYPED_TEST_P( AtomicRefValueLocUnitTest, BasicMaxLoc )
+{
+  using AtomicPolicy = typename std::tuple_element<0, TypeParam>::type;
+  using VL = RAJA::MaxLoc<float, int>;
+
+  VL theval;
+  RAJA::AtomicRef<VL, AtomicPolicy> test1( &theval );
+
+  test1.fetch_max( VL(5.0f, 7) );
+  test1.fetch_max( VL(4.0f, 1) );
+  ASSERT_EQ( theval.val, 5.0f );
+  ASSERT_EQ( theval.loc, 7 );
+
+  test1.fetch_max( VL(5.0f, 2) );
+  ASSERT_EQ( theval.loc, 2 );
+
+  VL result = test1.fetch_max( VL(8.0f, 4) );
+  ASSERT_EQ( result.val, 5.0f );
+  ASSERT_EQ( result.loc, 2 );
+  ASSERT_EQ( theval.val, 8.0f );
+  ASSERT_EQ( theval.loc, 4 );
+}
+
+TYPED_TEST_P( AtomicRefValueLocUnitTest, ExchangeCAS )
+{
+  using AtomicPolicy = typename std::tuple_element<0, TypeParam>::type;
+  using VL = RAJA::MinLoc<double>;
+
+  VL theval(1.0, 1);
+  RAJA::AtomicRef<VL, AtomicPolicy> test1( &theval );
+
+  VL result = test1.exchange( VL(2.0, 2) );
+  ASSERT_EQ( result.val, 1.0 );
+  ASSERT_EQ( result.loc, 1 );
+  ASSERT_EQ( theval.loc, 2 );
+
+  result = test1.CAS( VL(2.0, 2), VL(3.0, 3) );
+  ASSERT_EQ( result.loc, 2 );
+  ASSERT_EQ( theval.loc, 3 );
+
+  result = test1.CAS( VL(2.0, 2), VL(4.0, 4) );
+  ASSERT_EQ( result.loc, 3 );
+  ASSERT_EQ( theval.val, 3.0 );
+  ASSERT_EQ( theval.loc, 3 );
+}
+
+// fills the bytes of v after its index, which are padding for (double, int)
+template <typename VL>
+static void set_padding( VL& v, unsigned char byte )
+{
+  char* begin = reinterpret_cast<char*>(&v.loc) + sizeof(v.loc);
+  char* end = reinterpret_cast<char*>(&v) + sizeof(VL);
+  std::memset(begin, byte, end - begin);
+}
+
+TYPED_TEST_P( AtomicRefValueLocUnitTest, PaddedCAS )
+{
+  using AtomicPolicy = typename std::tuple_element<0, TypeParam>::type;
+  using VL = RAJA::MinLoc<double, int>;
+  static_assert( sizeof(VL) > sizeof(double) + sizeof(int),
+                 "MinLoc<double, int> is expected to have padding" );
+
+  // compare only has to match val and loc, not the padding
+  alignas(16) VL theval(1.0, 1);
+  set_padding( theval, 0xab );
+  RAJA::AtomicRef<VL, AtomicPolicy> test1( &theval );
+
+  VL compare(1.0, 1);
+  set_padding( compare, 0xcd );
+  VL result = test1.CAS( compare, VL(2.0, 2) );
+  ASSERT_EQ( result.val, 1.0 );
+  ASSERT_EQ( result.loc, 1 );
+  ASSERT_EQ( theval.val, 2.0 );
+  ASSERT_EQ( theval.loc, 2 );
+
+  // a pair rebuilt from val and loc always succeeds
+  for (int i = 0; i < 100; ++i) {
+    VL expected(theval.val, theval.loc);
+    set_padding( expected, static_cast<unsigned char>(i) );
+    result = test1.CAS( expected, VL(expected.val + 1.0, expected.loc + 1) );
+    ASSERT_EQ( result.loc, expected.loc );
+  }
+  ASSERT_EQ( theval.val, 102.0 );
+  ASSERT_EQ( theval.loc, 102 );
+
+  // a mismatch in loc alone fails
+  result = test1.CAS( VL(102.0, 7), VL(0.0, 0) );
+  ASSERT_EQ( result.loc, 102 );
+  ASSERT_EQ( theval.loc, 102 );
+}
+
+REGISTER_TYPED_TEST_SUITE_P( AtomicRefValueLocUnitTest,
+                             BasicMinLoc,
+                             BasicMaxLoc,
+                             ExchangeCAS,
+                             PaddedCAS
+                           );
+
+using valueloc_types =
+    ::testing::Types<
+                      std::tuple<RAJA::builtin_atomic>,
+                      std::tuple<RAJA::seq_atomic>,
+                      std::tuple<RAJA::auto_atomic>
+#if defined(RAJA_ENABLE_OPENMP)
+                      ,
+                      std::tuple<RAJA::omp_atomic>
+#endif
+                    >;
+
+INSTANTIATE_TYPED_TEST_SUITE_P( ValueLocUnitTest,
+                                AtomicRefValueLocUnitTest,
+                                valueloc_types
+                              );
+
+// 16 byte CAS on a plain struct
+
+struct WidePair {
+  long long a;
+  long long b;
+};
+
+TEST( AtomicWideUnitTest, ExchangeCAS )
+{
+  alignas(16) WidePair theval{1, 2};
+  RAJA::AtomicRef<WidePair, RAJA::builtin_atomic> test1( &theval );
+
+  WidePair result = test1.exchange( WidePair{3, 4} );
+  ASSERT_EQ( result.a, 1 );
+  ASSERT_EQ( result.b, 2 );
+  ASSERT_EQ( theval.a, 3 );
+  ASSERT_EQ( theval.b, 4 );
+
+  result = test1.CAS( WidePair{3, 4}, WidePair{5, 6} );
+  ASSERT_EQ( result.a, 3 );
+  ASSERT_EQ( theval.a, 5 );
+  ASSERT_EQ( theval.b, 6 );
+
+  result = test1.CAS( WidePair{3, 4}, WidePair{7, 8} );
+  ASSERT_EQ( result.a, 5 );
+  ASSERT_EQ( theval.a, 5 );
+  ASSERT_EQ( theval.b, 6 );
+}
+
+// Pairs of 8 and 16 bytes are aligned for a single compare-and-swap
+
+TEST( AtomicValueLocUnitTest, Alignment )
+{
+  ASSERT_EQ( alignof(RAJA::MinLoc<double>), 16u );
+  ASSERT_EQ( alignof(RAJA::MaxLoc<double, int>), 16u );
+  ASSERT_EQ( alignof(RAJA::MinLoc<float, int>), 8u );
+  ASSERT_EQ( sizeof(RAJA::MinLoc<double>), 16u );
+
+  RAJA::MinLoc<double> pairs[3];
+  for (auto& p : pairs) {
+    ASSERT_EQ( reinterpret_cast<std::uintptr_t>(&p) % 16, 0u );
+  }
+}
+
+TEST( AtomicWideUnitTest, Misaligned )
+{
+  // a location that is not 16 byte aligned can't use the native instruction
+  struct alignas(16) {
+    long long pad;
+    WidePair pair;
+  } storage;
+  storage.pair = WidePair{1, 2};
+  RAJA::AtomicRef<WidePair, RAJA::builtin_atomic> test1( &storage.pair );
+
+  WidePair result = test1.CAS( WidePair{1, 2}, WidePair{3, 4} );
+  ASSERT_EQ( result.a, 1 );
+  ASSERT_EQ( storage.pair.a, 3 );
+  ASSERT_EQ( storage.pair.b, 4 );
+
+  result = test1.exchange( WidePair{5, 6} );
+  ASSERT_EQ( result.b, 4 );
+  ASSERT_EQ( storage.pair.a, 5 );
+  ASSERT_EQ( storage.pair.b, 6 );
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+// Parallel argmin per bin through an atomic view
+
+TEST( AtomicValueLocOpenMPUnitTest, ArgMinView )
+{
+  using VL = RAJA::MinLoc<double>;
+  constexpr int N = 100000;
+  constexpr int bins = 4;
+
+  std::vector<double> x(N);
+  for (int i = 0; i < N; ++i) {
+    x[i] = static_cast<double>((i * 7919) % 1000);
+  }
+
+  std::vector<VL> best(bins);
+  RAJA::View<VL, RAJA::Layout<1>> best_view(best.data(), bins);
+  auto atomic_best = RAJA::make_atomic_view<RAJA::builtin_atomic>(best_view);
+  double const* xp = x.data();
+
+  RAJA::forall<RAJA::omp_parallel_for_exec>(RAJA::RangeSegment(0, N),
+                                            [=](RAJA::Index_type i) {
+    atomic_best(i % bins).fetch_min( VL(xp[i], i) );
+  });
+
+  for (int b = 0; b < bins; ++b) {
+    VL expected;
+    for (int i = b; i < N; i += bins) {
+      if (x[i] < expected.val) {
+        expected = VL(x[i], i);
+      }
+    }
+    ASSERT_EQ( best[b].val, expected.val );
+    ASSERT_EQ( best[b].loc, expected.loc );
+  }
+}
+#endif
@@ -15,14 +15,26 @@
 using basic_types = 
     ::testing::Types<
                       std::tuple<int, RAJA::builtin_atomic>,
+                      std::tuple<int, RAJA::backoff_atomic>,
+                      std::tuple<int, RAJA::cpp20_atomic>,
+                      std::tuple<int, RAJA::cpp20_atomic_seq_cst>,
                       std::tuple<int, RAJA::seq_atomic>,
                       std::tuple<unsigned int, RAJA::builtin_atomic>,
+                      std::tuple<unsigned int, RAJA::backoff_atomic>,
+                      std::tuple<unsigned int, RAJA::cpp20_atomic>,
                       std::tuple<unsigned int, RAJA::seq_atomic>,
                       std::tuple<unsigned long long int, RAJA::builtin_atomic>,
+                      std::tuple<unsigned long long int, RAJA::backoff_atomic>,
+                      std::tuple<unsigned long long int, RAJA::cpp20_atomic>,
                       std::tuple<unsigned long long int, RAJA::seq_atomic>,
                       std::tuple<float, RAJA::builtin_atomic>,
+                      std::tuple<float, RAJA::backoff_atomic>,
+                      std::tuple<float, RAJA::cpp20_atomic>,
                       std::tuple<float, RAJA::seq_atomic>,
                       std::tuple<double, RAJA::builtin_atomic>,
+                      std::tuple<double, RAJA::backoff_atomic>,
+                      std::tuple<double, RAJA::cpp20_atomic>,
+                      std::tuple<double, RAJA::cpp20_atomic_seq_cst>,
                       std::tuple<double, RAJA::seq_atomic>
 #if defined(RAJA_ENABLE_OPENMP)
                       ,
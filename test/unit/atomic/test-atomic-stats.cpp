@@ -0,0 +1,133 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for the backoff_atomic contention statistics
+///
+
+#include "RAJA/RAJA.hpp"
+
+#include "RAJA_gtest.hpp"
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+TEST(AtomicStatsUnitTest, HottestOrder)
+{
+  RAJA::atomic_stats::reset();
+
+  int a = 0, b = 0, c = 0;
+  RAJA::atomic_stats::record(&a, 1);
+  RAJA::atomic_stats::record(&b, 5);
+  RAJA::atomic_stats::record(&c, 2);
+  RAJA::atomic_stats::record(&a, 3);
+
+  std::vector<RAJA::atomic_stats::entry> hot = RAJA::atomic_stats::hottest();
+  ASSERT_EQ(hot.size(), 3u);
+
+  ASSERT_EQ(hot[0].address, static_cast<void const*>(&b));
+  ASSERT_EQ(hot[0].contended, 1ull);
+  ASSERT_EQ(hot[0].retries, 5ull);
+
+  ASSERT_EQ(hot[1].address, static_cast<void const*>(&a));
+  ASSERT_EQ(hot[1].contended, 2ull);
+  ASSERT_EQ(hot[1].retries, 4ull);
+
+  ASSERT_EQ(hot[2].address, static_cast<void const*>(&c));
+  ASSERT_EQ(hot[2].contended, 1ull);
+  ASSERT_EQ(hot[2].retries, 2ull);
+
+  hot = RAJA::atomic_stats::hottest(1);
+  ASSERT_EQ(hot.size(), 1u);
+  ASSERT_EQ(hot[0].address, static_cast<void const*>(&b));
+
+  RAJA::atomic_stats::reset();
+}
+
+TEST(AtomicStatsUnitTest, Report)
+{
+  RAJA::atomic_stats::reset();
+
+  int a = 0, b = 0;
+  RAJA::atomic_stats::record(&a, 7);
+  RAJA::atomic_stats::record(&b, 2);
+
+  std::ostringstream expected_a;
+  expected_a << "  " << static_cast<void const*>(&a)
+             << ": 1 contended operations, 7 retries\n";
+  std::ostringstream expected_b;
+  expected_b << "  " << static_cast<void const*>(&b)
+             << ": 1 contended operations, 2 retries\n";
+
+  std::ostringstream os;
+  RAJA::atomic_stats::report(os);
+  std::string out = os.str();
+
+  ASSERT_EQ(out.find("RAJA backoff_atomic contention"), 0u);
+  ASSERT_NE(out.find(expected_a.str()), std::string::npos);
+  ASSERT_NE(out.find(expected_b.str()), std::string::npos);
+  ASSERT_LT(out.find(expected_a.str()), out.find(expected_b.str()));
+  ASSERT_EQ(out.find("other addresses"), std::string::npos);
+
+  // only the most retried address is listed
+  std::ostringstream os1;
+  RAJA::atomic_stats::report(os1, 1);
+  ASSERT_NE(os1.str().find(expected_a.str()), std::string::npos);
+  ASSERT_EQ(os1.str().find(expected_b.str()), std::string::npos);
+
+  RAJA::atomic_stats::reset();
+}
+
+TEST(AtomicStatsUnitTest, Reset)
+{
+  RAJA::atomic_stats::reset();
+
+  int a = 0;
+  RAJA::atomic_stats::record(&a, 3);
+  ASSERT_EQ(RAJA::atomic_stats::hottest().size(), 1u);
+
+  RAJA::atomic_stats::reset();
+  ASSERT_TRUE(RAJA::atomic_stats::hottest().empty());
+
+  std::ostringstream os;
+  RAJA::atomic_stats::report(os);
+  ASSERT_EQ(os.str().find(": "), std::string::npos);
+
+  // counts start over for an address seen before the reset
+  RAJA::atomic_stats::record(&a, 1);
+  std::vector<RAJA::atomic_stats::entry> hot = RAJA::atomic_stats::hottest();
+  ASSERT_EQ(hot.size(), 1u);
+  ASSERT_EQ(hot[0].contended, 1ull);
+  ASSERT_EQ(hot[0].retries, 1ull);
+
+  RAJA::atomic_stats::reset();
+}
+
+TEST(AtomicStatsUnitTest, Overflow)
+{
+  RAJA::atomic_stats::reset();
+
+  // more distinct addresses than the table holds, the rest are summed up
+  std::vector<char> addresses(1 << 13);
+  for (char const& address : addresses) {
+    RAJA::atomic_stats::record(&address, 1);
+  }
+
+  ASSERT_EQ(RAJA::atomic_stats::hottest(addresses.size()).size(), 1u << 12);
+
+  std::ostringstream os;
+  RAJA::atomic_stats::report(os, 0);
+  ASSERT_NE(os.str().find("  other addresses: 4096 contended operations, "
+                          "4096 retries\n"),
+            std::string::npos);
+
+  RAJA::atomic_stats::reset();
+  std::ostringstream os_reset;
+  RAJA::atomic_stats::report(os_reset);
+  ASSERT_EQ(os_reset.str().find("other addresses"), std::string::npos);
+}
@@ -0,0 +1,270 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for basic_mempool
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/util/basic_mempool.hpp"
+#include "RAJA/util/mempool_allocators.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// generic_allocator that counts the arenas it hands out
+struct CountingAllocator {
+  static int live;
+  static int total;
+
+  void* malloc(size_t nbytes)
+  {
+    ++live;
+    ++total;
+    return std::malloc(nbytes);
+  }
+
+  bool free(void* ptr)
+  {
+    --live;
+    std::free(ptr);
+    return true;
+  }
+};
+
+int CountingAllocator::live = 0;
+int CountingAllocator::total = 0;
+
+using counting_pool = RAJA::basic_mempool::MemPool<CountingAllocator>;
+using size_classes = RAJA::basic_mempool::detail::SizeClassCache;
+
+static bool is_aligned(void const* ptr, size_t alignment)
+{
+  return reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0;
+}
+
+TEST(MemPoolUnitTest, SizeClasses)
+{
+  ASSERT_EQ(size_classes::class_of(0, 1), 0u);
+  ASSERT_EQ(size_classes::class_of(16, 8), 0u);
+  ASSERT_EQ(size_classes::class_of(17, 8), 1u);
+  ASSERT_EQ(size_classes::class_of(8, 64), 2u);
+  ASSERT_EQ(size_classes::class_of(size_t(1) << 16, 8),
+            size_classes::num_classes - 1);
+  ASSERT_EQ(size_classes::class_of((size_t(1) << 16) + 1, 8),
+            size_t(size_classes::num_classes));
+}
+
+TEST(MemPoolUnitTest, SmallReuse)
+{
+  counting_pool pool;
+
+  std::vector<double*> ptrs;
+  for (int n = 1; n <= 2000; n += 7) {
+    double* p = pool.malloc<double>(n);
+    ASSERT_NE(p, nullptr);
+    ASSERT_TRUE(is_aligned(p, alignof(double)));
+    for (int i = 0; i < n; ++i) {
+      p[i] = n;
+    }
+    ptrs.push_back(p);
+  }
+  for (double* p : ptrs) {
+    ASSERT_EQ(p[0], p[static_cast<int>(p[0]) - 1]);
+  }
+
+  // freed blocks are handed out again, most recently freed first
+  double* p = ptrs[10];
+  pool.free(p);
+  ASSERT_EQ(pool.malloc<double>(71), p);
+
+  for (double* q : ptrs) {
+    pool.free(q);
+  }
+
+  // churn in a freed class needs no more memory
+  const int arenas = CountingAllocator::total;
+  for (int i = 0; i < 100000; ++i) {
+    pool.free(pool.malloc<char>(100 + i % 20));
+  }
+  ASSERT_EQ(CountingAllocator::total, arenas);
+
+  pool.free_chunks();
+  ASSERT_EQ(CountingAllocator::live, 0);
+}
+
+TEST(MemPoolUnitTest, Alignment)
+{
+  counting_pool pool;
+
+  char* small = pool.malloc<char>(10, 256);
+  ASSERT_TRUE(is_aligned(small, 256));
+  char* large = pool.malloc<char>(100000, 4096);
+  ASSERT_TRUE(is_aligned(large, 4096));
+
+  pool.free(small);
+  pool.free(large);
+  pool.free_chunks();
+  ASSERT_EQ(CountingAllocator::live, 0);
+}
+
+TEST(MemPoolUnitTest, LargeCoalescing)
+{
+  counting_pool pool;
+  pool.arena_size(size_t(1) << 20);
+
+  const size_t n = size_t(1) << 17;
+  char* a = pool.malloc<char>(n);
+  char* b = pool.malloc<char>(n);
+  char* c = pool.malloc<char>(n);
+  ASSERT_NE(a, nullptr);
+  ASSERT_NE(b, nullptr);
+  ASSERT_NE(c, nullptr);
+  std::memset(a, 1, n);
+  std::memset(b, 2, n);
+  std::memset(c, 3, n);
+  ASSERT_EQ(b[0], 2);
+
+  const int arenas = CountingAllocator::total;
+  pool.free(b);
+  pool.free(a);
+  pool.free(c);
+
+  // the three freed blocks merge back into one chunk of the same arena
+  char* d = pool.malloc<char>(3 * n);
+  ASSERT_NE(d, nullptr);
+  ASSERT_EQ(CountingAllocator::total, arenas);
+
+  pool.free(d);
+  pool.free_chunks();
+  ASSERT_EQ(CountingAllocator::live, 0);
+}
+
+TEST(MemPoolUnitTest, ThreadCaching)
+{
+  counting_pool pool;
+  pool.arena_size(size_t(1) << 20);
+
+  ASSERT_FALSE(pool.thread_caching(true));
+  ASSERT_TRUE(pool.thread_caching());
+
+  // a freed block is reused once the pending frees have been flushed
+  std::vector<int*> ptrs;
+  for (size_t i = 0; i < 2 * RAJA::basic_mempool::detail::ThreadCache::capacity;
+       ++i) {
+    ptrs.push_back(pool.malloc<int>(10));
+  }
+  for (int* p : ptrs) {
+    pool.free(p);
+  }
+  int* p = pool.malloc<int>(10);
+  ASSERT_NE(std::find(ptrs.begin(), ptrs.end(), p), ptrs.end());
+  pool.free(p);
+
+  // large blocks are returned to the pool when they are freed
+  char* large = pool.malloc<char>(size_t(1) << 20);
+  pool.free(large);
+  const int arenas = CountingAllocator::total;
+  pool.free(pool.malloc<char>(size_t(1) << 20));
+  ASSERT_EQ(CountingAllocator::total, arenas);
+
+#if defined(RAJA_ENABLE_OPENMP)
+  // so a large block freed by one thread is reused by another
+  int grown = 0;
+#pragma omp parallel num_threads(2) reduction(+ : grown)
+  {
+    if (omp_get_thread_num() == 0) {
+      pool.free(pool.malloc<char>(size_t(1) << 20));
+    }
+#pragma omp barrier
+    if (omp_get_thread_num() == 1) {
+      const int before = CountingAllocator::total;
+      pool.free(pool.malloc<char>(size_t(1) << 20));
+      grown += CountingAllocator::total != before;
+    }
+  }
+  ASSERT_EQ(grown, 0);
+
+  int errors = 0;
+#pragma omp parallel reduction(+ : errors)
+  {
+    const int tag = omp_get_thread_num() + 1;
+    std::vector<int*> mine;
+    for (int i = 0; i < 20000; ++i) {
+      int* q = pool.malloc<int>(4 + i % 60);
+      q[0] = tag;
+      mine.push_back(q);
+      if (mine.size() > 50) {
+        for (int* r : mine) {
+          errors += r[0] != tag;
+          pool.free(r);
+        }
+        mine.clear();
+      }
+    }
+    for (int* r : mine) {
+      errors += r[0] != tag;
+      pool.free(r);
+    }
+  }
+  ASSERT_EQ(errors, 0);
+#endif
+
+  ASSERT_TRUE(pool.thread_caching(false));
+  ASSERT_FALSE(pool.thread_caching());
+
+  // drained blocks are back in the shared pool
+  int* q = pool.malloc<int>(10);
+  ASSERT_NE(q, nullptr);
+  pool.free(q);
+
+  pool.free_chunks();
+  ASSERT_EQ(CountingAllocator::live, 0);
+}
+
+// fills a pool backed by allocator_t with small and large blocks
+template <typename allocator_t>
+static void check_arena_allocator()
+{
+  allocator_t alloc;
+  char* arena = static_cast<char*>(alloc.malloc(size_t(3) << 20));
+  ASSERT_NE(arena, nullptr);
+#if defined(__linux__)
+  ASSERT_TRUE(is_aligned(arena, size_t(1) << 21));
+#endif
+  std::memset(arena, 7, size_t(3) << 20);
+  ASSERT_EQ(arena[(size_t(3) << 20) - 1], 7);
+  ASSERT_TRUE(alloc.free(arena));
+
+  RAJA::basic_mempool::MemPool<allocator_t> pool;
+  pool.arena_size(size_t(4) << 20);
+
+  std::vector<double*> ptrs;
+  for (int n = 1; n <= 300000; n *= 3) {
+    double* p = pool.template malloc<double>(n);
+    ASSERT_NE(p, nullptr);
+    p[0] = n;
+    p[n - 1] = n;
+    ptrs.push_back(p);
+  }
+  for (double* p : ptrs) {
+    ASSERT_EQ(p[0], p[static_cast<int>(p[0]) - 1]);
+    pool.free(p);
+  }
+  pool.free_chunks();
+}
+
+TEST(MemPoolUnitTest, HugePageAllocators)
+{
+  check_arena_allocator<RAJA::basic_mempool::hugepage_allocator>();
+  check_arena_allocator<RAJA::basic_mempool::numa_local_allocator<>>();
+  check_arena_allocator<RAJA::basic_mempool::numa_local_allocator<0>>();
+  check_arena_allocator<RAJA::basic_mempool::interleaved_allocator>();
+}
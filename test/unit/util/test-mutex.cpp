@@ -0,0 +1,106 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for spin locks and lock arrays
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/util/mutex.hpp"
+
+#include <vector>
+
+template <typename T>
+class MutexUnitTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_SUITE_P(MutexUnitTest);
+
+TYPED_TEST_P(MutexUnitTest, TryLock)
+{
+  TypeParam m;
+
+  ASSERT_TRUE(m.try_lock());
+  ASSERT_FALSE(m.try_lock());
+  m.unlock();
+
+  {
+    RAJA::lock_guard<TypeParam> guard(m);
+    ASSERT_FALSE(m.try_lock());
+  }
+  ASSERT_TRUE(m.try_lock());
+  m.unlock();
+}
+
+TYPED_TEST_P(MutexUnitTest, LockArray)
+{
+  RAJA::lock_array<TypeParam> locks(100);
+  ASSERT_EQ(locks.size(), 128u);
+
+  for (int i = 0; i < 1000; ++i) {
+    ASSERT_LT(locks.lock_id(i), locks.size());
+    ASSERT_EQ(&locks.for_index(i), &locks[locks.lock_id(i)]);
+  }
+
+  // copies share the locks
+  RAJA::lock_array<TypeParam> copy = locks;
+  locks.lock(7);
+  ASSERT_FALSE(copy.try_lock(7));
+  copy.unlock(7);
+
+  // a pair sharing a lock is only locked once
+  RAJA::lock_array<TypeParam> single(1);
+  single.lock(3, 5);
+  ASSERT_FALSE(single.try_lock(4));
+  single.unlock(3, 5);
+  ASSERT_TRUE(single.try_lock(4));
+  single.unlock(4);
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TYPED_TEST_P(MutexUnitTest, OpenMPTransfers)
+{
+  constexpr int cells = 1000;
+  constexpr int N = 100000;
+
+  RAJA::lock_array<TypeParam> locks(64);
+  std::vector<long> count(cells, 0);
+  long* counts = count.data();
+
+#pragma omp parallel for
+  for (int i = 0; i < N; ++i) {
+    const int from = i % cells;
+    const int to = (i * 7) % cells;
+    locks.lock(from, to);
+    counts[from] -= 1;
+    counts[to] += 1;
+    locks.unlock(from, to);
+
+    locks.lock(to);
+    counts[to] += 2;
+    locks.unlock(to);
+  }
+
+  long total = 0;
+  for (long c : count) {
+    total += c;
+  }
+  ASSERT_EQ(total, 2L * N);
+}
+#endif
+
+#if defined(RAJA_ENABLE_OPENMP)
+REGISTER_TYPED_TEST_SUITE_P(MutexUnitTest, TryLock, LockArray, OpenMPTransfers);
+#else
+REGISTER_TYPED_TEST_SUITE_P(MutexUnitTest, TryLock, LockArray);
+#endif
+
+using MutexTypes = ::testing::Types<RAJA::spin_mutex, RAJA::ticket_mutex>;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(Mutex, MutexUnitTest, MutexTypes);